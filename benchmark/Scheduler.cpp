@@ -0,0 +1,99 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include <execute/Scheduler.h>
+
+#include <utils/WithAdaptiveUnit.h>
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace ct = clean_test;
+using Clock = std::chrono::steady_clock;
+using Mode = ct::execute::SchedulingMode;
+
+constexpr auto num_cases = 200'000ul;
+constexpr auto num_repetitions = 5ul;
+
+/// Stand-in for a tiny data-driven test-case: just enough work to not be optimized away.
+std::size_t tiny_case(std::size_t const index)
+{
+    auto result = index;
+    for (auto i = 0; i < 16; ++i) {
+        result = result * 6364136223846793005ul + 1442695040888963407ul;
+    }
+    return result;
+}
+
+/// Measure the wall time of distributing (and "executing") all cases with @p num_workers threads.
+Clock::duration measure(Mode const mode, std::size_t const num_workers)
+{
+    auto const scheduler = ct::execute::make_scheduler(mode, ct::execute::registration_order(num_cases), num_workers);
+    auto sink = std::atomic<std::size_t>{0ul};
+    auto start = std::barrier{static_cast<std::ptrdiff_t>(num_workers + 1ul)};
+
+    auto workers = std::vector<std::jthread>{};
+    for (auto w = 0ul; w < num_workers; ++w) {
+        workers.emplace_back([&, w] {
+            auto local = std::size_t{0ul};
+            start.arrive_and_wait();
+            while (auto const next = scheduler->next(w)) {
+                local ^= tiny_case(*next);
+            }
+            sink.fetch_xor(local, std::memory_order_relaxed);
+        });
+    }
+
+    // Start timing before releasing the workers: a descheduled main thread mustn't hide their execution.
+    auto const time_start = Clock::now();
+    start.arrive_and_wait();
+    for (auto & w : workers) {
+        w.join();
+    }
+    return Clock::now() - time_start;
+}
+
+Clock::duration median(Mode const mode, std::size_t const num_workers)
+{
+    auto samples = std::vector<Clock::duration>{};
+    while (samples.size() < num_repetitions) {
+        samples.emplace_back(measure(mode, num_workers));
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+/// Render @p duration into a string (s.t. it can be aligned as a whole).
+std::string format(Clock::duration const duration)
+{
+    auto buffer = std::ostringstream{};
+    buffer << ct::utils::WithAdaptiveUnit{duration};
+    return std::move(buffer).str();
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    std::cout << "Distributing " << num_cases << " tiny cases (median of " << num_repetitions << " runs, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n"
+              << std::setw(8) << "workers" << std::setw(16) << "shared cursor" << std::setw(16) << "work stealing"
+              << '\n';
+    for (auto const num_workers : {1ul, 8ul, 32ul, 64ul}) {
+        auto const cursor = median(Mode::shared_cursor, num_workers);
+        auto const stealing = median(Mode::work_stealing, num_workers);
+        std::cout << std::setw(8) << num_workers << std::setw(16) << format(cursor) << std::setw(16)
+                  << format(stealing) << '\n';
+    }
+}
@@ -4,11 +4,15 @@
 #pragma once
 
 #include "execute/Configuration.h"
+#include "execute/Listener.h"
 #include "execute/Main.h"
+#include "execute/Runner.h"
 
 namespace clean_test {
 
 using Configuration = execute::Configuration;
+using Listener = execute::Listener;
+using Runner = execute::Runner;
 using execute::main;
 
 }
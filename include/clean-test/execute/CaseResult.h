@@ -0,0 +1,82 @@
+// Copyright (c) m8mble 2020.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "CaseStatus.h"
+#include "Observation.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Collection of observation details about executing a single test-case.
+class CaseResult {
+public:
+    using Clock = std::chrono::system_clock;
+    using Duration = std::chrono::nanoseconds;
+    using TimePoint = std::chrono::time_point<Clock, Duration>;
+    using Observations = std::vector<Observation>;
+
+    /// The result type indicates how contained results have been observed.
+    enum class Type : bool {
+        /// Used for standard observations in (correct) user-specified tests.
+        regular = false,
+        /// Used for catch-all observations of unknown test cases (e.g. when tests fail to propagate observers).
+        fallback = true,
+    };
+
+    /// Summary of all runs of a repeatedly executed test-case (c.f. @c Repetitions).
+    class Statistics {
+    public:
+        std::size_t m_num_runs; //!< number of runs (i.e. repetitions which haven't been skipped).
+        std::size_t m_num_failures; //!< number of runs which didn't pass.
+        Duration m_min; //!< shortest wall time of any run.
+        Duration m_median; //!< median wall time of all runs.
+        Duration m_max; //!< longest wall time of any run.
+    };
+
+    /// Summary of all attempts of a retried test-case (c.f. @c --retries).
+    class Attempts {
+    public:
+        std::size_t m_num_attempts; //!< number of executions (including the first one).
+        CaseStatus m_first; //!< status of the first execution (which didn't pass).
+    };
+
+    /// Detailed c'tor: initialize from @p name_path, @p wall_time and @p observations.
+    ///
+    /// Stores worst outcome of any @p observations and @p execution_outcome into @c m_status.
+    /// The @p execution_outcome is assumed to result from the test execution.
+    CaseResult(
+        std::string name_path,
+        CaseStatus execution_outcome,
+        Duration wall_time,
+        Observations observations,
+        Type type = Type::regular);
+
+    std::string m_name_path; //!< Name of the test-case.
+    CaseStatus m_status; //!< Overall outcome of the test-case.
+    Duration m_wall_time; //!< Total execution (wall) time.
+    Observations m_observations; //!< Observation details (including passed ones).
+    Type m_type; //!< Type of result (to detect catch-all observations).
+    std::string m_stdout = {}; //!< Captured standard output (only available with isolated execution).
+    std::string m_stderr = {}; //!< Captured standard error (only available with isolated execution).
+    std::optional<Statistics> m_statistics = {}; //!< Summary of all runs (only available for repeated test-cases).
+    std::optional<Attempts> m_attempts = {}; //!< Summary of all attempts (only available for retried test-cases).
+    bool m_quarantined = false; //!< Whether not passing is tolerated (c.f. @c --quarantine).
+    /// Number of the worker process which executed the test-case (only available with isolated execution).
+    std::optional<std::size_t> m_worker = {};
+};
+
+/// Whether @p result counts as successful: It passed (c.f. @c passed) or its failure is tolerated by a quarantine.
+inline bool tolerated(CaseResult const & result)
+{
+    return passed(result.m_status) or result.m_quarantined;
+}
+
+}
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 
 namespace clean_test::execute {
 
@@ -18,10 +19,12 @@ public:
         fail = 1, //!< Test failed (some) expectations.
         abort = 2, //!< Test aborted prematurely e.g. due to failed assertions.
         skip = 3, //!< Test not run at all (e.g. due to an appropriate runtime filter).
+        timeout = 4, //!< Test abandoned after exceeding its timeout.
+        cached = 5, //!< Test not run again, since it passed in a previous execution of the same build.
     };
 
     /// Total number of different outcomes.
-    constexpr static inline std::size_t num_values = 3ul;
+    constexpr static inline std::size_t num_values = 6ul;
 
     /// Detailed c'tor: Initialize from @p value.
     constexpr explicit(false) CaseStatus(Value const value) : m_value{value}
@@ -37,4 +40,21 @@ private:
     Value m_value;
 };
 
+/// Whether @p status is considered as successful (skipped test-cases didn't fail either).
+constexpr bool passed(CaseStatus const status)
+{
+    switch (status) {
+        case CaseStatus::pass:
+        case CaseStatus::skip:
+        case CaseStatus::cached:
+            return true;
+        case CaseStatus::fail:
+        case CaseStatus::abort:
+        case CaseStatus::timeout:
+            return false;
+        default:
+            std::terminate();
+    }
+}
+
 }
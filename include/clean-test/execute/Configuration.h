@@ -5,9 +5,16 @@
 
 #include "BufferingMode.h"
 #include "ColoringMode.h"
+#include "IsolationMode.h"
+#include "ListingFormat.h"
+#include "Listener.h"
 #include "NameFilterSetting.h"
 #include "OperationMode.h"
+#include "OrderingMode.h"
+#include "PinningMode.h"
+#include "TimeoutMode.h"
 
+#include <chrono>
 #include <filesystem>
 #include <vector>
 
@@ -50,14 +57,130 @@ public:
 
     /// Number of test-cases to be executed in parallel.
     ///
-    /// The special value 0 (default) instructs to utilize all available CPU cores.
+    /// The special value 0 (default) instructs to utilize all available CPU cores, i.e. those of the CPU affinity mask
+    /// (restricted by the CPU quota of the cgroup).
     std::size_t m_num_jobs = 0ul;
 
+    /// Whether the number of test-cases executed in parallel adapts to the measured CPU utilization.
+    ///
+    /// Workers are added while CPU cores are idle (e.g. for test-cases sleeping or waiting for I/O) and removed while
+    /// they are oversubscribed. Only supported for in-process execution.
+    bool m_adaptive_jobs = false;
+
+    /// Whether test-cases should be executed in separate worker processes (such that crashes can be survived).
+    IsolationMode m_isolation = IsolationMode::off;
+
+    /// Whether every worker should be bound to a distinct CPU core (e.g. for reproducible timings).
+    PinningMode m_pinning = PinningMode::off;
+
+    /// Whether workers beyond the first one acquire tokens from the GNU make jobserver advertised in @c MAKEFLAGS.
+    ///
+    /// This bounds the overall parallelism of nested test executions (e.g. by `make -j64`) by that of the build.
+    bool m_jobserver = false;
+
+    /// Default timeout of every test-case; can be overridden per test-case by tagging it "timeout:SECONDS".
+    ///
+    /// The special value 0 (default) disables the timeout.
+    std::chrono::seconds m_timeout = std::chrono::seconds{0};
+
+    /// How execution continues after a test-case exceeded its timeout.
+    TimeoutMode m_on_timeout = TimeoutMode::proceed;
+
+    /// Number of failing test-cases after which execution is cancelled (all unstarted test-cases are skipped).
+    ///
+    /// The special value 0 (default) never cancels execution.
+    std::size_t m_max_failures = 0ul;
+
+    /// Number of (logical) copies of every test-case which are executed concurrently (e.g. for finding flaky ones).
+    ///
+    /// The results of all copies of a test-case are combined into a single one (including statistics about all runs).
+    std::size_t m_repetitions = 1ul;
+
+    /// Whether execution of (repeated) test-cases is cancelled on the first failing run (requires @c m_repetitions).
+    bool m_until_fail = false;
+
+    /// Maximum number of times failed (or aborted) test-cases are executed again; only their final attempt counts.
+    ///
+    /// Retries are handed to the next idle worker right away. The special value 0 (default) disables retries.
+    std::size_t m_retries = 0ul;
+
+    /// Path of a file listing the test-cases (one name path per line) whose failures are tolerated.
+    ///
+    /// Quarantined test-cases are executed (and reported) as usual, but don't fail the execution. The special value of
+    /// @c {} (empty, default) disables the quarantine.
+    std::filesystem::path m_quarantine_path = {};
+
+    /// Restrict execution to the (zero-based) shard with this index out of @c m_num_shards.
+    ///
+    /// Shards are balanced by the durations recorded in the history (c.f. @c m_history_path) if available.
+    std::size_t m_shard_index = 0ul;
+
+    /// Number of shards (e.g. machines) the test-cases are distributed onto; 1 (default) executes all test-cases.
+    std::size_t m_num_shards = 1ul;
+
     /// Path for generating the JUnit-XML summary into.
     ///
     /// The special value of @c {} (empty, default) disables the generation of this type of report.
     std::filesystem::path m_junit_path = {};
 
+    /// Path for recording test-case durations (and failures) into; these are used to execute the longest test-cases
+    /// first.
+    ///
+    /// The special value of @c {} (empty, default) disables recording (and thus execution in registration order).
+    std::filesystem::path m_history_path = {};
+
+    /// Order in which test-cases are started, based on the history (requires @c m_history_path for @c risk).
+    OrderingMode m_ordering = OrderingMode::duration;
+
+    /// Path for recording the names of all test-cases which didn't pass into.
+    ///
+    /// The special value of @c {} (empty, default) disables recording.
+    std::filesystem::path m_failures_path = {};
+
+    /// Whether only the test-cases recorded in @c m_failures_path should be executed (mandatory for this mode).
+    bool m_rerun_failed = false;
+
+    /// Path for caching passed test-cases of this build; these aren't executed again by subsequent runs of this build.
+    ///
+    /// Test-cases tagged "nondeterministic" or "side-effects" are never cached. The special value of @c {} (empty,
+    /// default) disables caching.
+    std::filesystem::path m_cache_path = {};
+
+    /// Path for journaling the progress of the execution into, s.t. it can be resumed after being interrupted.
+    ///
+    /// The special value of @c {} (empty, default) disables journaling.
+    std::filesystem::path m_journal_path = {};
+
+    /// Whether to resume the execution recorded in @c m_journal_path (mandatory for this mode): Completed test-cases
+    /// aren't executed again and those which were running when it got interrupted are reported as aborted.
+    bool m_resume = false;
+
+    /// Test-case failing only after others (e.g. due to shared static state), mandatory for @c OperationMode::bisect:
+    /// The polluting test-cases are narrowed down among those executed before it, as recorded in @c m_journal_path.
+    std::string m_pollution_victim = {};
+
+    /// Address ("unix:PATH" or "tcp:HOST:PORT") where workers connect to for executing the test-cases, which are
+    /// distributed onto them (rather than executed by this process) and reported as a single execution.
+    ///
+    /// The special value of @c {} (empty, default) executes test-cases locally.
+    std::string m_coordination = {};
+
+    /// Address of the coordinator handing out test-cases, mandatory for @c OperationMode::work.
+    std::string m_coordinator = {};
+
+    /// Observers of all execution events, e.g. custom reporters (not owned; can't be set from the commandline).
+    ///
+    /// Events refer to the results while they are being produced (without copying them). See @c Listener for the
+    /// threads every callback is invoked on.
+    std::vector<Listener *> m_listeners = {};
+
+    /// Test binaries (built with Clean Test) whose test-cases are executed together, rather than those of this process
+    /// (can't be set from the commandline; c.f. @c orchestrate).
+    ///
+    /// Their test-cases are named by the file name of their binary followed by their own name path. All of them are
+    /// executed by one pool of worker processes (of the respective binary) and reported as a single execution.
+    std::vector<std::filesystem::path> m_binaries = {};
+
     /// @}
 
     /// @name Test Listing Configuration
@@ -67,6 +190,9 @@ public:
     /// Maximum depth of the visualized tree of test-cases.
     std::size_t m_depth = 3ul;
 
+    /// Representation of the listed test-cases, e.g. @c ListingFormat::names for processing them by other tools.
+    ListingFormat m_listing = ListingFormat::tree;
+
     /// @}
 };
 
@@ -0,0 +1,19 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// How strongly the execution of test-cases is isolated from each other.
+enum class IsolationMode {
+    /// All test-cases are executed by threads of the current process. A crashing test-case terminates all testing.
+    off,
+    /// Test-cases are executed by a pool of (pre-forked) worker processes.
+    ///
+    /// A crashing test-case only takes down its worker process: it is reported as aborted and the worker replaced.
+    /// Output of the test-cases to the standard streams is captured and attached to their results.
+    process,
+};
+
+}
@@ -0,0 +1,57 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "CaseResult.h"
+#include "CaseStatus.h"
+#include "Observation.h"
+
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Observer of test execution events, e.g. for custom reporters.
+///
+/// Events refer to data owned by the execution (nothing is copied for them): Names, observations and results are only
+/// valid during the respective callback. All callbacks do nothing by default.
+///
+/// Threading contract:
+///  - @c on_case_start and @c on_case_stop are called on the worker thread executing the test-case; @c on_observation
+///    on the thread conducting the observation (e.g. workers assisting with @c parallel_for). These are thus called
+///    concurrently (for different test-cases) and must synchronize on their own. With isolated execution, they are
+///    replayed (on a single thread) once the worker process returned the result of the test-case.
+///  - @c on_result is called on a dedicated sink thread, sequentially for all results (in order of completion).
+///  - @c on_run_end is called once after all results, on the thread which started the execution.
+class Listener {
+public:
+    using Duration = CaseResult::Duration;
+
+    virtual ~Listener() = default;
+
+    /// Test-case with path @p name is starting.
+    virtual void on_case_start([[maybe_unused]] std::string_view name)
+    {}
+
+    /// Test-case with path @p name conducted @p observation.
+    virtual void on_observation(
+        [[maybe_unused]] std::string_view name, [[maybe_unused]] Observation const & observation)
+    {}
+
+    /// Test-case with path @p name stopped with @p status after @p wall_time.
+    virtual void on_case_stop(
+        [[maybe_unused]] std::string_view name,
+        [[maybe_unused]] CaseStatus status,
+        [[maybe_unused]] Duration wall_time)
+    {}
+
+    /// Final @p result of a test-case (including skipped and combined repeated ones).
+    virtual void on_result([[maybe_unused]] CaseResult const & result)
+    {}
+
+    /// All results of an execution with total @p wall_time have been delivered.
+    virtual void on_run_end([[maybe_unused]] Duration wall_time)
+    {}
+};
+
+}
@@ -0,0 +1,16 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// Representation of the test-cases listed by @c OperationMode::list.
+enum class ListingFormat {
+    /// Human-readable tree of the name paths (up to the configured depth).
+    tree,
+    /// Machine-readable: One test-case per line, its name path followed by its tags (all separated by tabs).
+    names,
+};
+
+}
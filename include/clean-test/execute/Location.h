@@ -0,0 +1,42 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <clean-test/utils/SourceLocation.h>
+
+#include <cstdint>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Position in the source code, e.g. where an @c Observation was conducted.
+///
+/// Other than a @c utils::SourceLocation, a @c Location can also be restored from its file name and line (e.g. when
+/// receiving it from another process). File names are interned s.t. a @c Location remains cheap to copy.
+class Location {
+public:
+    /// Conversion c'tor: refer to the (statically allocated) file name of @p where.
+    explicit(false) Location(utils::SourceLocation const & where) noexcept :
+        m_file_name{where.file_name()}, m_line{where.line()}
+    {}
+
+    /// Restoring c'tor: intern @p file_name (if necessary) and remember @p line.
+    Location(std::string_view file_name, std::uint_least32_t line);
+
+    [[nodiscard]] char const * file_name() const noexcept
+    {
+        return m_file_name;
+    }
+
+    [[nodiscard]] std::uint_least32_t line() const noexcept
+    {
+        return m_line;
+    }
+
+private:
+    char const * m_file_name; //!< null-terminated file name with static storage duration.
+    std::uint_least32_t m_line;
+};
+
+}
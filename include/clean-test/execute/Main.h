@@ -12,6 +12,12 @@ class Configuration;
 /// Honors various commandline parameters as specified via @p argc and @p argv.
 int main(int argc, char ** argv);
 
+/// Execution frontend for the test-cases of multiple test binaries (c.f. @c Configuration::m_binaries).
+///
+/// Honors the commandline parameters specified via @p argc and @p argv up to "--"; all parameters after it are the
+/// test binaries.
+int orchestrate(int argc, char ** argv);
+
 /// Execute framework as specified by @p configuration.
 int main(Configuration const & configuration);
 
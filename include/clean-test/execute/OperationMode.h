@@ -10,6 +10,8 @@ enum class OperationMode {
     help, //!< only show explanatory help message
     list, //!< visualize available test-cases (as a tree)
     run, //!< execute test-cases and report results
+    bisect, //!< narrow down test-cases polluting a failing one (by replaying those executed before it)
+    work, //!< execute test-cases handed out by a coordinator (of a distributed execution)
 };
 
 }
@@ -0,0 +1,17 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// Order in which test-cases are started (as far as known from the history of previous executions).
+enum class OrderingMode {
+    /// Longest test-cases first, minimizing the total wall time; in registration order without any history.
+    duration,
+    /// Recently failing test-cases first, followed by recently added ones, minimizing the time until the first failure
+    /// is reported; the remaining test-cases are started as for @c duration.
+    risk,
+};
+
+}
@@ -0,0 +1,16 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// Whether workers are bound to specific CPU cores (e.g. for reproducible timings of CPU-heavy test-cases).
+enum class PinningMode {
+    /// Workers may run on any CPU available to the process (as chosen by the operating system).
+    off,
+    /// Every worker is bound to a distinct CPU: spread across NUMA nodes and physical cores (before their siblings).
+    cores,
+};
+
+}
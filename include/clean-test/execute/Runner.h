@@ -0,0 +1,51 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "CaseResult.h"
+#include "NameFilterSetting.h"
+
+#include <memory>
+#include <vector>
+
+namespace clean_test::execute {
+
+class Configuration;
+
+/// Embeddable test-case execution, e.g. for running selections of test-cases repeatedly within a long-running process.
+///
+/// Unlike @c main, invocations don't consume the registry: Every one executes (a snapshot of) all test-cases registered
+/// so far. All invocations share the same worker threads, which are thus only started once (unless workers are pinned
+/// or isolated in processes).
+class Runner {
+public:
+    using Results = std::vector<CaseResult>;
+
+    /// Detailed c'tor: Execute as specified by @p configuration, but with the filter of every invocation.
+    ///
+    /// Honors the reporting (onto its logger) and execution options as well as the quarantine and listeners. Options
+    /// recording files across invocations (i.e. history, cache, journal, failures and reports) and sharding are
+    /// ignored.
+    explicit Runner(Configuration const & configuration);
+
+    ~Runner();
+
+    /// Invoke all registered test-cases selected by @p filter (all of them if empty); returns their results.
+    ///
+    /// Invocations must not overlap (e.g. from different threads).
+    Results run(std::vector<NameFilterSetting> const & filter);
+
+    // non-copyable and non-movable
+    Runner(Runner &&) = delete;
+    Runner & operator=(Runner &&) = delete;
+    Runner(Runner const &) = delete;
+    Runner & operator=(Runner const &) = delete;
+
+private:
+    class State;
+
+    std::unique_ptr<State> m_state; //!< details of the execution (hidden from users).
+};
+
+}
@@ -0,0 +1,16 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// How test execution continues after a test-case exceeded its timeout.
+enum class TimeoutMode {
+    /// The timed-out test-case is abandoned; the remaining test-cases are executed by a replacement worker.
+    proceed,
+    /// No further test-cases are started; the run finishes once all other workers completed their current test-case.
+    terminate,
+};
+
+}
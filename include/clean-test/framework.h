@@ -3,20 +3,30 @@
 
 #pragma once
 
+#include "framework/Cancellation.h"
 #include "framework/CaseRegistrar.h"
 #include "framework/Expect.h"
 #include "framework/ObserverFwd.h"
+#include "framework/Parallel.h"
 #include "framework/SuiteRegistrar.h"
+#include "framework/Task.h"
 #include "framework/Tag.h"
 
 namespace clean_test {
 
+using framework::cancellation_requested;
 using framework::expect;
+using framework::parallel_for;
+using framework::readable;
+using framework::sleep_for;
+using framework::sleep_until;
+using framework::writable;
 
 using Observer = execute::Observer;
 using Suite = framework::SuiteRegistrar;
 using Tag = framework::Tag;
 using ObservationSetup = framework::ObservationSetup;
+using Task = framework::Task;
 
 // No clang release so far supports CTAD for template aliases. We include a workaround.
 // MSVC seems to struggle with it too.
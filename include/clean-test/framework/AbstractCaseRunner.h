@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ObserverFwd.h"
+#include "Task.h"
 
 namespace clean_test {
 
@@ -12,15 +13,31 @@ class AbstractCaseRunner {
 public:
     virtual ~AbstractCaseRunner() = default;
 
-    /// Invoke runner with given @p observer.
+    /// Invoke runner with given @p observer (until it finished).
     void run(execute::Observer & observer)
     {
         return run_impl(observer);
     }
 
+    /// Whether the runner is a coroutine (i.e. returns a @c framework::Task).
+    [[nodiscard]] bool is_coroutine() const noexcept
+    {
+        return is_coroutine_impl();
+    }
+
+    /// Create the (not yet started) task of a coroutine runner with given @p observer.
+    [[nodiscard]] framework::Task start(execute::Observer & observer)
+    {
+        return start_impl(observer);
+    }
+
 private:
     /// implementation helper for the template method design idiom.
     virtual void run_impl(execute::Observer & observer) = 0;
+    /// implementation helper for the template method design idiom.
+    virtual bool is_coroutine_impl() const noexcept = 0;
+    /// implementation helper for the template method design idiom.
+    virtual framework::Task start_impl(execute::Observer & observer) = 0;
 };
 
 }
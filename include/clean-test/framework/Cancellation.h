@@ -0,0 +1,14 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::framework {
+
+/// Whether the current test execution has been cancelled (e.g. after too many failures with @c --fail-fast).
+///
+/// No further test-cases are started after a cancellation. Long running test-cases may poll this flag in order to
+/// finish early (cooperatively); their result is reported as usual nonetheless.
+[[nodiscard]] bool cancellation_requested() noexcept;
+
+}
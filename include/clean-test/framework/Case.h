@@ -14,9 +14,10 @@ namespace clean_test::framework {
 /// Internal wrapper comprising all relevant details for a test-case
 ///
 /// This includes static details (e.g. the actual underlying test-runner) and dynamic results computed at runtime.
+/// Copies share their runner (e.g. for executing a snapshot of the registry without consuming it).
 class Case {
 public:
-    using Runner = std::unique_ptr<AbstractCaseRunner>;
+    using Runner = std::shared_ptr<AbstractCaseRunner>;
 
     Case(Name name, Runner runner) noexcept : m_name{std::move(name)}, m_runner{std::move(runner)}
     {}
@@ -26,11 +27,24 @@ public:
         return m_name;
     }
 
+    /// Execute the test-case reporting to @p observer.
+    ///
+    /// Test-cases may be run repeatedly, even concurrently (c.f. repetitions); their runners must thus not be consumed.
     void run(execute::Observer& observer)
     {
         m_runner->run(observer);
-        // make sure the runner is only ever used once.
-        m_runner.reset();
+    }
+
+    /// Whether the test-case is a coroutine (which can be interleaved with others, c.f. @c Task).
+    bool is_coroutine() const noexcept
+    {
+        return m_runner->is_coroutine();
+    }
+
+    /// Create the (not yet started) task of a coroutine test-case reporting to @p observer.
+    Task start(execute::Observer & observer)
+    {
+        return m_runner->start(observer);
     }
 
 private:
@@ -18,8 +18,12 @@
 #include <clean-test/utils/ScopeGuard.h>
 
 #include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <memory>
 #include <ranges>
 #include <sstream>
+#include <stdexcept>
 #include <string_view>
 #include <type_traits>
 
@@ -56,19 +60,31 @@ constexpr /*CaseRunner<Data...>*/ auto load_runner(Runner && runner)
 {
     return [fwd = utils::fwd_capture(std::forward<Runner>(runner))]<typename... Sample>(
                 execute::Observer & observe,
-                Sample &&... sample) mutable
+                Sample &&... sample) mutable -> decltype(auto)
         requires(sizeof...(Sample) == sizeof...(Data))
     {
+        // Note: Coroutines only start running later on (when their observer is setup by the event loop).
         auto const setup = framework::ObservationSetup{observe};
         auto & [run] = fwd;
         if constexpr (CaseRunner<Runner, Data...>) {
-            run(observe, std::forward<decltype(sample)>(sample)...);
+            return run(observe, std::forward<decltype(sample)>(sample)...);
         } else {
-            run(std::forward<decltype(sample)>(sample)...);
+            return run(std::forward<decltype(sample)>(sample)...);
         }
     };
 }
 
+/// Flag for detecting repeated runs of test-cases with (move-only) rvalue @tparam Sample (nothing for other samples).
+template <typename Sample>
+auto make_consumption_flag()
+{
+    if constexpr (std::is_lvalue_reference_v<Sample> or std::copy_constructible<std::remove_cvref_t<Sample>>) {
+        return nullptr;
+    } else {
+        return std::make_shared<std::atomic_flag>();
+    }
+}
+
 constexpr auto make_name_generator()
 {
     return [n = std::size_t{}]<typename Sample>(Sample const & sample) mutable {
@@ -229,11 +245,24 @@ CaseRegistrar<Data> const & CaseRegistrar<Data>::operator=(Runner && runner) con
             };
             // Note: we need to build the registrar (including the name) before forwarding the sample into the runner.
             auto name = name_generator(sample);
+            auto consumed = case_registrar_details::make_consumption_flag<Sample>();
             CaseRegistrar<>{std::move(name)} = [fwd = utils::fwd_capture(std::forward<Sample>(sample)),
                                                 shared_runner,
-                                                data = capture_data()](execute::Observer & observer) mutable {
+                                                data = capture_data(),
+                                                consumed](execute::Observer & observer) mutable -> decltype(auto) {
                 auto & [s] = fwd;
-                shared_runner->get()(observer, std::forward<Sample>(s));
+                using Value = std::remove_cvref_t<Sample>;
+                if constexpr (std::is_lvalue_reference_v<Sample>) {
+                    return shared_runner->get()(observer, s);
+                } else if constexpr (std::copy_constructible<Value>) {
+                    // Hand a fresh copy of rvalue samples to every run (s.t. the test-case can be repeated).
+                    return shared_runner->get()(observer, Value{s});
+                } else {
+                    if (consumed->test_and_set()) {
+                        throw std::logic_error{"Move-only data sample has already been consumed by a previous run."};
+                    }
+                    return shared_runner->get()(observer, std::move(s));
+                }
             };
         };
 
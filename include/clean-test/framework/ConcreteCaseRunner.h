@@ -5,8 +5,10 @@
 
 #include "AbstractCaseRunner.h"
 #include "ObserverFwd.h"
+#include "Task.h"
 
 #include <concepts>
+#include <type_traits>
 #include <utility>
 
 namespace clean_test::framework {
@@ -22,10 +24,32 @@ public:
     {}
 
 private:
-    /// Invoke by passing @p observer to the stored @tparam F @c m_func.
+    static constexpr bool returns_task = std::same_as<std::invoke_result_t<F &, execute::Observer &>, framework::Task>;
+
+    /// Invoke by passing @p observer to the stored @tparam F @c m_func (waiting for its task to finish, if any).
     void run_impl(execute::Observer & observer) final
     {
-        m_func(observer);
+        if constexpr (returns_task) {
+            framework::sync_wait(m_func(observer), observer);
+        } else {
+            m_func(observer);
+        }
+    }
+
+    bool is_coroutine_impl() const noexcept final
+    {
+        return returns_task;
+    }
+
+    /// Create task by passing @p observer to the stored @tparam F @c m_func; regular functions are run immediately.
+    framework::Task start_impl(execute::Observer & observer) final
+    {
+        if constexpr (returns_task) {
+            return m_func(observer);
+        } else {
+            m_func(observer);
+            return {};
+        }
     }
 
     F m_func;
@@ -15,8 +15,8 @@ namespace clean_test::framework {
 ///
 /// The setup is thread-local, which is sufficient for single-threaded test-cases. In case multiple user threads
 /// participate in the execution of a single test-case, it is the client's responsibility to make the observer available
-/// to its threads. If the user fails to do so, we use the @c FallbackObservationSetup (still registers observation,
-/// but not attributed to the correct test-case).
+/// to its threads (unless using @c parallel_for). If the user fails to do so, we use the @c FallbackObservationSetup
+/// (still registers observation, but not attributed to the correct test-case).
 class ObservationSetup {
 public:
     using Observer = execute::Observer;
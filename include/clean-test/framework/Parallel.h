@@ -0,0 +1,22 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace clean_test::framework {
+
+/// Invoke @p body for every index in [@p begin, @p end) in parallel; returns once all invocations finished.
+///
+/// Indices are processed in chunks by the calling thread as well as by idle workers of the current execution. Thus the
+/// total number of threads stays bounded by the number of configured jobs (in contrast to spawning custom threads).
+/// Every participating thread observes expectations for the calling test-case (c.f. @c ObservationSetup).
+///
+/// Without idle workers (e.g. in isolated worker processes or if timeouts are configured), all indices are processed
+/// sequentially by the calling thread. The first exception thrown by @p body is rethrown (after all chunks finished);
+/// unstarted chunks are skipped then.
+void parallel_for(std::size_t begin, std::size_t end, std::function<void(std::size_t)> const & body);
+
+}
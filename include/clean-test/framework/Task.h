@@ -0,0 +1,223 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "ObserverFwd.h"
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace clean_test::framework {
+
+/// Coroutine type for test-cases (and their helpers) which wait on timers or file descriptors.
+///
+/// Test-cases returning a @c Task don't block their worker while being suspended: Every worker interleaves many of
+/// them on its event loop. Expectations are attributed to the correct test-case across all suspension points. A task
+/// only runs once it is awaited (or started by the framework); awaiting it rethrows any exception it finished with.
+///
+/// @note Coroutine test-cases should take their data samples by value: references are only valid until the first
+///       suspension point.
+class Task {
+public:
+    class promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /// Resumes the awaiting coroutine (if any) once the task finished.
+    class FinalAwaiter {
+    public:
+        constexpr bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(Handle handle) const noexcept;
+
+        constexpr void await_resume() const noexcept
+        {}
+    };
+
+    class promise_type {
+    public:
+        Task get_return_object() noexcept
+        {
+            return Task{Handle::from_promise(*this)};
+        }
+
+        constexpr std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        constexpr FinalAwaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        constexpr void return_void() const noexcept
+        {}
+
+        void unhandled_exception() noexcept
+        {
+            m_exception = std::current_exception();
+        }
+
+        std::coroutine_handle<> m_continuation = {}; //!< coroutine awaiting this task (if any).
+        std::exception_ptr m_exception = {}; //!< exception this task finished with (if any).
+    };
+
+    /// Default c'tor: Empty task (which is already done).
+    Task() noexcept = default;
+
+    Task(Task && other) noexcept : m_handle{std::exchange(other.m_handle, {})}
+    {}
+
+    Task & operator=(Task && other) noexcept
+    {
+        Task{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    void swap(Task & other) noexcept
+    {
+        std::swap(m_handle, other.m_handle);
+    }
+
+    /// Whether this task finished (or is empty).
+    [[nodiscard]] bool done() const noexcept
+    {
+        return not m_handle or m_handle.done();
+    }
+
+    /// Access the underlying coroutine (e.g. for starting it).
+    [[nodiscard]] Handle handle() const noexcept
+    {
+        return m_handle;
+    }
+
+    /// Rethrow the exception this (finished) task failed with (if any).
+    void result() const
+    {
+        if (m_handle and m_handle.promise().m_exception) {
+            std::rethrow_exception(m_handle.promise().m_exception);
+        }
+    }
+
+    bool await_ready() const noexcept
+    {
+        return done();
+    }
+
+    /// Start this task; the @p continuation is resumed once it finished.
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> const continuation) const noexcept
+    {
+        m_handle.promise().m_continuation = continuation;
+        return m_handle;
+    }
+
+    void await_resume() const
+    {
+        result();
+    }
+
+    // non-copyable
+    Task(Task const &) = delete;
+    Task & operator=(Task const &) = delete;
+
+private:
+    explicit Task(Handle const handle) noexcept : m_handle{handle}
+    {}
+
+    Handle m_handle = {};
+};
+
+/// Awaitable suspending the calling coroutine test-case until a @c deadline has been reached.
+class TimerAwaiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    constexpr explicit TimerAwaiter(Clock::time_point const deadline) noexcept : m_deadline{deadline}
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return m_deadline <= Clock::now();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    constexpr void await_resume() const noexcept
+    {}
+
+private:
+    Clock::time_point m_deadline;
+};
+
+/// Awaitable suspending the calling coroutine test-case until a file descriptor is ready for reading or writing.
+class FileAwaiter {
+public:
+    /// Readiness of the file descriptor to wait for.
+    enum class Event : bool {
+        readable = false,
+        writable = true,
+    };
+
+    constexpr FileAwaiter(int const file_descriptor, Event const event) noexcept :
+        m_file_descriptor{file_descriptor}, m_event{event}
+    {}
+
+    constexpr bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    constexpr void await_resume() const noexcept
+    {}
+
+private:
+    int m_file_descriptor;
+    Event m_event;
+};
+
+/// Suspend the calling coroutine test-case (without blocking its worker) until @p deadline.
+[[nodiscard]] inline TimerAwaiter sleep_until(TimerAwaiter::Clock::time_point const deadline) noexcept
+{
+    return TimerAwaiter{deadline};
+}
+
+/// Suspend the calling coroutine test-case (without blocking its worker) for @p duration.
+template <typename Rep, typename Period>
+[[nodiscard]] TimerAwaiter sleep_for(std::chrono::duration<Rep, Period> const duration) noexcept
+{
+    return sleep_until(TimerAwaiter::Clock::now() + std::chrono::ceil<TimerAwaiter::Clock::duration>(duration));
+}
+
+/// Suspend the calling coroutine test-case (without blocking its worker) until @p file_descriptor is readable.
+[[nodiscard]] constexpr FileAwaiter readable(int const file_descriptor) noexcept
+{
+    return FileAwaiter{file_descriptor, FileAwaiter::Event::readable};
+}
+
+/// Suspend the calling coroutine test-case (without blocking its worker) until @p file_descriptor is writable.
+[[nodiscard]] constexpr FileAwaiter writable(int const file_descriptor) noexcept
+{
+    return FileAwaiter{file_descriptor, FileAwaiter::Event::writable};
+}
+
+/// Run @p task of a test-case observed by @p observer to completion (blocking the calling thread).
+///
+/// Uses a dedicated event loop, e.g. for workers which can't interleave test-cases. Rethrows any exception of @p task.
+void sync_wait(Task task, execute::Observer & observer);
+
+}
@@ -0,0 +1,9 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "execute/Main.h"
+
+int main(int const argc, char ** const argv)
+{
+    return clean_test::execute::orchestrate(argc, argv);
+}
@@ -18,6 +18,11 @@ constexpr auto badges = std::array{
     "[ PASS  ]"sv,
     "[ FAIL  ]"sv,
     "[ ABORT ]"sv,
+    "[ TIME  ]"sv,
+    "[ CACHE ]"sv,
+    "[ REPT  ]"sv,
+    "[ RETRY ]"sv,
+    "[ QUAR  ]"sv,
 };
 
 }
@@ -19,6 +19,11 @@ enum class BadgeType {
     pass,
     fail,
     abort,
+    timeout,
+    cached,
+    repeat,
+    retry,
+    quarantine,
 };
 
 /// Access / generato badge for given @p type.
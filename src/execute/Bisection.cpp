@@ -0,0 +1,229 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Bisection.h"
+
+#include "CaseEvaluator.h"
+#include "ColoringSetup.h"
+
+#if __has_include(<sys/wait.h>) and __has_include(<fcntl.h>) and __has_include(<unistd.h>)
+# define CLEANTEST_HAS_FORKED_TRIALS 1
+# include <fcntl.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_FORKED_TRIALS 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+using Trial = Bisection::Trial;
+
+/// Union of the (ascending) candidates of @p a and @p b (again ascending).
+Trial merged(Trial const & a, Trial const & b)
+{
+    auto result = Trial{};
+    result.reserve(a.size() + b.size());
+    std::set_union(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(result));
+    return result;
+}
+
+/// Search for the culprits among candidates, counting all rounds of trials (c.f. @c bisect).
+class Narrowing {
+public:
+    Narrowing(std::size_t const num_parallel, Bisection::Reproduce const & reproduce, Bisection & bisection) :
+        m_num_parallel{std::max(num_parallel, 2ul)}, m_reproduce{reproduce}, m_bisection{bisection}
+    {}
+
+    /// Execute all @p trials as one round.
+    std::vector<bool> round(std::vector<Trial> const & trials)
+    {
+        ++m_bisection.m_num_rounds;
+        m_bisection.m_num_trials += trials.size();
+        return m_reproduce(trials);
+    }
+
+    /// Minimal subset of @p candidates s.t. the victim fails after it together with all @p required ones (given that
+    /// it fails after all @p candidates and @p required ones).
+    Trial operator()(Trial const & candidates, Trial const & required)
+    {
+        if (candidates.empty()) {
+            return {};
+        }
+        if (candidates.size() == 1ul) {
+            // The victim passes on its own: Only the other required ones might reproduce the failure without it.
+            if (required.empty() or not round({required})[0]) {
+                return candidates;
+            }
+            return {};
+        }
+
+        // Contiguous chunks of (almost) equal size: Any which reproduces the failure on its own contains the culprits.
+        auto const num_chunks = std::min(m_num_parallel, candidates.size());
+        auto chunks = std::vector<Trial>{};
+        auto trials = std::vector<Trial>{};
+        auto const boundary = [&candidates, num_chunks](std::size_t const c) {
+            return candidates.cbegin() + static_cast<std::ptrdiff_t>(c * candidates.size() / num_chunks);
+        };
+        for (auto c = 0ul; c < num_chunks; ++c) {
+            trials.emplace_back(merged(chunks.emplace_back(boundary(c), boundary(c + 1ul)), required));
+        }
+        auto const failed = round(trials);
+        for (auto c = 0ul; c < num_chunks; ++c) {
+            if (failed[c]) {
+                return (*this)(chunks[c], required);
+            }
+        }
+
+        // Culprits are spread over several chunks: Unless they are all within one half (already covered by the chunks
+        // if there are only two), narrow down either half while keeping the other one (resp. its culprits) in place.
+        auto const half = candidates.cbegin() + static_cast<std::ptrdiff_t>(candidates.size() / 2ul);
+        auto const first = Trial(candidates.cbegin(), half);
+        auto const second = Trial(half, candidates.cend());
+        if (num_chunks > 2ul) {
+            auto const halves = round({merged(first, required), merged(second, required)});
+            if (halves[0]) {
+                return (*this)(first, required);
+            }
+            if (halves[1]) {
+                return (*this)(second, required);
+            }
+        }
+        auto const first_culprits = (*this)(first, merged(required, second));
+        return merged(first_culprits, (*this)(second, merged(required, first_culprits)));
+    }
+
+private:
+    std::size_t const m_num_parallel;
+    Bisection::Reproduce const & m_reproduce;
+    Bisection & m_bisection; //!< for counting the rounds and trials.
+};
+
+#if CLEANTEST_HAS_FORKED_TRIALS
+
+/// Execute @p trial (selecting from @p candidates of @p cases) before @p victim in the current (forked) process; its
+/// exit status reflects whether the @p victim passed.
+[[noreturn]] void execute_trial(
+    framework::Registry & cases, std::vector<std::size_t> const & candidates, Trial const & trial, std::size_t victim)
+{
+    try {
+        // Output of the test-cases is irrelevant (and mustn't interleave with that of concurrent trials).
+        if (auto const null = ::open("/dev/null", O_WRONLY); null >= 0) {
+            ::dup2(null, STDOUT_FILENO);
+            ::dup2(null, STDERR_FILENO);
+        }
+        auto discarded = std::ostream{nullptr};
+        auto const & colors = coloring_setup(ColoringMode::disabled);
+        auto evaluator
+            = CaseEvaluator{{.m_output = discarded, .m_colors = colors, .m_buffering = BufferingMode::off}, true};
+        for (auto const candidate : trial) {
+            static_cast<void>(evaluator(cases[candidates[candidate]]));
+        }
+        auto const result = evaluator(cases[victim]);
+        ::_exit(passed(result.m_status) ? EXIT_SUCCESS : EXIT_FAILURE);
+    } catch (...) {
+        ::_exit(EXIT_FAILURE);
+    }
+}
+
+/// Execute @p trials in concurrent processes (at most @p num_parallel at once); whether the @p victim failed in each.
+std::vector<bool> execute_trials(
+    framework::Registry & cases,
+    std::vector<std::size_t> const & candidates,
+    std::size_t const victim,
+    std::size_t const num_parallel,
+    std::vector<Trial> const & trials)
+{
+    auto failed = std::vector<bool>(trials.size(), false);
+    auto running = std::vector<std::pair<::pid_t, std::size_t>>{}; // process and index of its trial
+    auto next = 0ul;
+    while (next < trials.size() or not running.empty()) {
+        while (next < trials.size() and running.size() < std::max(num_parallel, 1ul)) {
+            std::cout.flush();
+            std::fflush(nullptr); // avoid duplicating pending output
+            auto const pid = ::fork();
+            if (pid == 0) {
+                execute_trial(cases, candidates, trials[next], victim);
+            }
+            if (pid < 0) {
+                throw std::runtime_error{"Failed to fork process for bisection trial."};
+            }
+            running.emplace_back(pid, next++);
+        }
+
+        auto status = 0;
+        auto const pid = ::waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error{"Failed to await process of bisection trial."};
+        }
+        auto const pos = std::find_if(running.cbegin(), running.cend(), [pid](auto const & r) {
+            return r.first == pid;
+        });
+        if (pos != running.cend()) {
+            failed[pos->second] = not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS;
+            running.erase(pos);
+        }
+    }
+    return failed;
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Bisection bisect(
+    std::size_t const num_candidates, std::size_t const num_parallel, Bisection::Reproduce const & reproduce)
+{
+    auto result = Bisection{Bisection::Verdict::unreproducible};
+    auto narrowing = Narrowing{num_parallel, reproduce, result};
+
+    // Confirm the pollution first: The victim must pass on its own, but fail after all candidates.
+    auto all = Trial(num_candidates);
+    std::iota(all.begin(), all.end(), 0ul);
+    auto const confirmed = narrowing.round({Trial{}, all});
+    if (confirmed[0]) {
+        result.m_verdict = Bisection::Verdict::self_failing;
+    } else if (confirmed[1]) {
+        result.m_verdict = Bisection::Verdict::polluted;
+        result.m_culprits = narrowing(all, {});
+    }
+    return result;
+}
+
+Bisection::Reproduce forked_trials(
+    framework::Registry & cases,
+    std::vector<std::size_t> candidates,
+    std::size_t const victim,
+    std::size_t const num_parallel)
+{
+#if CLEANTEST_HAS_FORKED_TRIALS
+    return [&cases, candidates = std::move(candidates), victim, num_parallel](std::vector<Trial> const & trials) {
+        return execute_trials(cases, candidates, victim, num_parallel, trials);
+    };
+#else
+    static_cast<void>(cases);
+    static_cast<void>(candidates);
+    static_cast<void>(victim);
+    static_cast<void>(num_parallel);
+    std::terminate(); // guarded by supports_isolation()
+#endif
+}
+
+}
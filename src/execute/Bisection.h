@@ -0,0 +1,52 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <framework/Registry.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Outcome of narrowing down the test-cases which pollute a (victim) test-case, c.f. @c bisect.
+class Bisection {
+public:
+    /// Selection of candidates (by ascending index) executed before the victim in a single trial.
+    using Trial = std::vector<std::size_t>;
+
+    /// Whether the victim fails after each of the given trials; these are independent (thus executed concurrently).
+    using Reproduce = std::function<std::vector<bool>(std::vector<Trial> const &)>;
+
+    /// Conclusion about the failure of the victim.
+    enum class Verdict {
+        polluted, //!< fails after (only) the @c m_culprits.
+        self_failing, //!< fails even without any other test-case, i.e. isn't polluted.
+        unreproducible, //!< passes even after all candidates.
+    };
+
+    Verdict m_verdict;
+    Trial m_culprits = {}; //!< minimal set of candidates after which the victim fails (if polluted).
+    std::size_t m_num_rounds = 0ul; //!< number of rounds of (concurrent) trials.
+    std::size_t m_num_trials = 0ul; //!< total number of trials.
+};
+
+/// Narrow down which of @p num_candidates (executed in order before the victim) make the victim fail.
+///
+/// Every round executes up to @p num_parallel trials (at least two) concurrently via @p reproduce: These split the
+/// remaining candidates into contiguous chunks. A single polluting candidate is thus found in O(log n) rounds. If the
+/// failure requires candidates of multiple chunks, the half reproducing it on its own is narrowed down. Otherwise both
+/// halves are narrowed down in turn (keeping the other one, resp. its culprits, in every trial).
+Bisection bisect(std::size_t num_candidates, std::size_t num_parallel, Bisection::Reproduce const & reproduce);
+
+/// Trials of executing (in order) the @p candidates of @p cases before the @p victim (all by index into @p cases).
+///
+/// Every trial is executed in a process forked from the current one, s.t. it starts from a pristine (static) state. Up
+/// to @p num_parallel of them are executed concurrently. The victim fails if it didn't pass or if the trial crashed.
+/// Requires @c supports_isolation.
+Bisection::Reproduce forked_trials(
+    framework::Registry & cases, std::vector<std::size_t> candidates, std::size_t victim, std::size_t num_parallel);
+
+}
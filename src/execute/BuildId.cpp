@@ -0,0 +1,87 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "BuildId.h"
+
+#if __has_include(<link.h>) and __has_include(<elf.h>)
+# define CLEANTEST_HAS_BUILD_ID 1
+# include <elf.h>
+# include <link.h>
+#else
+# define CLEANTEST_HAS_BUILD_ID 0
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace clean_test::execute {
+namespace {
+
+#if CLEANTEST_HAS_BUILD_ID
+
+constexpr std::size_t note_aligned(std::size_t const size)
+{
+    return (size + 3ul) & ~std::size_t{3ul};
+}
+
+/// Search the notes of size @p size at @p data for the GNU build-id; returns it hex encoded (or empty).
+std::string find_build_id(unsigned char const * data, std::size_t size)
+{
+    static constexpr auto digits = std::string_view{"0123456789abcdef"};
+    static constexpr auto owner = std::string_view{"GNU", 4ul}; // including terminating zero
+    while (size >= sizeof(ElfW(Nhdr))) {
+        auto header = ElfW(Nhdr){};
+        std::memcpy(&header, data, sizeof(header));
+        auto const name_offset = sizeof(header);
+        auto const desc_offset = name_offset + note_aligned(header.n_namesz);
+        auto const total = desc_offset + note_aligned(header.n_descsz);
+        if (total > size) {
+            break;
+        }
+        auto const name = std::string_view{reinterpret_cast<char const *>(data + name_offset), header.n_namesz};
+        if (header.n_type == NT_GNU_BUILD_ID and name == owner) {
+            auto result = std::string{};
+            for (auto const * byte = data + desc_offset; byte != data + desc_offset + header.n_descsz; ++byte) {
+                result.push_back(digits[*byte >> 4u]);
+                result.push_back(digits[*byte & 0xfu]);
+            }
+            return result;
+        }
+        data += total;
+        size -= total;
+    }
+    return {};
+}
+
+int visit_executable(dl_phdr_info * const info, std::size_t, void * const output)
+{
+    for (auto h = 0u; h < info->dlpi_phnum; ++h) {
+        auto const & segment = info->dlpi_phdr[h];
+        if (segment.p_type != PT_NOTE) {
+            continue;
+        }
+        auto const * data = reinterpret_cast<unsigned char const *>(info->dlpi_addr + segment.p_vaddr);
+        if (auto id = find_build_id(data, segment.p_memsz); not id.empty()) {
+            *static_cast<std::string *>(output) = std::move(id);
+            break;
+        }
+    }
+    return 1; // the first visited object is the executable itself: stop
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string build_id()
+{
+    auto result = std::string{};
+#if CLEANTEST_HAS_BUILD_ID
+    ::dl_iterate_phdr(visit_executable, &result);
+#endif
+    return result;
+}
+
+}
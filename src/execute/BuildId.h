@@ -0,0 +1,15 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <string>
+
+namespace clean_test::execute {
+
+/// GNU build-id of the running executable (as hex string) read from its ELF note; empty if there is none.
+///
+/// The build-id changes with every change of the linked code, but is reproducible otherwise.
+std::string build_id();
+
+}
@@ -7,14 +7,45 @@
 #include "CaseReporter.h"
 #include "Observer.h"
 
+#include <framework/EventLoop.h>
 #include <framework/FallbackObservationSetup.h>
 
+#include <memory>
 #include <optional>
 
 namespace clean_test::execute {
+namespace {
+
+/// State of a started (coroutine) test-case evaluation.
+class Evaluation {
+public:
+    using Clock = CaseResult::Clock;
+
+    Evaluation(CaseReporter::Setup const & setup, std::string name) : m_reporter{setup}, m_name{std::move(name)}
+    {
+        m_reporter(CaseReporter::Start{m_name});
+    }
+
+    /// Collect result of the finished evaluation given its @p execution_outcome.
+    CaseResult finish(CaseStatus const execution_outcome)
+    {
+        auto const wall_time = Clock::now() - m_start;
+        auto result = CaseResult{m_name, execution_outcome, wall_time, std::move(m_observer).release()};
+        m_reporter(CaseReporter::Stop{m_name, wall_time, result.m_status});
+        return result;
+    }
+
+    CaseReporter m_reporter; //!< dedicated output facility (c.f. buffering).
+    Observer m_observer{m_reporter};
+    std::string const m_name;
+    Clock::time_point const m_start = Clock::now();
+};
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 CaseEvaluator::CaseEvaluator(CaseReporter::Setup const setup, bool const overwrite_fallback_observer = false) :
-    m_reporter{setup}, m_overwrite_fallback_observer{overwrite_fallback_observer}
+    m_setup{setup}, m_reporter{setup}, m_overwrite_fallback_observer{overwrite_fallback_observer}
 {}
 
 CaseResult CaseEvaluator::operator()(framework::Case & tc) noexcept
@@ -47,4 +78,20 @@ CaseResult CaseEvaluator::operator()(framework::Case & tc) noexcept
     return result;
 }
 
+void CaseEvaluator::start(framework::Case & tc, framework::EventLoop & loop, std::function<void(CaseResult)> done)
+{
+    auto evaluation = std::make_shared<Evaluation>(m_setup, std::string{tc.name().path()});
+    auto task = framework::Task{};
+    try {
+        task = tc.start(evaluation->m_observer);
+    } catch (...) {
+        done(evaluation->finish(CaseStatus::abort));
+        return;
+    }
+    auto & observer = evaluation->m_observer;
+    loop.spawn(std::move(task), observer, [evaluation, done = std::move(done)](std::exception_ptr const error) {
+        done(evaluation->finish(error ? CaseStatus::abort : CaseStatus::pass));
+    });
+}
+
 }
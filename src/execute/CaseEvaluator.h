@@ -3,11 +3,18 @@
 
 #pragma once
 
-#include "CaseResult.h"
 #include "CaseReporter.h"
 
+#include <execute/CaseResult.h>
+
 #include <framework/Case.h>
 
+#include <functional>
+
+namespace clean_test::framework {
+class EventLoop;
+}
+
 namespace clean_test::execute {
 
 /// Assesses testcase execution and thereby collects results.
@@ -19,7 +26,13 @@ public:
     /// Execute @p testcase and return results evaluated therein.
     CaseResult operator()(framework::Case & testcase) noexcept;
 
+    /// Start evaluating coroutine @p testcase on @p loop; its results are handed to @p done once it finished.
+    ///
+    /// Every started test-case reports to a dedicated @c CaseReporter (s.t. buffered output isn't interleaved).
+    void start(framework::Case & testcase, framework::EventLoop & loop, std::function<void(CaseResult)> done);
+
 private:
+    CaseReporter::Setup const m_setup; //!< output configuration (for the reporters of started test-cases).
     CaseReporter m_reporter; //!< output facility for test status and observations.
     /// Control whether exchanging the global fallback observer by the test-case specific observer is desired. This is
     /// only done temporarily while a testcase is being evaluated and reverted afterwards.
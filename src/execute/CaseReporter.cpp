@@ -31,6 +31,10 @@ BadgeType badge_type(CaseStatus status)
             return BadgeType::fail;
         case CaseStatus::pass:
             return BadgeType::pass;
+        case CaseStatus::timeout:
+            return BadgeType::timeout;
+        case CaseStatus::cached:
+            return BadgeType::cached;
         case CaseStatus::skip:
         default:
             std::terminate();
@@ -42,9 +46,11 @@ Color color(CaseStatus status)
     switch (status) {
         case CaseStatus::pass:
         case CaseStatus::skip:
+        case CaseStatus::cached:
             return Color::good;
         case CaseStatus::abort:
         case CaseStatus::fail:
+        case CaseStatus::timeout:
             return Color::bad;
         default:
             std::terminate();
@@ -88,11 +94,18 @@ CaseReporter::~CaseReporter()
 
 void CaseReporter::operator()(Start const & start)
 {
+    m_name = start.m_name;
+    for (auto * listener : m_setup.m_listeners) {
+        listener->on_case_start(start.m_name);
+    }
     output() << m_setup.m_colors.colored(Color::good, badge(BadgeType::start)) << ' ' << start.m_name << std::endl;
 }
 
 void CaseReporter::operator()(Observation const & o)
 {
+    for (auto * listener : m_setup.m_listeners) {
+        listener->on_observation(m_name, o);
+    }
     if (not m_is_observation_state_enabled[o.m_status]) {
         return;
     }
@@ -104,6 +117,9 @@ void CaseReporter::operator()(Observation const & o)
 
 void CaseReporter::operator()(Stop const & stop)
 {
+    for (auto * listener : m_setup.m_listeners) {
+        listener->on_case_stop(stop.m_name, stop.m_status, stop.m_wall_time);
+    }
     output()
         << m_setup.m_colors.colored(color(stop.m_status), badge(badge_type(stop.m_status))) << ' ' << stop.m_name
         << " (" << std::setprecision(0) << std::fixed << utils::WithAdaptiveUnit{stop.m_wall_time} << ')' << std::endl;
@@ -3,14 +3,15 @@
 
 #pragma once
 
-#include "CaseResult.h"
-#include "CaseStatus.h"
-#include "Observation.h"
-
 #include <execute/BufferingMode.h>
+#include <execute/CaseResult.h>
+#include <execute/CaseStatus.h>
+#include <execute/Listener.h>
+#include <execute/Observation.h>
 
 #include <array>
 #include <iosfwd>
+#include <span>
 #include <sstream>
 #include <string_view>
 
@@ -29,6 +30,7 @@ public:
         std::ostream & m_output; //!< stream to write any output into.
         ColorTable const & m_colors; //!< output coloring details
         BufferingMode m_buffering; //!< configured buffering; controls @c m_emit_regularly.
+        std::span<Listener * const> m_listeners = {}; //!< notified about all events (in addition to the output).
     };
 
     /// Event for the beginning of a test-case execution.
@@ -73,6 +75,7 @@ private:
     Setup const m_setup; //!< Output configuration.
     std::ostringstream m_buffer; //!< Intermediate storage for buffering output (iff configured).
     std::ostream & m_sink; //!< Destination of all output operations: either the buffer or output of @c setup.
+    std::string_view m_name = {}; //!< Full path of the currently executed test-case (for notifying listeners).
 
     /// Filter configuration for different output status.
     std::array<bool, ObservationStatus::num_values> const m_is_observation_state_enabled;
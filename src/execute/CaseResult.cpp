@@ -1,7 +1,7 @@
 // Copyright (c) m8mble 2020.
 // SPDX-License-Identifier: BSL-1.0
 
-#include "CaseResult.h"
+#include <execute/CaseResult.h>
 
 #include <algorithm>
 #include <concepts>
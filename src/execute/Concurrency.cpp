@@ -0,0 +1,101 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Concurrency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+namespace clean_test::execute {
+namespace {
+
+/// Below this utilization, more workers are added.
+constexpr auto min_utilization = 0.8;
+/// Utilization aimed for when adding workers (c.f. @c min_utilization).
+constexpr auto target_utilization = 0.9;
+/// Above this utilization, the CPUs are saturated (thus surplus workers are removed).
+constexpr auto max_utilization = 0.95;
+
+/// CPU time consumed by all threads of this process so far.
+std::chrono::duration<double> cpu_time()
+{
+#ifdef CLOCK_PROCESS_CPUTIME_ID
+    auto spec = ::timespec{};
+    if (::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &spec) == 0) {
+        return std::chrono::seconds{spec.tv_sec} + std::chrono::nanoseconds{spec.tv_nsec};
+    }
+#endif
+    return std::chrono::duration<double>{static_cast<double>(std::clock()) / CLOCKS_PER_SEC};
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t adapt(
+    std::size_t const num_active, double const utilization, std::size_t const num_cpus, std::size_t const max_workers)
+{
+    auto result = num_active;
+    if (utilization < min_utilization) {
+        // Workers are (partially) sleeping or waiting for I/O: more of them make use of the idle CPUs.
+        auto const needed
+            = std::ceil(static_cast<double>(num_active) * target_utilization / std::max(utilization, 0.01));
+        result = std::min(2ul * num_active, static_cast<std::size_t>(needed));
+    } else if (utilization > max_utilization and num_active > num_cpus) {
+        // Saturated CPUs: surplus workers merely oversubscribe them.
+        result = num_active - std::max(1ul, (num_active - num_cpus) / 4ul);
+    }
+    return std::clamp(result, 1ul, std::max(1ul, max_workers));
+}
+
+Concurrency::Concurrency(std::size_t const num_workers, std::size_t const num_cpus, bool const adaptive) :
+    m_num_workers{num_workers},
+    m_num_cpus{std::max(1ul, num_cpus)},
+    m_adaptive{adaptive},
+    m_limit{adaptive ? std::clamp(num_cpus, 1ul, std::max(1ul, num_workers)) : num_workers}
+{
+    m_timeline.emplace_back(Step{Clock::duration{}, m_limit});
+}
+
+bool Concurrency::await(std::size_t const id, std::chrono::milliseconds const timeout)
+{
+    if (id < m_limit.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    auto lock = std::unique_lock{m_mutex};
+    return m_changed.wait_for(lock, timeout, [this, id] { return id < m_limit.load(std::memory_order_relaxed); });
+}
+
+void Concurrency::tune(std::stop_token const stop, std::chrono::milliseconds const interval)
+{
+    if (not m_adaptive) {
+        return;
+    }
+
+    auto previous_cpu = cpu_time();
+    auto previous_wall = Clock::now();
+    auto lock = std::unique_lock{m_mutex};
+    while (not m_changed.wait_for(lock, stop, interval, [] { return false; }) and not stop.stop_requested()) {
+        auto const cpu = cpu_time();
+        auto const wall = Clock::now();
+        auto const elapsed = std::chrono::duration<double>{wall - previous_wall};
+        if (elapsed.count() > 0.0) {
+            auto const utilization = (cpu - previous_cpu) / (elapsed * static_cast<double>(m_num_cpus));
+            if (auto const limit = adapt(m_limit, utilization, m_num_cpus, m_num_workers); limit != m_limit) {
+                m_limit = limit;
+                m_timeline.emplace_back(Step{wall - m_start, limit});
+                m_changed.notify_all();
+            }
+        }
+        previous_cpu = cpu;
+        previous_wall = wall;
+    }
+}
+
+std::vector<Concurrency::Step> Concurrency::timeline() const
+{
+    auto const lock = std::lock_guard{m_mutex};
+    return m_timeline;
+}
+
+}
@@ -0,0 +1,74 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Number of workers for keeping @p num_cpus busy given their measured @p utilization (i.e. CPU time of this process
+/// relative to the wall time of all @p num_cpus) by @p num_active workers; clamped to at most @p max_workers.
+///
+/// Workers are added while the CPUs are underutilized (e.g. by sleeping or I/O-bound test-cases); surplus workers
+/// (beyond @p num_cpus) are removed while the CPUs are saturated. In between, the number of workers is retained.
+std::size_t adapt(std::size_t num_active, double utilization, std::size_t num_cpus, std::size_t max_workers);
+
+/// Limit on the number of workers which are claiming test-cases concurrently (c.f. @c --jobs=adaptive).
+///
+/// A fixed limit admits all workers. An adaptive one is tuned by periodic samples of the CPU time of this process (c.f.
+/// @c adapt). All workers are started anyway; those beyond the limit wait until they are admitted (again).
+class Concurrency {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Change of the limit at @c m_offset after starting.
+    class Step {
+    public:
+        Clock::duration m_offset;
+        std::size_t m_limit;
+    };
+
+    /// Detailed c'tor: Admit @p num_workers (at most) executing on @p num_cpus; the limit is tuned if @p adaptive.
+    Concurrency(std::size_t num_workers, std::size_t num_cpus, bool adaptive);
+
+    /// Whether the limit is tuned at all.
+    [[nodiscard]] bool adaptive() const noexcept
+    {
+        return m_adaptive;
+    }
+
+    /// Whether worker @p id may claim test-cases; waits at most @p timeout until it is admitted.
+    bool await(std::size_t id, std::chrono::milliseconds timeout);
+
+    /// Tune the limit (after every @p interval) until @p stop is requested.
+    void tune(std::stop_token stop, std::chrono::milliseconds interval);
+
+    /// All changes of the limit (starting with the initial one).
+    [[nodiscard]] std::vector<Step> timeline() const;
+
+    // non-copyable and non-movable
+    Concurrency(Concurrency &&) = delete;
+    Concurrency & operator=(Concurrency &&) = delete;
+    Concurrency(Concurrency const &) = delete;
+    Concurrency & operator=(Concurrency const &) = delete;
+
+private:
+    std::size_t const m_num_workers;
+    std::size_t const m_num_cpus;
+    bool const m_adaptive;
+    Clock::time_point const m_start = Clock::now();
+
+    mutable std::mutex m_mutex = {};
+    std::condition_variable_any m_changed = {};
+    std::atomic<std::size_t> m_limit; //!< number of workers currently admitted (those with smaller ids).
+    std::vector<Step> m_timeline = {};
+};
+
+}
@@ -8,44 +8,76 @@
 #include "CaseReporter.h"
 #include "ColorTable.h"
 #include "ColoringSetup.h"
+#include "Concurrency.h"
+#include "Dependencies.h"
+#include "Distribution.h"
+#include "FailureBudget.h"
+#include "History.h"
+#include "Interruption.h"
+#include "Journal.h"
+#include "Jobserver.h"
 #include "NameFilter.h"
 #include "Observer.h"
-
+#include "Orchestra.h"
+#include "ProcessPool.h"
+#include "Repetitions.h"
+#include "Resources.h"
+#include "Retries.h"
+#include "ResultCache.h"
+#include "ResultPipeline.h"
+#include "ThreadPool.h"
+#include "Topology.h"
+#include "Watchdog.h"
+
+#include <framework/Assistance.h>
+#include <framework/Cancellation.h>
+#include <framework/CancellationSetup.h>
+#include <framework/EventLoop.h>
 #include <framework/FallbackObservationSetup.h>
 #include <framework/Registry.h>
 
 #include <utils/OSyncStream.h>
 #include <utils/RangesUtils.h>
+#include <utils/ScopeGuard.h>
 #include <utils/WithAdaptiveUnit.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <exception>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string.h>
 #include <thread>
+#include <tuple>
+#include <utility>
 
 namespace clean_test::execute {
 namespace {
 
 using Cases = framework::Registry;
 
-bool passed(CaseStatus const status)
+bool is_regular(CaseResult::Type const & type)
 {
-    switch (status) {
-        case CaseStatus::pass:
-        case CaseStatus::skip:
-            return true;
-        case CaseStatus::fail:
-        case CaseStatus::abort:
-            return false;
-        default:
-            std::terminate();
-    }
+    return not static_cast<bool>(type);
 }
 
-bool is_regular(CaseResult::Type const & type)
+/// Past participle describing @p status (e.g. "failed").
+std::string_view describe(CaseStatus const status)
 {
-    return not static_cast<bool>(type);
+    static auto const descriptions
+        = std::to_array<std::string_view>({"passed", "failed", "aborted", "skipped", "timed out", "cached"});
+    return descriptions[status];
+}
+
+/// Result of skipping test-case @p tc.
+CaseResult skipped(framework::Case const & tc)
+{
+    return CaseResult{std::string{tc.name().path()}, CaseStatus::skip, CaseResult::Duration{}, {}};
 }
 
 Conductor::Setup const & default_setup()
@@ -55,123 +87,568 @@ Conductor::Setup const & default_setup()
         .m_logger = std::cout,
         .m_colors = coloring_setup(ColoringMode::automatic),
         .m_num_workers = 0u,
+        .m_adaptive_workers = false,
         .m_buffering = BufferingMode::testcase,
-        .m_filter = filter};
+        .m_filter = filter,
+        .m_scheduling = SchedulingMode::work_stealing,
+        .m_history = nullptr,
+        .m_ordering = OrderingMode::duration,
+        .m_cache = nullptr,
+        .m_resumption = nullptr,
+        .m_quarantine = nullptr,
+        .m_isolation = IsolationMode::off,
+        .m_coordination = nullptr,
+        .m_orchestra = nullptr,
+        .m_pinning = PinningMode::off,
+        .m_threads = nullptr,
+        .m_jobserver = nullptr,
+        .m_memory = 0ul,
+        .m_shard_index = 0ul,
+        .m_num_shards = 1ul,
+        .m_timeout = CaseResult::Duration{},
+        .m_on_timeout = TimeoutMode::proceed,
+        .m_max_failures = 0ul,
+        .m_repetitions = 1ul,
+        .m_until_fail = false,
+        .m_retries = 0ul,
+        .m_interruptible = false,
+        .m_sinks = {},
+        .m_listeners = {},
+        .m_retain_results = true};
     return singleton;
 }
 
+/// Maximum number of workers per CPU core for adaptive concurrency (c.f. @c Conductor::Setup::m_adaptive_workers).
+constexpr auto max_oversubscription = 4ul;
+
+/// Maximum number of changes of adaptive concurrency listed in the final summary.
+constexpr auto max_reported_steps = 16ul;
+
 Conductor::Setup normalized(Conductor::Setup const & input)
 {
     auto output = input; // intentional copy
 
-    // Map special value of 0 workers to the maximum number supported of concurrently running CPU cores.
+    // The CPU time of worker processes can't be sampled (while they are running).
+    if (output.m_adaptive_workers and output.m_isolation == IsolationMode::process and supports_isolation()) {
+        output.m_logger
+            << output.m_colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Adaptive concurrency is not supported for isolated execution; using all CPU cores."
+            << output.m_colors[Color::off] << std::endl;
+        output.m_adaptive_workers = false;
+        output.m_num_workers = 0u;
+    }
+
+    // Map special value of 0 workers to the number of CPU cores available to this process (bounding adaptive
+    // concurrency by oversubscribing them).
     auto & num_jobs = output.m_num_workers;
     if (num_jobs == 0u) {
-        num_jobs = std::max(1u, std::thread::hardware_concurrency());
+        num_jobs = available_cpus() * (output.m_adaptive_workers ? max_oversubscription : 1ul);
+    }
+
+    if (output.m_memory == 0ul) {
+        output.m_memory = available_memory();
+    }
+
+    // Every test-case is executed at least once; repetitions must actually execute (i.e. not report cached results)
+    // and report every failing run (i.e. not retry them).
+    output.m_repetitions = std::max(1ul, output.m_repetitions);
+    if (output.m_repetitions > 1ul) {
+        output.m_cache = nullptr;
+        output.m_retries = 0ul;
+    }
+
+    // Gracefully degrade to in-process execution where worker processes are not available.
+    if (output.m_isolation == IsolationMode::process and not supports_isolation()) {
+        output.m_logger
+            << output.m_colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Isolated execution is not supported on this platform; executing in-process."
+            << output.m_colors[Color::off] << std::endl;
+        output.m_isolation = IsolationMode::off;
+    }
+
+    if (output.m_coordination != nullptr and not supports_distribution()) {
+        output.m_logger
+            << output.m_colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Distributed execution is not supported on this platform; executing locally."
+            << output.m_colors[Color::off] << std::endl;
+        output.m_coordination = nullptr;
+    }
+
+    if (output.m_pinning == PinningMode::cores and not supports_pinning()) {
+        output.m_logger
+            << output.m_colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Pinning workers to CPU cores is not supported on this platform; executing unpinned."
+            << output.m_colors[Color::off] << std::endl;
+        output.m_pinning = PinningMode::off;
     }
 
     return output;
 }
 
-template <typename T>
-std::vector<T> & move_append(std::vector<T> & destination, std::vector<T> source)
+/// Estimate durations of @p test_cases as far as known from the history; nothing if none of them is known.
+///
+/// Test-cases without history are estimated by the median of those with history; disabled ones take no time. Only the
+/// history and the filter are considered (not e.g. the cache), s.t. all shards compute the same estimates.
+std::optional<std::vector<Plan::Duration>> estimate_durations(Cases const & test_cases, Conductor::Setup const & setup)
+{
+    if (setup.m_history == nullptr) {
+        return {};
+    }
+
+    auto estimates = std::vector<std::optional<Plan::Duration>>{};
+    auto known = std::vector<Plan::Duration>{};
+    for (auto const & tc : test_cases) {
+        auto & estimate = estimates.emplace_back();
+        if (not static_cast<bool>(setup.m_filter(tc.name()))) {
+            estimate = Plan::Duration{};
+        } else if (auto const * record = setup.m_history->find(tc.name().path()); record != nullptr) {
+            estimate = known.emplace_back(record->m_wall_time);
+        }
+    }
+    if (known.empty()) {
+        return {};
+    }
+
+    auto const median = known.begin() + known.size() / 2ul;
+    std::nth_element(known.begin(), median, known.end());
+    auto durations = std::vector<Plan::Duration>{};
+    durations.reserve(estimates.size());
+    for (auto const & estimate : estimates) {
+        durations.emplace_back(estimate.value_or(*median));
+    }
+    return durations;
+}
+
+/// Plan execution of all @p repetitions of @p test_cases: longest first as far as known from the history, else in
+/// registration order. Ordering by risk starts the test-cases most likely to fail (c.f. @c History::risk) before.
+///
+/// Test-cases with previous results (cached or resumed) take no time, since they aren't executed again.
+Plan make_plan(Cases const & test_cases, Repetitions const & repetitions, Conductor::Setup const & setup)
 {
-    for (auto & s : source) {
-        destination.emplace_back(std::move(s));
+    auto plan = registration_order(repetitions.num_copies());
+    if (auto const durations = estimate_durations(test_cases, setup); durations) {
+        auto copies = std::vector<Plan::Duration>{};
+        copies.reserve(repetitions.num_copies());
+        for (auto copy = 0ul; copy < repetitions.num_copies(); ++copy) {
+            auto const index = repetitions.case_index(copy);
+            auto const previous = previous_result(test_cases[index].name(), setup.m_resumption, setup.m_cache);
+            copies.emplace_back(previous ? Plan::Duration{} : (*durations)[index]);
+        }
+        plan = longest_first(copies, setup.m_num_workers);
+    }
+    if (setup.m_ordering == OrderingMode::risk and setup.m_history != nullptr) {
+        auto risks = std::vector<std::uint64_t>{};
+        risks.reserve(repetitions.num_copies());
+        for (auto copy = 0ul; copy < repetitions.num_copies(); ++copy) {
+            auto const & tc = test_cases[repetitions.case_index(copy)];
+            auto const executed = static_cast<bool>(setup.m_filter(tc.name()))
+                and not previous_result(tc.name(), setup.m_resumption, setup.m_cache);
+            risks.emplace_back(executed ? setup.m_history->risk(tc.name().path()) : 0u);
+        }
+        plan = riskiest_first(plan, risks, setup.m_num_workers);
+    }
+    return plan;
+}
+
+/// Restrict @p test_cases to those of the configured shard (keeping their registration order).
+///
+/// Shards are balanced by the estimated durations of their test-cases (as far as known from the history). Without any
+/// history, all test-cases are assumed to take equally long which results in a round-robin distribution. Either way,
+/// the distribution is deterministic: every shard computes the same (given the same test-cases, history and filter),
+/// regardless of its local cache or journal.
+Cases select_shard(Cases test_cases, Conductor::Setup const & setup)
+{
+    if (setup.m_num_shards <= 1ul) {
+        return test_cases;
+    }
+
+    auto const durations = estimate_durations(test_cases, setup)
+                               .value_or(std::vector<Plan::Duration>(test_cases.size(), Plan::Duration{1}));
+    auto const plan = longest_first(durations, setup.m_num_shards);
+    auto selected = std::vector<bool>(test_cases.size(), false);
+    for (auto pos = 0ul; pos < plan.m_order.size(); ++pos) {
+        selected[plan.m_order[pos]] = (plan.m_workers[pos] == setup.m_shard_index);
+    }
+
+    auto result = Cases{};
+    for (auto i = 0ul; i < test_cases.size(); ++i) {
+        if (selected[i]) {
+            result.emplace_back(std::move(test_cases[i]));
+        }
     }
-    return destination;
+    return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-class Worker {
+/// State shared by all workers of one execution.
+class Crew {
 public:
-    using Next = std::atomic<std::size_t>;
+    Crew(
+        Cases cases,
+        Plan const & plan,
+        DependencyGraph const & dependencies,
+        Conductor::Setup const & setup,
+        ResultPipeline & results,
+        FailureBudget & budget,
+        Repetitions & repetitions,
+        Concurrency & concurrency) :
+        m_cases{std::move(cases)},
+        m_results{results},
+        m_budget{budget},
+        m_repetitions{repetitions},
+        m_retries{m_cases.size(), setup.m_retries, setup.m_quarantine},
+        m_scheduler{make_scheduler(setup.m_scheduling, plan, setup.m_num_workers)},
+        m_resources{*m_scheduler, repetitions, requirements(m_cases, setup.m_filter), dependencies, setup.m_memory},
+        m_watchdog{setup.m_num_workers},
+        m_assistance{setup.m_num_workers},
+        m_supervised{supervised(m_cases, setup)},
+        m_cpus{setup.m_pinning == PinningMode::cores ? pinning_order() : std::vector<std::size_t>{}},
+        m_jobserver{setup.m_jobserver},
+        m_concurrency{concurrency},
+        m_listeners{setup.m_listeners},
+        m_num_copies{repetitions.num_copies()}
+    {}
+
+    /// Hand @p result of executing @p copy on to the @c m_results (accounting for it in the @c m_budget and settling it
+    /// for its dependents).
+    ///
+    /// Failed attempts are handed out once more instead (c.f. @c m_retries), s.t. the next idle worker retries them.
+    /// Results of repeated test-cases are collected in @c m_repetitions instead (for combining them later).
+    void deliver(std::size_t const copy, CaseResult result)
+    {
+        if (m_retries.retry(copy, result)) {
+            m_num_claimed.fetch_sub(1ul, std::memory_order_relaxed);
+            m_resources.retry(copy);
+            return;
+        }
+        result = m_retries.finish(copy, std::move(result));
+        m_budget.account(result);
+        m_resources.settle(copy, result.m_status);
+        if (m_repetitions.aggregates()) {
+            m_repetitions.add(copy, std::move(result));
+        } else {
+            m_results.push(std::move(result));
+        }
+    }
+
+    Cases m_cases;
+    ResultPipeline & m_results; //!< destination for the results of all workers.
+    FailureBudget & m_budget; //!< cancels execution after too many failures.
+    Repetitions & m_repetitions; //!< maps copies (as planned) to test-cases and collects results of repeated ones.
+    Retries m_retries; //!< decides which failed test-cases are executed again.
+    std::unique_ptr<Scheduler> m_scheduler;
+    ResourceScheduler m_resources; //!< hands out cases of @c m_scheduler once their resources are available.
+    Watchdog m_watchdog;
+    framework::Assistance m_assistance; //!< lends idle workers to test-cases using @c parallel_for.
+    std::atomic<bool> m_stopped = false; //!< whether workers should stop claiming further test-cases.
+    bool const m_supervised; //!< whether test-cases must be announced to the @c m_watchdog (i.e. may time out).
+    std::vector<std::size_t> const m_cpus; //!< CPUs for pinning the workers to (by their id); empty if unpinned.
+    Jobserver * const m_jobserver; //!< source of tokens for all but the first worker (if any).
+    Concurrency & m_concurrency; //!< limits the number of workers claiming test-cases.
+    std::vector<Listener *> const m_listeners; //!< notified about the events of all evaluated test-cases.
+    std::size_t const m_num_copies; //!< number of test-cases (copies) to be claimed in total.
+    std::atomic<std::size_t> m_num_claimed = 0ul; //!< number of test-cases (copies) claimed so far.
 
-    Worker(Cases & cases, Next & next, Conductor::Setup setup) :
-        m_cases{cases},
-        m_next{next},
-        m_filter{std::move(setup.m_filter)},
+private:
+    static bool supervised(Cases const & cases, Conductor::Setup const & setup)
+    {
+        return std::any_of(cases.cbegin(), cases.cend(), [&setup](framework::Case const & tc) {
+            return timeout(tc.name(), setup.m_timeout) != CaseResult::Duration{};
+        });
+    }
+};
+
+class Worker {
+public:
+    Worker(
+        Crew & crew, ThreadPool & threads, std::size_t const id, std::size_t const generation, Conductor::Setup setup) :
+        m_crew{crew},
+        m_id{id},
+        m_generation{generation},
+        m_timeout{setup.m_timeout},
+        m_filter{setup.m_filter.get()},
+        m_cache{setup.m_cache},
+        m_resumption{setup.m_resumption},
         m_evaluator{
             {.m_output = setup.m_logger,
              .m_colors = std::move(setup.m_colors),
-             .m_buffering = std::move(setup.m_buffering)},
+             .m_buffering = std::move(setup.m_buffering),
+             .m_listeners = crew.m_listeners},
             setup.m_num_workers == 1,
         },
-        m_results{},
-        m_thread{[this] { run(); }}
+        m_completion{threads.submit([this] { run(); })}
     {}
 
     void join()
     {
-        m_thread.join();
+        m_completion.wait();
     }
 
-    auto results() &&
+    /// Give up on the thread of this worker: It is stuck in a test-case (and thus must never be destroyed).
+    void abandon()
     {
-        return std::move(m_results);
+        m_completion.abandon();
     }
 
 private:
     void run()
     {
-        auto const num = m_cases.size();
-
-        auto next = [previous = std::size_t{0}, this, num]() mutable {
-            while (previous < num
-                   and not m_next.compare_exchange_weak(previous, previous + 1, std::memory_order_relaxed)) {
+        if (auto const & cpus = m_crew.m_cpus; not cpus.empty()) {
+            pin_current_thread(cpus[m_id % cpus.size()]);
+        }
+        while (true) {
+            if (auto const cur = claim(); cur) {
+                if (not evaluate(*cur)) {
+                    return; // abandoned: a replacement took over (if any).
+                }
+                m_loop.run_once(false);
+            } else if (m_loop.size() > 0ul) {
+                m_loop.run_once(true);
+            } else if (not m_crew.m_stopped.load(std::memory_order_relaxed) and not m_crew.m_resources.exhausted()) {
+                // Remaining test-cases wait for resources held by others.
+                return_token();
+                m_crew.m_resources.await(m_epoch);
+            } else {
+                break;
             }
-            return previous;
+            if (m_loop.size() == 0ul) {
+                return_token();
+            }
+        }
+        return_token();
+        if (not m_crew.m_supervised) {
+            // Nothing left to claim: Lend this (otherwise idle) worker to test-cases which are still running (unless
+            // it would require a token of the jobserver).
+            if (m_crew.m_jobserver == nullptr or m_id == 0ul) {
+                m_crew.m_assistance.assist();
+            } else {
+                m_crew.m_assistance.retire();
+            }
+        }
+        m_crew.m_watchdog.retire(m_id, m_generation);
+    }
+
+    /// Next test-case (copy) to evaluate (with its resources reserved); nothing if execution stopped, the @c m_loop is
+    /// full or no (available) test-case is left.
+    std::optional<std::size_t> claim()
+    {
+        if (m_crew.m_stopped.load(std::memory_order_relaxed) or m_loop.size() >= max_interleaved or not admitted()) {
+            return {};
+        }
+        auto const [result, epoch] = m_crew.m_resources.next(m_id);
+        m_epoch = epoch;
+        if (result) {
+            m_crew.m_num_claimed.fetch_add(1ul, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /// Whether this worker may start another test-case: Only workers within the limit of the @c Concurrency do so. All
+    /// but the first worker hold a token of the jobserver (if any) while evaluating test-cases. Gives up waiting once
+    /// all test-cases have been claimed.
+    bool admitted()
+    {
+        auto const pending = [this] {
+            return not m_crew.m_stopped.load(std::memory_order_relaxed)
+                and m_crew.m_num_claimed.load(std::memory_order_relaxed) < m_crew.m_num_copies;
         };
+        if (not m_crew.m_concurrency.await(m_id, std::chrono::milliseconds{0})) {
+            if (m_loop.size() > 0ul) {
+                return false; // finish interleaved coroutines first.
+            }
+            while (not m_crew.m_concurrency.await(m_id, token_poll_interval)) {
+                if (not pending()) {
+                    return false;
+                }
+            }
+        }
 
-        for (auto cur = next(); cur < num; cur = next()) {
-            m_results.emplace_back(evaluate(m_cases[cur]));
+        auto * const jobserver = m_crew.m_jobserver;
+        if (jobserver == nullptr or m_id == 0ul or m_token) {
+            return true;
+        }
+        while (pending()) {
+            if (m_token = jobserver->acquire(token_poll_interval); m_token) {
+                return true;
+            }
         }
+        return false;
     }
 
-    CaseResult evaluate(framework::Case & tc)
+    /// Return the token of the jobserver (if held).
+    void return_token()
     {
+        if (m_token) {
+            m_crew.m_jobserver->release(*std::exchange(m_token, std::nullopt));
+        }
+    }
+
+    /// Evaluate test-case planned as @p copy and deliver its result; false if it has been abandoned after exceeding its
+    /// timeout.
+    ///
+    /// Coroutine test-cases are only started: They are interleaved on the @c m_loop and deliver once they finished.
+    bool evaluate(std::size_t const copy)
+    {
+        auto const index = m_crew.m_repetitions.case_index(copy);
+        auto & tc = m_crew.m_cases[index];
+        auto release = utils::ScopeGuard{[this, index] { m_crew.m_resources.release(index); }};
+        if (framework::cancellation_requested()) {
+            // Skip unstarted test-case after cancellation.
+            m_crew.deliver(copy, skipped(tc));
+            return true;
+        }
+        if (not m_crew.m_resources.satisfied(index)) {
+            // Skip test-case since (some of) its dependencies didn't pass.
+            m_crew.deliver(copy, skipped(tc));
+            return true;
+        }
         switch (m_filter(tc.name())) {
-            case NameFilterToggle::enabled:
-                // Execute test-case.
-                return m_evaluator(tc);
+            case NameFilterToggle::enabled: {
+                // Report result from a previous execution.
+                if (auto previous = previous_result(tc.name(), m_resumption, m_cache); previous) {
+                    m_crew.deliver(copy, std::move(*previous));
+                    return true;
+                }
+
+                // Execute test-case: Coroutines can only be interleaved if they can't time out.
+                if (not m_crew.m_supervised) {
+                    if (tc.is_coroutine()) {
+                        release.dismiss(); // resources are held until the coroutine finished.
+                        m_evaluator.start(tc, m_loop, [this, copy, index](CaseResult result) {
+                            m_crew.deliver(copy, std::move(result));
+                            m_crew.m_resources.release(index);
+                        });
+                    } else {
+                        m_crew.deliver(copy, m_evaluator(tc));
+                    }
+                    return true;
+                }
+                m_crew.m_watchdog.start(m_id, copy, timeout(tc.name(), m_timeout));
+                auto result = m_evaluator(tc);
+                if (not m_crew.m_watchdog.stop(m_id, m_generation)) {
+                    release.dismiss(); // released on expiry (c.f. execute_parallel).
+                    return false;
+                }
+                m_crew.deliver(copy, std::move(result));
+                return true;
+            }
 
             case NameFilterToggle::disabled:
                 // Skip test-case.
-                return CaseResult{std::string{tc.name().path()}, CaseStatus::skip, CaseResult::Duration{}, {}};
+                m_crew.deliver(copy, skipped(tc));
+                return true;
 
             default:
                 std::terminate();
         }
     }
 
-    Cases & m_cases;
-    Next & m_next;
+    /// Maximum number of (suspended) coroutine test-cases interleaved by a single worker.
+    static constexpr auto max_interleaved = 64ul;
+    /// Interval for checking whether any test-cases are left while waiting for admission (or a token of the jobserver).
+    static constexpr auto token_poll_interval = std::chrono::milliseconds{50};
+
+    Crew & m_crew;
+    std::size_t const m_id; //!< index of this worker (in the @c Scheduler and @c Watchdog of @c m_crew).
+    std::size_t const m_generation; //!< number of workers with the same @c m_id which have been abandoned before.
+    CaseResult::Duration const m_timeout; //!< default timeout (for test-cases without timeout tag).
     NameFilter const & m_filter;
+    ResultCache const * const m_cache; //!< source of results from previous executions (if any).
+    Resumption const * const m_resumption; //!< source of results from an interrupted execution (if any).
     CaseEvaluator m_evaluator;
-    Outcome::Results m_results;
-    std::thread m_thread;
+    framework::EventLoop m_loop; //!< for interleaving coroutine test-cases.
+    std::size_t m_epoch = 0ul; //!< of the latest claim (for awaiting resources).
+    std::optional<Jobserver::Token> m_token = {}; //!< held while evaluating test-cases (if required).
+    ThreadPool::Completion m_completion; //!< of the thread executing this worker.
 };
 
-auto execute_parallel(Cases test_cases, Conductor::Setup const setup)
+/// Interval for sampling the CPU utilization (c.f. @c Concurrency::tune).
+constexpr auto tuning_interval = std::chrono::milliseconds{100};
+
+/// Execute @p test_cases according to @p plan (respecting their @p dependencies) on the workers of @p setup and hand
+/// their @p results on. Only workers within the limit of the @p concurrency claim test-cases.
+///
+/// The calling thread acts as watchdog: Test-cases exceeding their timeout are reported and their workers abandoned.
+/// Once the failure @p budget is exhausted, the workers skip all unstarted test-cases. The @p plan covers all copies of
+/// the @p repetitions.
+void execute_parallel(
+    Cases test_cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions,
+    Concurrency & concurrency)
 {
     auto const num_threads = setup.m_num_workers;
-    auto next = std::atomic<std::size_t>{0ul};
+
+    // Pinned workers get fresh threads: Their affinity would persist beyond this execution otherwise.
+    auto fresh = std::optional<ThreadPool>{};
+    auto & threads = (setup.m_threads != nullptr and setup.m_pinning == PinningMode::off) ? *setup.m_threads
+                                                                                          : fresh.emplace();
+    auto crew = std::make_unique<Crew>(
+        std::move(test_cases), plan, dependencies, setup, results, budget, repetitions, concurrency);
+
+    // Idle workers may only assist test-cases which can't time out (abandoning them would be impossible otherwise).
+    auto assistance = std::optional<framework::AssistanceSetup>{};
+    if (not crew->m_supervised) {
+        assistance.emplace(crew->m_assistance);
+    }
 
     // start workers
-    auto workers = std::vector<Worker>{};
+    auto workers = std::vector<std::unique_ptr<Worker>>{};
     workers.reserve(num_threads);
     while (workers.size() < num_threads) {
-        workers.emplace_back(test_cases, next, setup);
+        workers.emplace_back(std::make_unique<Worker>(*crew, threads, workers.size(), 0ul, setup));
+    }
+
+    // tune the number of workers claiming test-cases (if adaptive)
+    auto tuner = std::jthread{};
+    if (concurrency.adaptive()) {
+        tuner = std::jthread{[&concurrency](std::stop_token const stop) { concurrency.tune(stop, tuning_interval); }};
+    }
+
+    // supervise workers
+    auto abandoned = std::vector<std::unique_ptr<Worker>>{};
+    while (auto const expiry = crew->m_watchdog.await()) {
+        auto const index = crew->m_repetitions.case_index(expiry->m_copy);
+        auto const name = crew->m_cases[index].name().path();
+        report_timeout(
+            setup, name, expiry->m_timeout, crew->m_watchdog.activities(crew->m_cases, crew->m_repetitions));
+        crew->deliver(expiry->m_copy, timeout_result(name, expiry->m_timeout));
+        abandoned.emplace_back(std::move(workers[expiry->m_worker]))->abandon();
+        switch (setup.m_on_timeout) {
+            case TimeoutMode::proceed: {
+                auto const generation = crew->m_watchdog.revive(expiry->m_worker);
+                workers[expiry->m_worker] = std::make_unique<Worker>(
+                    *crew, threads, expiry->m_worker, generation, setup);
+                break;
+            }
+            case TimeoutMode::terminate:
+                crew->m_stopped = true;
+                break;
+            default:
+                std::terminate();
+        }
+        crew->m_resources.release(index);
     }
 
-    // collect results
-    auto results = Outcome::Results{};
     for (auto & worker : workers) {
-        worker.join();
-        move_append(results, std::move(worker).results());
+        if (worker) {
+            worker->join();
+        }
+    }
+    tuner = {};
+
+    // Abandoned workers are potentially still executing (their test-cases): Intentionally leak all they might access.
+    if (not abandoned.empty()) {
+        for (auto & worker : abandoned) {
+            static_cast<void>(worker.release());
+        }
+        static_cast<void>(crew.release());
     }
-    return results;
 }
 
 void report_locations(Conductor::Setup const & setup, std::vector<Observation> const & data)
@@ -179,8 +656,8 @@ void report_locations(Conductor::Setup const & setup, std::vector<Observation> c
     auto const & colors = setup.m_colors;
     auto & logger = setup.m_logger;
 
-    struct CompareSourceLocation {
-        bool operator()(utils::SourceLocation const & l, utils::SourceLocation const & r) const {
+    struct CompareLocation {
+        bool operator()(Location const & l, Location const & r) const {
             if (auto const cmp = strcmp(l.file_name(), r.file_name()); cmp != 0) {
                 return cmp < 0;
             }
@@ -188,7 +665,7 @@ void report_locations(Conductor::Setup const & setup, std::vector<Observation> c
         }
     };
     auto const locations = [&] {
-        auto result = std::set<utils::SourceLocation, CompareSourceLocation>{};
+        auto result = std::set<Location, CompareLocation>{};
         for (auto const & sample: data) {
             result.emplace(sample.m_where);
         }
@@ -208,7 +685,17 @@ void report_locations(Conductor::Setup const & setup, std::vector<Observation> c
 }
 
 /// Variant of @c execute_parallel that manages mis-reported @c Observation s encountered at a fallback observer.
-Outcome safe_execute_parallel(Cases test_cases, Conductor::Setup const setup)
+///
+/// Returns the total wall time of the execution.
+Outcome::Duration safe_execute_parallel(
+    Cases test_cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions,
+    Concurrency & concurrency)
 {
     using Clock = CaseResult::Clock;
     auto const time_start = Clock::now();
@@ -219,21 +706,97 @@ Outcome safe_execute_parallel(Cases test_cases, Conductor::Setup const setup)
     auto const fallback = framework::FallbackObservationSetup{fallback_observer};
 
     // Run all test-cases in parallel (with the ensured fallback observation setup).
-    auto results = execute_parallel(std::move(test_cases), setup);
+    if (setup.m_orchestra != nullptr) {
+        execute_orchestrated(test_cases, plan, dependencies, setup, results, budget, repetitions);
+    } else if (setup.m_coordination != nullptr) {
+        execute_distributed(test_cases, plan, dependencies, setup, results, budget, repetitions);
+    } else {
+        switch (setup.m_isolation) {
+            case IsolationMode::off:
+                execute_parallel(
+                    std::move(test_cases), plan, dependencies, setup, results, budget, repetitions, concurrency);
+                break;
+            case IsolationMode::process:
+                execute_isolated(test_cases, plan, dependencies, setup, results, budget, repetitions);
+                break;
+            default:
+                std::terminate();
+        }
+    }
 
     // Harvest any incorrectly directed observations.
     auto unmanaged = std::move(fallback_observer).release();
     if (not unmanaged.empty()) {
         report_locations(setup, unmanaged);
-        results.emplace_back(
-            "unknown", CaseStatus::pass, CaseResult::Duration{}, std::move(unmanaged), CaseResult::Type::fallback);
+        results.push(CaseResult{
+            "unknown", CaseStatus::pass, CaseResult::Duration{}, std::move(unmanaged), CaseResult::Type::fallback});
     }
-    return {Clock::now() - time_start, std::move(results)};
+    return Clock::now() - time_start;
 }
 
+/// Adaptor handing all results to a @c Listener (c.f. @c Conductor::Setup::m_listeners).
+class ListenerSink final : public ResultSink {
+public:
+    explicit ListenerSink(Listener & listener) noexcept : m_listener{listener}
+    {}
+
+private:
+    void consume_impl(CaseResult const & result) final
+    {
+        m_listener.on_result(result);
+    }
+
+    void finish_impl(Outcome::Duration const wall_time) final
+    {
+        m_listener.on_run_end(std::chrono::duration_cast<Listener::Duration>(wall_time));
+    }
+
+    Listener & m_listener;
+};
+
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Counters (and names of failed test-cases) for the final summary of a @c Conductor.
+class Tally final : public ResultSink {
+public:
+    std::size_t m_num_regular = 0ul; //!< number of regular (i.e. not fallback) results.
+    std::size_t m_num_passed = 0ul; //!< number of passed regular results.
+    std::size_t m_num_cached = 0ul; //!< number of (passed) results from previous executions.
+    std::vector<std::string> m_failed = {}; //!< names of all results which didn't pass (unless quarantined).
+    std::vector<std::string> m_quarantined = {}; //!< names of all quarantined results which didn't pass.
+    /// Names, attempts and final status of all retried test-cases.
+    std::vector<std::tuple<std::string, CaseResult::Attempts, CaseStatus>> m_retried = {};
+    /// Names and statistics of all repeated test-cases.
+    std::vector<std::pair<std::string, CaseResult::Statistics>> m_repeated = {};
+
+private:
+    void consume_impl(CaseResult const & result) final
+    {
+        auto const regular = is_regular(result.m_type);
+        m_num_regular += regular;
+        m_num_cached += (result.m_status == CaseStatus::cached);
+        if (passed(result.m_status)) {
+            m_num_passed += regular;
+        } else if (result.m_quarantined) {
+            m_quarantined.emplace_back(result.m_name_path);
+        } else {
+            m_failed.emplace_back(result.m_name_path);
+        }
+        if (result.m_attempts) {
+            m_retried.emplace_back(result.m_name_path, *result.m_attempts, result.m_status);
+        }
+        if (result.m_statistics) {
+            m_repeated.emplace_back(result.m_name_path, *result.m_statistics);
+        }
+    }
+
+    void finish_impl(Outcome::Duration) final
+    {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 Conductor::Conductor(Setup const & setup) noexcept : m_setup{normalized(setup)}
 {}
 
@@ -242,39 +805,90 @@ Conductor::Conductor() noexcept : Conductor{default_setup()}
 
 Outcome Conductor::run() const
 {
-    auto & registry = framework::registry();
-    m_setup.m_logger
-        << m_setup.m_colors.colored(Color::good, badge(BadgeType::title)) << " Running " << registry.size()
-        << " test-cases" << std::endl;
-
-    // run cases and collect results
-    auto const outcome = safe_execute_parallel(std::exchange(registry, {}), m_setup);
-    if (not registry.empty()) {
+    return execute(std::exchange(framework::registry(), {}), m_setup, true);
+}
+
+Outcome Conductor::run(std::vector<framework::Case> test_cases, NameFilter const & filter) const
+{
+    auto setup = m_setup; // intentional copy
+    setup.m_filter = filter;
+    return execute(std::move(test_cases), setup, false);
+}
+
+Outcome Conductor::execute(std::vector<framework::Case> all_cases, Setup const & setup, bool const consumed) const
+{
+    auto test_cases = select_shard(std::move(all_cases), setup);
+    setup.m_logger
+        << setup.m_colors.colored(Color::good, badge(BadgeType::title)) << " Running " << test_cases.size()
+        << " test-cases";
+    if (setup.m_repetitions > 1ul) {
+        setup.m_logger << " (" << setup.m_repetitions << " times each)";
+    }
+    if (setup.m_num_shards > 1ul) {
+        setup.m_logger << " (shard " << setup.m_shard_index + 1ul << '/' << setup.m_num_shards << ')';
+    }
+    setup.m_logger << std::endl;
+
+    // run cases and stream their results into all sinks
+    auto tally = Tally{};
+    auto sinks = setup.m_sinks;
+    auto listening = std::vector<ListenerSink>{};
+    listening.reserve(setup.m_listeners.size()); // s.t. the sinks remain in place
+    for (auto * listener : setup.m_listeners) {
+        sinks.emplace_back(&listening.emplace_back(*listener));
+    }
+    sinks.emplace_back(&tally);
+    auto pipeline = ResultPipeline{std::move(sinks), setup.m_retain_results};
+    auto budget = FailureBudget{setup.m_until_fail ? 1ul : setup.m_max_failures};
+    auto repetitions = Repetitions{test_cases.size(), setup.m_repetitions};
+    framework::CancellationSetup::reset();
+    auto const plan = make_plan(test_cases, repetitions, setup);
+    auto const dependencies = DependencyGraph{test_cases};
+    if (not dependencies.unresolved().empty() or not dependencies.cyclic().empty()) {
+        display_unmet_dependencies_warning(test_cases, dependencies);
+    }
+    auto concurrency = Concurrency{setup.m_num_workers, available_cpus(), setup.m_adaptive_workers};
+    auto interruption = std::optional<InterruptionSetup>{};
+    if (setup.m_interruptible) {
+        interruption.emplace();
+    }
+    auto const wall_time = safe_execute_parallel(
+        std::move(test_cases), plan, dependencies, setup, pipeline, budget, repetitions, concurrency);
+    auto const interrupted = interruption and interruption->interrupted();
+    interruption.reset();
+    if (repetitions.aggregates()) {
+        for (auto & result : std::move(repetitions).combine()) {
+            pipeline.push(std::move(result));
+        }
+    }
+    auto outcome = Outcome{wall_time, pipeline.finish(wall_time), interrupted};
+    if (auto const & registry = framework::registry(); consumed and not registry.empty()) {
         display_late_registration_warning(registry);
     }
 
-    report(outcome);
+    report(wall_time, tally, plan, budget, interrupted, concurrency);
     return outcome;
 }
 
-void Conductor::report(Outcome const & outcome) const
+void Conductor::report(
+    Outcome::Duration const wall_time,
+    Tally const & tally,
+    Plan const & plan,
+    FailureBudget const & budget,
+    bool const interrupted,
+    Concurrency const & concurrency) const
 {
-    auto const & [wall_time, results] = outcome;
     auto const & colors = m_setup.m_colors;
-    auto const num_regular_tests = utils::count_if(results, [](CaseResult const & r) { return is_regular(r.m_type); });
+    auto const num_regular_tests = tally.m_num_regular;
 
     auto & logger = m_setup.m_logger;
     logger
         << colors.colored(Color::good, badge(BadgeType::title)) << " Ran " << num_regular_tests << " test-cases ("
         << utils::WithAdaptiveUnit{wall_time} << " total)" << std::endl;
 
-    std::size_t num_passed = 0ul;
-    for (auto const & result : results) {
-        if (passed(result.m_status)) {
-            num_passed += is_regular(result.m_type);
-        } else {
-            logger << colors.colored(Color::bad, badge(BadgeType::fail)) << ' ' << result.m_name_path << '\n';
-        }
+    auto const num_passed = tally.m_num_passed;
+    for (auto const & name : tally.m_failed) {
+        logger << colors.colored(Color::bad, badge(BadgeType::fail)) << ' ' << name << '\n';
     }
     auto const all_have_passed = (num_passed == num_regular_tests);
     if (num_passed > 0ul) {
@@ -282,9 +896,87 @@ void Conductor::report(Outcome const & outcome) const
             << colors.colored(Color::good, badge(BadgeType::pass)) << " All " << (all_have_passed ? "" : "other ")
             << num_passed << " test-cases\n";
     }
+    if (tally.m_num_cached > 0ul) {
+        logger
+            << colors.colored(Color::good, badge(BadgeType::cached)) << " Of which " << tally.m_num_cached
+            << " test-cases passed in a previous execution of this build\n";
+    }
+    for (auto const & [name, statistics] : tally.m_repeated) {
+        logger
+            << colors.colored(statistics.m_num_failures == 0ul ? Color::good : Color::bad, badge(BadgeType::repeat))
+            << ' ' << name << ": " << statistics.m_num_failures << '/' << statistics.m_num_runs
+            << " runs failed; wall time min " << utils::WithAdaptiveUnit{statistics.m_min} << ", median "
+            << utils::WithAdaptiveUnit{statistics.m_median} << ", max " << utils::WithAdaptiveUnit{statistics.m_max}
+            << '\n';
+    }
+    for (auto const & [name, attempts, status] : tally.m_retried) {
+        logger
+            << colors.colored(passed(status) ? Color::good : Color::bad, badge(BadgeType::retry)) << ' ' << name
+            << ": first attempt " << describe(attempts.m_first) << ", eventually " << describe(status) << " (after "
+            << attempts.m_num_attempts << " attempts)\n";
+    }
+    for (auto const & name : tally.m_quarantined) {
+        logger << colors.colored(Color::bad, badge(BadgeType::quarantine)) << ' ' << name << " (tolerated)\n";
+    }
+    if (interrupted) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Interrupted by a signal; all unstarted test-cases have been skipped." << colors[Color::off]
+            << '\n';
+    } else if (budget.exhausted() and m_setup.m_until_fail) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Cancelled after the first failing run (until-fail); all unstarted runs have been skipped."
+            << colors[Color::off] << '\n';
+    } else if (budget.exhausted()) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Warning: Cancelled after " << budget.limit()
+            << " failing test-cases (fail-fast); all unstarted test-cases have been skipped." << colors[Color::off]
+            << '\n';
+    }
+    if (plan.m_makespan != Plan::Duration{}) {
+        logger
+            << colors.colored(Color::good, badge(BadgeType::title)) << " Makespan "
+            << utils::WithAdaptiveUnit{wall_time} << " (predicted " << utils::WithAdaptiveUnit{plan.m_makespan}
+            << ")\n";
+    }
+    if (concurrency.adaptive()) {
+        auto const timeline = concurrency.timeline();
+        logger << colors.colored(Color::good, badge(BadgeType::title)) << " Workers adapted to CPU utilization:";
+        auto const num_reported = std::min(timeline.size(), max_reported_steps);
+        for (auto i = 0ul; i < num_reported; ++i) {
+            logger
+                << (i == 0ul ? " " : ", ") << timeline[i].m_limit << " at "
+                << utils::WithAdaptiveUnit{timeline[i].m_offset};
+        }
+        if (num_reported < timeline.size()) {
+            logger << " and " << timeline.size() - num_reported << " further changes";
+        }
+        logger << '\n';
+    }
     logger << std::flush;
 }
 
+void Conductor::display_unmet_dependencies_warning(
+    std::vector<framework::Case> const & cases, DependencyGraph const & dependencies) const
+{
+    auto const & colors = m_setup.m_colors;
+    auto & logger = m_setup.m_logger;
+
+    logger
+        << colors[Color::bad] << badge(BadgeType::headline)
+        << " Warning: The dependencies of the following test-cases can't be met (thus they are skipped):\n";
+    for (auto const & [index, path] : dependencies.unresolved()) {
+        logger
+            << badge(BadgeType::empty) << "   - " << cases[index].name().path() << " (no test-case " << path
+            << ")\n";
+    }
+    for (auto const index : dependencies.cyclic()) {
+        logger << badge(BadgeType::empty) << "   - " << cases[index].name().path() << " (dependency cycle)\n";
+    }
+    logger << colors[Color::off] << std::flush;
+}
+
 void Conductor::display_late_registration_warning(std::vector<framework::Case> const & cases) const
 {
     auto const & colors = m_setup.m_colors;
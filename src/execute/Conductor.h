@@ -4,9 +4,17 @@
 #pragma once
 
 #include "Outcome.h"
+#include "ResultSink.h"
+#include "Scheduler.h"
 
 #include <execute/BufferingMode.h>
+#include <execute/IsolationMode.h>
+#include <execute/Listener.h>
+#include <execute/OrderingMode.h>
+#include <execute/PinningMode.h>
+#include <execute/TimeoutMode.h>
 
+#include <functional>
 #include <ostream>
 #include <vector>
 
@@ -16,6 +24,19 @@ class Case;
 namespace clean_test::execute {
 class NameFilter;
 class ColorTable;
+class Concurrency;
+class DependencyGraph;
+class Endpoint;
+class FailureBudget;
+class History;
+class Jobserver;
+class Orchestra;
+class Repetitions;
+class FailureSet;
+class ResultCache;
+class Resumption;
+class Tally;
+class ThreadPool;
 
 /// High level test-case execution orchestration facility.
 class Conductor {
@@ -25,9 +46,62 @@ public:
         std::ostream & m_logger; //!< sink for any reports and status updates.
         ColorTable const & m_colors; //!< coloring details for console output.
         /// Number of worker threads for executing test-cases concurrently. Uses all available CPU cores if set to 0.
+        ///
+        /// Bounds the number of @c m_adaptive_workers (where 0 allows to oversubscribe every core several times).
         std::size_t m_num_workers;
+        /// Whether the number of workers claiming test-cases adapts to the measured CPU utilization (in-process only).
+        bool m_adaptive_workers = false;
         BufferingMode m_buffering; //!< how test observation output is buffered.
-        NameFilter const & m_filter; //!< which tests should be executed and which should be skipped.
+        /// Which tests should be executed and which should be skipped.
+        std::reference_wrapper<NameFilter const> m_filter;
+        SchedulingMode m_scheduling = SchedulingMode::work_stealing; //!< how cases are distributed onto workers.
+        /// Details about previous executions for running the longest test-cases first; disabled if @c nullptr.
+        History const * m_history = nullptr;
+        OrderingMode m_ordering = OrderingMode::duration; //!< which test-cases are started first (given a history).
+        /// Test-cases which passed in previous executions of the same build (thus skipped); disabled if @c nullptr.
+        ResultCache const * m_cache = nullptr;
+        /// Results of an interrupted execution (reported instead of executing the test-cases again, c.f. @c Journal);
+        /// disabled if @c nullptr.
+        Resumption const * m_resumption = nullptr;
+        /// Test-cases whose failures are tolerated (i.e. don't fail the execution); disabled if @c nullptr.
+        FailureSet const * m_quarantine = nullptr;
+        IsolationMode m_isolation = IsolationMode::off; //!< whether cases are executed in separate processes.
+        /// Where workers (of the same test binary) connect to for executing the test-cases, which are distributed onto
+        /// them instead of being executed by this process (c.f. @c execute_distributed); disabled if @c nullptr.
+        Endpoint const * m_coordination = nullptr;
+        /// Binaries whose worker processes execute the (proxy) test-cases instead of this process (c.f.
+        /// @c execute_orchestrated); disabled if @c nullptr.
+        Orchestra const * m_orchestra = nullptr;
+        PinningMode m_pinning = PinningMode::off; //!< whether every worker is bound to a distinct CPU core.
+        /// Persistent threads hosting the (unpinned) workers, e.g. of a @c Runner; fresh ones are started if
+        /// @c nullptr.
+        ThreadPool * m_threads = nullptr;
+        /// Global job budget (e.g. of GNU make) which all but the first worker acquire from; disabled if @c nullptr.
+        Jobserver * m_jobserver = nullptr;
+        /// Budget (in bytes) for test-cases tagged "mem:SIZE". Uses all available memory if set to 0.
+        std::size_t m_memory = 0ul;
+        /// Restrict execution to the (zero-based) shard with this index out of @c m_num_shards.
+        std::size_t m_shard_index = 0ul;
+        /// Number of shards (e.g. concurrently running processes) the test-cases are distributed onto.
+        std::size_t m_num_shards = 1ul;
+        /// Default timeout of test-cases (overridden by their "timeout:SECONDS" tags); 0 disables the timeout.
+        CaseResult::Duration m_timeout = {};
+        TimeoutMode m_on_timeout = TimeoutMode::proceed; //!< how execution continues after a test-case timed out.
+        /// Cancel execution after this many failing test-cases (unstarted ones are skipped); 0 never cancels.
+        std::size_t m_max_failures = 0ul;
+        /// Number of logical copies of every test-case (executed concurrently); results are combined per test-case.
+        std::size_t m_repetitions = 1ul;
+        bool m_until_fail = false; //!< whether execution is cancelled on the first failing run (of any copy).
+        /// Maximum number of times failed (or aborted) test-cases are executed again; only the final attempt counts.
+        std::size_t m_retries = 0ul;
+        /// Whether @c SIGINT and @c SIGTERM drain the execution (rather than terminating, c.f. @c InterruptionSetup).
+        bool m_interruptible = false;
+        /// Additional consumers of all results (while they are being produced).
+        std::vector<ResultSink *> m_sinks = {};
+        /// Observers of all execution events (c.f. @c Listener for the threads they are notified on).
+        std::vector<Listener *> m_listeners = {};
+        /// Whether all results are retained for the returned @c Outcome; else it only holds the total wall time.
+        bool m_retain_results = true;
     };
 
     /// Detailed c'tor: Honor all specified @p setup details.
@@ -36,12 +110,35 @@ public:
     /// Convenience c'tor for internal tests: use automatic coloring, buffering as well as all threads and tests.
     Conductor() noexcept;
 
-    /// Invoke all tests and return collected results.
+    /// Invoke all tests and stream their results into all sinks; returns the collected results (if retained).
+    ///
+    /// Consumes all test-cases of the registry.
     Outcome run() const;
 
+    /// Invoke @p test_cases (rather than consuming the registry) selected by @p filter (rather than the one of the
+    /// setup); otherwise like above.
+    Outcome run(std::vector<framework::Case> test_cases, NameFilter const & filter) const;
+
 private:
-    /// Output final summary about passed and failed results in @p outcome including total wall time.
-    void report(Outcome const & outcome) const;
+    /// Invoke @p test_cases according to @p setup; warns about test-cases registered meanwhile if the registry has been
+    /// @p consumed.
+    Outcome execute(std::vector<framework::Case> test_cases, Setup const & setup, bool consumed) const;
+
+    /// Output final summary about passed and failed results in @p tally including total @p wall_time.
+    ///
+    /// The achieved wall time is compared against the one predicted in @p plan (if any). Mentions if execution has
+    /// been cancelled due to an exhausted failure @p budget (or since it has been @p interrupted) and how the
+    /// (adaptive) @p concurrency evolved.
+    void report(
+        Outcome::Duration wall_time,
+        Tally const & tally,
+        Plan const & plan,
+        FailureBudget const & budget,
+        bool interrupted,
+        Concurrency const & concurrency) const;
+    /// Print warning for @p cases whose @p dependencies can't be met.
+    void display_unmet_dependencies_warning(
+        std::vector<framework::Case> const & cases, DependencyGraph const & dependencies) const;
     /// Print warning for @p cases registered late.
     void display_late_registration_warning(std::vector<framework::Case> const & cases) const;
 
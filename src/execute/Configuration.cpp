@@ -3,9 +3,12 @@
 
 #include "execute/Configuration.h"
 
+#include "Endpoint.h"
+
 #include <array>
 #include <charconv>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 
 namespace clean_test::execute {
@@ -108,7 +111,7 @@ protected:
                 return View{};
             }
             if (candidate[long_knob.size()] != '=') {
-                invalid(candidate);
+                return {}; // another knob with common prefix (e.g. --jobs and --jobserver); reported if unknown.
             }
             return candidate.substr(long_knob.size() + 1);
         }
@@ -135,6 +138,36 @@ protected:
         reference = input;
         return result;
     }
+
+    /// Validate @p input as address of an @c Endpoint.
+    ///
+    /// Report error if this contradicts the previous value for @p description stored in @p reference.
+    static std::string parse_endpoint(View & reference, View const input, View const description)
+    {
+        if (not reference.empty() and reference != input) {
+            contradiction(description, input, reference);
+        }
+        if (not Endpoint::parse(input)) {
+            invalid(description, input);
+        }
+        reference = input;
+        return std::string{input};
+    }
+
+    /// Convert (non-empty) @p input to @c std::filesystem::path.
+    ///
+    /// Report error if this contradicts the previous value for @p description stored in @p reference.
+    static std::filesystem::path parse_path(View & reference, View const input, View const description)
+    {
+        if (not reference.empty() and reference != input) {
+            contradiction(description, input, reference);
+        }
+        if (input.empty()) {
+            invalid(description, input);
+        }
+        reference = input;
+        return std::filesystem::path{input};
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +190,47 @@ public:
         return enables(m_operation, candidate, "--list", 'l');
     }
 
+    std::optional<View> starts_bisect_pollution(View const candidate)
+    {
+        auto const result = starts_option(candidate, "--bisect-pollution");
+        if (result) {
+            if (not m_operation.empty() and m_operation != "--bisect-pollution") {
+                contradiction(candidate, m_operation);
+            }
+            m_operation = "--bisect-pollution";
+        }
+        return result;
+    }
+
+    std::string bisect_pollution(View const candidate)
+    {
+        if (not m_pollution_victim.empty() and m_pollution_victim != candidate) {
+            contradiction("bisect-pollution", candidate, m_pollution_victim);
+        }
+        if (candidate.empty()) {
+            invalid("bisect-pollution", candidate);
+        }
+        m_pollution_victim = candidate;
+        return std::string{candidate};
+    }
+
+    std::optional<View> starts_work_for(View const candidate)
+    {
+        auto const result = starts_option(candidate, "--work-for");
+        if (result) {
+            if (not m_operation.empty() and m_operation != "--work-for") {
+                contradiction(candidate, m_operation);
+            }
+            m_operation = "--work-for";
+        }
+        return result;
+    }
+
+    std::string work_for(View const candidate)
+    {
+        return parse_endpoint(m_coordinator, candidate, "work-for");
+    }
+
     std::optional<View> starts_coloring(View const candidate)
     {
         return starts_option(candidate, "--color");
@@ -225,16 +299,148 @@ public:
         return enables(m_buffering, v, "--buffered", 'b');
     }
 
+    bool enables_isolation(View const v)
+    {
+        return enables(m_isolation, v, "--isolate", 'i');
+    }
+
+    bool enables_pinning(View const v)
+    {
+        return enables(m_pinning, v, "--pin", '\0');
+    }
+
+    bool enables_jobserver(View const v)
+    {
+        return enables(m_jobserver, v, "--jobserver", '\0');
+    }
+
     std::optional<View> starts_threads(View const candidate)
     {
         return starts_option(candidate, "--jobs", 'j');
     }
 
-    std::size_t threads(View const candidate)
+    /// Number of jobs specified by @p candidate; nothing if they are "adaptive".
+    std::optional<std::size_t> threads(View const candidate)
     {
+        if (candidate == "adaptive") {
+            if (not m_threads.empty() and m_threads != candidate) {
+                contradiction("jobs", candidate, m_threads);
+            }
+            m_threads = candidate;
+            return {};
+        }
         return parse_size(m_threads, candidate, "jobs");
     }
 
+    std::optional<View> starts_timeout(View const candidate)
+    {
+        return starts_option(candidate, "--timeout");
+    }
+
+    std::chrono::seconds timeout(View const candidate)
+    {
+        return std::chrono::seconds{parse_size(m_timeout, candidate, "timeout")};
+    }
+
+    std::optional<View> starts_on_timeout(View const candidate)
+    {
+        return starts_option(candidate, "--on-timeout");
+    }
+
+    TimeoutMode on_timeout(View const specification)
+    {
+        using T = TimeoutMode;
+        static auto const lookup = std::unordered_map<View, T>{{"proceed", T::proceed}, {"terminate", T::terminate}};
+        if (auto const pos = lookup.find(specification); pos != lookup.cend()) {
+            if (not m_on_timeout.first.empty() and m_on_timeout.second != pos->second) {
+                contradiction("on-timeout", m_on_timeout.first, pos->first);
+            }
+            m_on_timeout = *pos;
+            return pos->second;
+        }
+        invalid("on-timeout", specification);
+    }
+
+    std::optional<View> starts_fail_fast(View const candidate)
+    {
+        return starts_option(candidate, "--fail-fast");
+    }
+
+    /// Parse the (optional) number of failures for cancelling execution; without any number, the first one cancels.
+    std::size_t fail_fast(View const candidate)
+    {
+        auto const result = parse_size(m_fail_fast, candidate.empty() ? View{"1"} : candidate, "fail-fast");
+        if (result == 0ul) {
+            invalid("fail-fast", candidate);
+        }
+        return result;
+    }
+
+    std::optional<View> starts_repeat(View const candidate)
+    {
+        return starts_option(candidate, "--repeat");
+    }
+
+    std::size_t repeat(View const candidate)
+    {
+        auto const result = parse_size(m_repeat, candidate, "repeat");
+        if (result == 0ul) {
+            invalid("repeat", candidate);
+        }
+        return result;
+    }
+
+    bool enables_until_fail(View const candidate)
+    {
+        return enables(m_until_fail, candidate, "--until-fail", '\0');
+    }
+
+    std::optional<View> starts_retries(View const candidate)
+    {
+        return starts_option(candidate, "--retries");
+    }
+
+    std::size_t retries(View const candidate)
+    {
+        return parse_size(m_retries, candidate, "retries");
+    }
+
+    std::optional<View> starts_quarantine(View const candidate)
+    {
+        return starts_option(candidate, "--quarantine");
+    }
+
+    std::filesystem::path quarantine(View const candidate)
+    {
+        return parse_path(m_quarantine, candidate, "quarantine");
+    }
+
+    std::optional<View> starts_shard(View const candidate)
+    {
+        return starts_option(candidate, "--shard");
+    }
+
+    /// Parse (one-based) shard "i/n" into its zero-based index and the number of shards.
+    std::pair<std::size_t, std::size_t> shard(View const candidate)
+    {
+        auto const separator = candidate.find('/');
+        if (separator == View::npos) {
+            invalid("shard", candidate);
+        }
+        auto index_reference = View{};
+        auto count_reference = View{};
+        auto const index = parse_size(index_reference, candidate.substr(0ul, separator), "shard");
+        auto const count = parse_size(count_reference, candidate.substr(separator + 1ul), "shard");
+        if (index == 0ul or index > count) {
+            invalid("shard", candidate);
+        }
+        if (not m_shard.empty() and m_shard != candidate) {
+            contradiction("shard", candidate, m_shard);
+        }
+        m_shard = candidate;
+        return {index - 1ul, count};
+    }
+
     std::optional<View> starts_report(View const candidate)
     {
         return starts_option(candidate, "--report");
@@ -261,6 +467,108 @@ public:
         return {Report::JUnit, checked(candidate)};
     }
 
+    std::optional<View> starts_history(View const candidate)
+    {
+        return starts_option(candidate, "--history");
+    }
+
+    std::filesystem::path history(View const candidate)
+    {
+        return parse_path(m_history, candidate, "history");
+    }
+
+    std::optional<View> starts_order(View const candidate)
+    {
+        return starts_option(candidate, "--order");
+    }
+
+    OrderingMode order(View const specification)
+    {
+        using O = OrderingMode;
+        static auto const lookup = std::unordered_map<View, O>{{"duration", O::duration}, {"risk", O::risk}};
+        if (auto const pos = lookup.find(specification); pos != lookup.cend()) {
+            if (not m_order.first.empty() and m_order.second != pos->second) {
+                contradiction("order", m_order.first, pos->first);
+            }
+            m_order = *pos;
+            return pos->second;
+        }
+        invalid("order", specification);
+    }
+
+    std::optional<View> starts_failures(View const candidate)
+    {
+        return starts_option(candidate, "--failures");
+    }
+
+    std::filesystem::path failures(View const candidate)
+    {
+        return parse_path(m_failures, candidate, "failures");
+    }
+
+    bool enables_rerun_failed(View const candidate)
+    {
+        return enables(m_rerun_failed, candidate, "--rerun-failed", '\0');
+    }
+
+    std::optional<View> starts_cache(View const candidate)
+    {
+        return starts_option(candidate, "--cache");
+    }
+
+    std::filesystem::path cache(View const candidate)
+    {
+        return parse_path(m_cache, candidate, "cache");
+    }
+
+    std::optional<View> starts_journal(View const candidate)
+    {
+        return starts_option(candidate, "--journal");
+    }
+
+    std::filesystem::path journal(View const candidate)
+    {
+        return parse_path(m_journal, candidate, "journal");
+    }
+
+    bool enables_resume(View const candidate)
+    {
+        return enables(m_resume, candidate, "--resume", '\0');
+    }
+
+    std::optional<View> starts_coordinate(View const candidate)
+    {
+        return starts_option(candidate, "--coordinate");
+    }
+
+    std::string coordinate(View const candidate)
+    {
+        return parse_endpoint(m_coordination, candidate, "coordinate");
+    }
+
+    /// Check consistency of the arguments parsed into @p cfg (after all of them have been parsed).
+    void validate(Configuration const & cfg) const
+    {
+        if (cfg.m_rerun_failed and cfg.m_failures_path.empty()) {
+            error("Missing mandatory details for rerun-failed: specify the recorded --failures.");
+        }
+        if (cfg.m_until_fail and cfg.m_repetitions <= 1ul) {
+            error("Missing mandatory details for until-fail: specify the maximum number of --repeat(itions).");
+        }
+        if (cfg.m_resume and cfg.m_journal_path.empty()) {
+            error("Missing mandatory details for resume: specify the --journal.");
+        }
+        if (cfg.m_operation == OperationMode::bisect and cfg.m_journal_path.empty()) {
+            error("Missing mandatory details for bisect-pollution: specify the recorded --journal.");
+        }
+        if (cfg.m_ordering == OrderingMode::risk and cfg.m_history_path.empty()) {
+            error("Missing mandatory details for order=risk: specify the --history.");
+        }
+        if (cfg.m_operation == OperationMode::work and not cfg.m_coordination.empty()) {
+            contradiction("--coordinate", "--work-for");
+        }
+    }
+
     std::optional<View> starts_depth(View const candidate)
     {
         return starts_option(candidate, "--depth", 'd');
@@ -271,6 +579,25 @@ public:
         return parse_size(m_depth, candidate, "depth");
     }
 
+    std::optional<View> starts_format(View const candidate)
+    {
+        return starts_option(candidate, "--format");
+    }
+
+    ListingFormat format(View const specification)
+    {
+        using L = ListingFormat;
+        static auto const lookup = std::unordered_map<View, L>{{"tree", L::tree}, {"names", L::names}};
+        if (auto const pos = lookup.find(specification); pos != lookup.cend()) {
+            if (not m_format.first.empty() and m_format.second != pos->second) {
+                contradiction("format", m_format.first, pos->first);
+            }
+            m_format = *pos;
+            return pos->second;
+        }
+        invalid("format", specification);
+    }
+
     [[noreturn]] void unknown_argument(View const v)
     {
         invalid(v);
@@ -278,11 +605,33 @@ public:
 
 private:
     View m_operation;
+    View m_pollution_victim;
+    View m_coordinator;
     std::pair<View, ColoringMode> m_coloring;
     View m_buffering;
+    View m_isolation;
+    View m_pinning;
+    View m_jobserver;
     View m_threads;
+    View m_timeout;
+    std::pair<View, TimeoutMode> m_on_timeout;
+    View m_fail_fast;
+    View m_repeat;
+    View m_until_fail;
+    View m_retries;
+    View m_quarantine;
+    View m_shard;
     View m_report;
+    View m_history;
+    std::pair<View, OrderingMode> m_order;
+    View m_failures;
+    View m_rerun_failed;
+    View m_cache;
+    View m_journal;
+    View m_resume;
+    View m_coordination;
     View m_depth;
+    std::pair<View, ListingFormat> m_format;
 };
 
 }
@@ -313,6 +662,16 @@ Configuration Configuration::parse(int const argc, char const * const * const ar
             result.m_operation = OperationMode::list;
             ++numHandlers;
         }
+        if (auto victim = parser.starts_bisect_pollution(v); victim) {
+            result.m_operation = OperationMode::bisect;
+            result.m_pollution_victim = parser.bisect_pollution(option(*victim, "bisect-pollution"));
+            ++numHandlers;
+        }
+        if (auto coordinator = parser.starts_work_for(v); coordinator) {
+            result.m_operation = OperationMode::work;
+            result.m_coordinator = parser.work_for(option(*coordinator, "work-for"));
+            ++numHandlers;
+        }
         if (auto coloring = parser.starts_coloring(v); coloring) {
             result.m_coloring = parser.coloring(option(*coloring, "color"));
             ++numHandlers;
@@ -325,8 +684,54 @@ Configuration Configuration::parse(int const argc, char const * const * const ar
             result.m_buffering = BufferingMode::testcase;
             ++numHandlers;
         }
+        if (parser.enables_isolation(v)) {
+            result.m_isolation = IsolationMode::process;
+            ++numHandlers;
+        }
+        if (parser.enables_pinning(v)) {
+            result.m_pinning = PinningMode::cores;
+            ++numHandlers;
+        }
+        if (parser.enables_jobserver(v)) {
+            result.m_jobserver = true;
+            ++numHandlers;
+        }
         if (auto threads = parser.starts_threads(v); threads) {
-            result.m_num_jobs = parser.threads(option(*threads, "threads"));
+            auto const num_jobs = parser.threads(option(*threads, "threads"));
+            result.m_num_jobs = num_jobs.value_or(0ul);
+            result.m_adaptive_jobs = not num_jobs;
+            ++numHandlers;
+        }
+        if (auto timeout = parser.starts_timeout(v); timeout) {
+            result.m_timeout = parser.timeout(option(*timeout, "timeout"));
+            ++numHandlers;
+        }
+        if (auto on_timeout = parser.starts_on_timeout(v); on_timeout) {
+            result.m_on_timeout = parser.on_timeout(option(*on_timeout, "on-timeout"));
+            ++numHandlers;
+        }
+        if (auto fail_fast = parser.starts_fail_fast(v); fail_fast) {
+            result.m_max_failures = parser.fail_fast(*fail_fast);
+            ++numHandlers;
+        }
+        if (auto repeat = parser.starts_repeat(v); repeat) {
+            result.m_repetitions = parser.repeat(option(*repeat, "repeat"));
+            ++numHandlers;
+        }
+        if (parser.enables_until_fail(v)) {
+            result.m_until_fail = true;
+            ++numHandlers;
+        }
+        if (auto retries = parser.starts_retries(v); retries) {
+            result.m_retries = parser.retries(option(*retries, "retries"));
+            ++numHandlers;
+        }
+        if (auto quarantine = parser.starts_quarantine(v); quarantine) {
+            result.m_quarantine_path = parser.quarantine(option(*quarantine, "quarantine"));
+            ++numHandlers;
+        }
+        if (auto shard = parser.starts_shard(v); shard) {
+            std::tie(result.m_shard_index, result.m_num_shards) = parser.shard(option(*shard, "shard"));
             ++numHandlers;
         }
         if (auto report = parser.starts_report(v); report) {
@@ -334,14 +739,51 @@ Configuration Configuration::parse(int const argc, char const * const * const ar
             report_sink(result, type) = destination;
             ++numHandlers;
         }
+        if (auto history = parser.starts_history(v); history) {
+            result.m_history_path = parser.history(option(*history, "history"));
+            ++numHandlers;
+        }
+        if (auto order = parser.starts_order(v); order) {
+            result.m_ordering = parser.order(option(*order, "order"));
+            ++numHandlers;
+        }
+        if (auto failures = parser.starts_failures(v); failures) {
+            result.m_failures_path = parser.failures(option(*failures, "failures"));
+            ++numHandlers;
+        }
+        if (parser.enables_rerun_failed(v)) {
+            result.m_rerun_failed = true;
+            ++numHandlers;
+        }
+        if (auto cache = parser.starts_cache(v); cache) {
+            result.m_cache_path = parser.cache(option(*cache, "cache"));
+            ++numHandlers;
+        }
+        if (auto journal = parser.starts_journal(v); journal) {
+            result.m_journal_path = parser.journal(option(*journal, "journal"));
+            ++numHandlers;
+        }
+        if (parser.enables_resume(v)) {
+            result.m_resume = true;
+            ++numHandlers;
+        }
+        if (auto coordination = parser.starts_coordinate(v); coordination) {
+            result.m_coordination = parser.coordinate(option(*coordination, "coordinate"));
+            ++numHandlers;
+        }
         if (auto depth = parser.starts_depth(v); depth) {
             result.m_depth = parser.depth(option(*depth, "depth"));
             ++numHandlers;
         }
+        if (auto format = parser.starts_format(v); format) {
+            result.m_listing = parser.format(option(*format, "format"));
+            ++numHandlers;
+        }
         if (numHandlers != (ParserUtilities::is_short_knob(v) ? v.size() - 1u : 1u)) {
             parser.unknown_argument(v);
         }
     }
+    parser.validate(result);
     return result;
 }
 
@@ -0,0 +1,108 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Dependencies.h"
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto dependency_tag_prefix = std::string_view{"after:"};
+
+/// Paths of all test-cases (with their index) in lexicographical order.
+using PathIndex = std::vector<std::pair<std::string_view, std::size_t>>;
+
+/// Indices of the test-case with @p path or of all test-cases of the test-suite with @p path (from @p paths).
+std::vector<std::size_t> lookup(PathIndex const & paths, std::string_view const path)
+{
+    auto result = std::vector<std::size_t>{};
+    for (auto pos = std::lower_bound(paths.cbegin(), paths.cend(), std::pair{path, std::size_t{0}});
+         pos != paths.cend() and pos->first.starts_with(path);
+         ++pos) {
+        // Exclude siblings sharing a prefix, e.g. "ab" isn't part of the test-suite "a".
+        auto const rest = pos->first.substr(path.size());
+        if (rest.empty() or rest.starts_with(framework::Name::separator)) {
+            result.emplace_back(pos->second);
+        }
+    }
+    return result;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::string_view> prerequisites(framework::Name const & name)
+{
+    auto result = std::vector<std::string_view>{};
+    for (auto const & tag : name.tags()) {
+        auto const text = static_cast<std::string_view>(tag);
+        if (text.starts_with(dependency_tag_prefix) and text.size() > dependency_tag_prefix.size()) {
+            result.emplace_back(text.substr(dependency_tag_prefix.size()));
+        }
+    }
+    return result;
+}
+
+DependencyGraph::DependencyGraph(framework::Registry const & cases) :
+    m_prerequisites(cases.size()), m_satisfiable(cases.size(), true)
+{
+    auto paths = PathIndex{};
+    paths.reserve(cases.size());
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        paths.emplace_back(cases[i].name().path(), i);
+    }
+    std::sort(paths.begin(), paths.end());
+
+    // Resolve all dependencies (and collect the reverse edges for the topological sort below).
+    auto dependents = std::vector<std::vector<std::size_t>>(cases.size());
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        auto & direct = m_prerequisites[i];
+        for (auto const path : execute::prerequisites(cases[i].name())) {
+            m_empty = false;
+            auto const found = lookup(paths, path);
+            if (found.empty()) {
+                m_unresolved.emplace_back(Unresolved{i, path});
+                m_satisfiable[i] = false;
+            }
+            std::copy_if(found.cbegin(), found.cend(), std::back_inserter(direct), [i](auto const p) {
+                return p != i;
+            });
+        }
+        std::sort(direct.begin(), direct.end());
+        direct.erase(std::unique(direct.begin(), direct.end()), direct.end());
+        for (auto const p : direct) {
+            dependents[p].emplace_back(i);
+        }
+    }
+
+    // Topological sort (c.f. Kahn): Whatever can't be sorted is part of (or depends on) a cycle.
+    auto num_pending = std::vector<std::size_t>(cases.size());
+    auto ready = std::deque<std::size_t>{};
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        num_pending[i] = m_prerequisites[i].size();
+        if (num_pending[i] == 0ul) {
+            ready.emplace_back(i);
+        }
+    }
+    while (not ready.empty()) {
+        auto const current = ready.front();
+        ready.pop_front();
+        for (auto const d : dependents[current]) {
+            if (--num_pending[d] == 0ul) {
+                ready.emplace_back(d);
+            }
+        }
+    }
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        if (num_pending[i] > 0ul) {
+            m_cyclic.emplace_back(i);
+            m_satisfiable[i] = false;
+        }
+    }
+}
+
+}
@@ -0,0 +1,77 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <framework/Name.h>
+#include <framework/Registry.h>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Paths of the test-cases (or test-suites) the test-case of @p name depends on (as declared by its "after:PATH" tags).
+std::vector<std::string_view> prerequisites(framework::Name const & name);
+
+/// Dependencies between test-cases (by index) as declared by their "after:PATH" tags.
+///
+/// A test-case depends on the test-case with the (full) PATH or on all test-cases of the test-suite with that PATH
+/// (except itself). It becomes ready to be executed once all of its dependencies finished; it only passes them if all
+/// of them passed. Test-cases with dependencies which can never be met (i.e. on a PATH without any test-case or those
+/// which are part of a cycle) are unsatisfiable.
+class DependencyGraph {
+public:
+    /// An unresolvable dependency: the test-case with index @c m_case depends on @c m_path without any test-case.
+    class Unresolved {
+    public:
+        std::size_t m_case;
+        std::string_view m_path;
+    };
+
+    /// Default c'tor: Without any dependencies.
+    DependencyGraph() = default;
+
+    /// Detailed c'tor: Resolve the dependencies of all @p cases.
+    explicit DependencyGraph(framework::Registry const & cases);
+
+    /// Whether no test-case has any dependencies at all.
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_empty;
+    }
+
+    /// Indices of all test-cases the test-case with @p index depends on (directly).
+    [[nodiscard]] std::vector<std::size_t> const & prerequisites(std::size_t const index) const
+    {
+        return m_prerequisites[index];
+    }
+
+    /// Whether the dependencies of the test-case with @p index can be met at all.
+    [[nodiscard]] bool satisfiable(std::size_t const index) const
+    {
+        return m_satisfiable[index];
+    }
+
+    /// All dependencies which couldn't be resolved (ordered by the test-cases).
+    [[nodiscard]] std::vector<Unresolved> const & unresolved() const noexcept
+    {
+        return m_unresolved;
+    }
+
+    /// Indices of all test-cases which are part of (or depend on) a cycle of dependencies.
+    [[nodiscard]] std::vector<std::size_t> const & cyclic() const noexcept
+    {
+        return m_cyclic;
+    }
+
+private:
+    bool m_empty = true;
+    std::vector<std::vector<std::size_t>> m_prerequisites = {}; //!< by index of test-case.
+    std::vector<bool> m_satisfiable = {}; //!< by index of test-case.
+    std::vector<Unresolved> m_unresolved = {};
+    std::vector<std::size_t> m_cyclic = {};
+};
+
+}
@@ -0,0 +1,607 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Distribution.h"
+
+#include "Badges.h"
+#include "BuildId.h"
+#include "CaseEvaluator.h"
+#include "CaseReporter.h"
+#include "Frames.h"
+#include "Journal.h"
+#include "NameFilter.h"
+#include "Resources.h"
+#include "Retries.h"
+#include "Scheduler.h"
+#include "Serialization.h"
+#include "Watchdog.h"
+
+#include <framework/Cancellation.h>
+
+#include <utils/OSyncStream.h>
+
+#if __has_include(<poll.h>) and __has_include(<sys/socket.h>) and __has_include(<unistd.h>)
+# define CLEANTEST_HAS_DISTRIBUTION 1
+# include <poll.h>
+# include <sys/socket.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_DISTRIBUTION 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace clean_test::execute {
+namespace {
+
+/// Leading part of the @c greeting of every worker.
+constexpr auto greeting_tag = std::string_view{"clean-test worker"};
+
+#if CLEANTEST_HAS_DISTRIBUTION
+
+using Clock = DeadlineClock;
+
+/// Maximum number of test-cases handed out to a worker at once.
+constexpr auto max_batch_size = 16ul;
+
+/// Patience of workers for reaching their coordinator (which may be started after them).
+constexpr auto connection_patience = std::chrono::seconds{10};
+
+
+/// Coordinator of a distributed execution: Hands out test-cases to the connected workers, which execute them remotely.
+///
+/// Single-threaded: All sockets are multiplexed by polling them.
+class Coordinator {
+public:
+    Coordinator(
+        framework::Registry & cases,
+        Plan const & plan,
+        DependencyGraph const & dependencies,
+        Conductor::Setup const & setup,
+        ResultPipeline & results,
+        FailureBudget & budget,
+        Repetitions & repetitions) :
+        m_cases{cases},
+        m_setup{setup},
+        m_endpoint{*setup.m_coordination},
+        m_scheduler{make_scheduler(SchedulingMode::shared_cursor, plan, 1ul)},
+        m_resources{*m_scheduler, repetitions, requirements(cases, setup.m_filter), dependencies, setup.m_memory},
+        m_reporter{{.m_output = setup.m_logger, .m_colors = setup.m_colors, .m_buffering = setup.m_buffering}},
+        m_results{results},
+        m_budget{budget},
+        m_repetitions{repetitions},
+        m_retries{cases.size(), setup.m_retries, setup.m_quarantine},
+        m_num_pending{repetitions.num_copies()},
+        m_listener{m_endpoint.listen()}
+    {
+        m_setup.m_logger << m_setup.m_colors[Color::good] << badge(BadgeType::headline) << m_setup.m_colors[Color::off]
+                         << " Coordinating workers on " << m_endpoint.address() << std::endl;
+    }
+
+    ~Coordinator()
+    {
+        // An empty batch tells the workers to finish.
+        auto finished = std::string{};
+        encode_integer(finished, 0ul);
+        for (auto const & connection : m_connections) {
+            static_cast<void>(write_frame(connection.m_fd, finished));
+            ::close(connection.m_fd);
+        }
+        ::close(m_listener);
+        m_endpoint.remove();
+    }
+
+    // non-copyable and non-movable
+    Coordinator(Coordinator &&) = delete;
+    Coordinator & operator=(Coordinator &&) = delete;
+    Coordinator(Coordinator const &) = delete;
+    Coordinator & operator=(Coordinator const &) = delete;
+
+    void run() &&
+    {
+        while (true) {
+            for (auto & connection : m_connections) {
+                if (connection.m_fd >= 0 and connection.m_welcomed and connection.m_batch.empty()) {
+                    dispatch(connection);
+                }
+            }
+            if (finished()) {
+                break;
+            }
+            await();
+        }
+    }
+
+private:
+    /// Connection to one worker and the test-cases handed out to it.
+    class Connection {
+    public:
+        int m_fd = -1; //!< connected socket; -1 once closed.
+        bool m_welcomed = false; //!< whether the peer greeted as worker of this build (c.f. @c greeting).
+        std::size_t m_worker = 0ul; //!< number of the worker (counting all workers welcomed before).
+        FrameBuffer m_received = {}; //!< data received from the worker (possibly ending in an incomplete frame).
+        std::deque<std::size_t> m_batch = {}; //!< copies handed out but not finished (the first one is in progress).
+        Clock::time_point m_start = {}; //!< when evaluation of the first copy of @c m_batch started.
+        CaseResult::Duration m_timeout = {}; //!< limit for evaluating the first copy of @c m_batch (0 for unlimited).
+    };
+
+    /// Claim the next copy to be executed by a worker: Test-cases which are skipped or have been executed previously
+    /// are handed on right away. Nothing if no copy is available (right now).
+    std::optional<std::size_t> claim()
+    {
+        if (m_lookahead) {
+            return std::exchange(m_lookahead, std::nullopt);
+        }
+        while (not m_stopped) {
+            auto const copy = m_resources.next(0ul).m_copy;
+            if (not copy) {
+                break;
+            }
+            --m_num_pending;
+            auto const index = m_repetitions.case_index(*copy);
+            auto & tc = m_cases[index];
+            if (framework::cancellation_requested() or not static_cast<bool>(m_setup.m_filter(tc.name()))
+                or not m_resources.satisfied(index)) {
+                deliver(*copy, CaseResult{std::string{tc.name().path()}, CaseStatus::skip, CaseResult::Duration{}, {}});
+                m_resources.release(index);
+                continue;
+            }
+            if (auto previous = previous_result(tc.name(), m_setup.m_resumption, m_setup.m_cache); previous) {
+                deliver(*copy, std::move(*previous));
+                m_resources.release(index);
+                continue;
+            }
+            return copy;
+        }
+        return {};
+    }
+
+    /// Hand out the next batch of copies to (idle) @p connection (if there are any available).
+    ///
+    /// Batches shrink with the number of remaining copies (guided self-scheduling), s.t. all workers finish together.
+    void dispatch(Connection & connection)
+    {
+        auto const size = std::clamp(m_num_pending / (2ul * m_connections.size()), 1ul, max_batch_size);
+        auto request = std::string{};
+        while (connection.m_batch.size() < size) {
+            auto const copy = claim();
+            if (not copy) {
+                break;
+            }
+            encode_text(request, m_cases[m_repetitions.case_index(*copy)].name().path());
+            connection.m_batch.emplace_back(*copy);
+        }
+        if (connection.m_batch.empty()) {
+            return;
+        }
+
+        auto batch = std::string{};
+        encode_integer(batch, connection.m_batch.size());
+        batch += request;
+        start(connection);
+        if (not write_frame(connection.m_fd, batch)) {
+            close(connection); // the worker vanished before starting any of them
+        }
+    }
+
+    /// Start the timeout for the first copy of the batch of @p connection (announcing it to all listeners).
+    void start(Connection & connection)
+    {
+        connection.m_start = Clock::now();
+        auto const & tc = m_cases[m_repetitions.case_index(connection.m_batch.front())];
+        connection.m_timeout = timeout(tc.name(), m_setup.m_timeout);
+        announce(tc.name().path());
+    }
+
+    /// Whether all copies have been finished (or no further ones should be handed out).
+    bool finished()
+    {
+        auto const busy = std::any_of(m_connections.cbegin(), m_connections.cend(), [](Connection const & c) {
+            return not c.m_batch.empty();
+        });
+        if (busy) {
+            return false;
+        }
+        if (not m_lookahead) {
+            m_lookahead = claim(); // nothing is running, i.e. nothing can be pending on resources either.
+        }
+        return not m_lookahead;
+    }
+
+    /// Wait for new connections, results or disconnections of workers (or the expiry of a timeout).
+    void await()
+    {
+        auto fds = std::vector<::pollfd>{{.fd = m_listener, .events = POLLIN, .revents = 0}};
+        for (auto const & connection : m_connections) {
+            fds.emplace_back(::pollfd{.fd = connection.m_fd, .events = POLLIN, .revents = 0});
+        }
+        if (::poll(fds.data(), fds.size(), poll_timeout()) < 0) {
+            if (errno != EINTR) {
+                throw std::runtime_error{"Failed to wait for workers of distributed execution."};
+            }
+            return;
+        }
+
+        for (auto c = 0ul; c < m_connections.size(); ++c) {
+            if (fds[c + 1ul].revents != 0) {
+                receive(m_connections[c]);
+            }
+        }
+        auto const now = Clock::now();
+        for (auto & connection : m_connections) {
+            if (not connection.m_batch.empty() and connection.m_timeout != CaseResult::Duration{}
+                and connection.m_start + connection.m_timeout <= now) {
+                expired(connection);
+            }
+        }
+        std::erase_if(m_connections, [](Connection const & connection) { return connection.m_fd < 0; });
+
+        if (fds.front().revents != 0) {
+            accept();
+        }
+    }
+
+    /// Milliseconds until the earliest deadline of any busy worker; -1 (i.e. infinite) if there is no deadline.
+    int poll_timeout() const
+    {
+        auto result = -1;
+        auto const now = Clock::now();
+        for (auto const & connection : m_connections) {
+            if (not connection.m_batch.empty() and connection.m_timeout != CaseResult::Duration{}) {
+                auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                                           connection.m_start + connection.m_timeout - now)
+                                           .count();
+                auto const bounded = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, 1'000'000));
+                result = (result < 0) ? bounded : std::min(result, bounded);
+            }
+        }
+        return result;
+    }
+
+    /// Accept connection of a new peer (which must greet as worker before being handed out any test-cases).
+    void accept()
+    {
+        auto const fd = ::accept(m_listener, nullptr, nullptr);
+        if (fd < 0) {
+            return; // e.g. aborted by the worker in the meantime
+        }
+        m_connections.emplace_back(Connection{.m_fd = fd});
+    }
+
+    /// Import all frames which arrived at @p connection (or handle the disconnection of its worker).
+    void receive(Connection & connection)
+    {
+        auto const open = connection.m_received.fill(connection.m_fd);
+        while (connection.m_fd >= 0) {
+            auto const frame = connection.m_received.next();
+            if (not frame) {
+                break;
+            }
+            if (connection.m_welcomed) {
+                collect(connection, *frame);
+            } else {
+                welcome(connection, *frame);
+            }
+        }
+        if (not open and connection.m_fd >= 0) {
+            disconnected(connection);
+        }
+    }
+
+    /// Accept the peer of @p connection as worker if its first @p frame greets with the build-id of this process.
+    ///
+    /// Any other peer (e.g. a port scanner or a worker of another build) is disconnected without any test-cases.
+    void welcome(Connection & connection, std::string_view const frame)
+    {
+        if (greeted_build(frame) != m_build_id) {
+            m_setup.m_logger << m_setup.m_colors[Color::bad] << badge(BadgeType::headline)
+                             << " Warning: Rejected connection of a peer which isn't a worker of this build."
+                             << m_setup.m_colors[Color::off] << std::endl;
+            close(connection);
+            return;
+        }
+        connection.m_welcomed = true;
+        connection.m_worker = m_num_welcomed++;
+    }
+
+    /// Import the result of the first copy of the batch of @p connection from @p frame (and start the next copy).
+    ///
+    /// Workers sending anything else (e.g. anything while idle) are treated as disconnected.
+    void collect(Connection & connection, std::string_view frame)
+    {
+        if (connection.m_batch.empty()) {
+            disconnected(connection); // idle workers mustn't send anything
+            return;
+        }
+
+        auto result = std::optional<CaseResult>{};
+        auto console = std::string_view{};
+        try {
+            result = decode_result(frame);
+            console = decode_text(frame);
+        } catch (std::runtime_error const &) {
+            disconnected(connection);
+            return;
+        }
+        result->m_worker = connection.m_worker;
+        utils::OSyncStream{m_setup.m_logger} << console;
+        replay(*result);
+        finish(connection, std::move(*result));
+        if (not connection.m_batch.empty()) {
+            start(connection);
+        }
+    }
+
+    /// Hand on @p result of the first copy of the batch of @p connection (and remove it from there).
+    void finish(Connection & connection, CaseResult result)
+    {
+        auto const copy = connection.m_batch.front();
+        connection.m_batch.pop_front();
+        deliver(copy, std::move(result));
+        m_resources.release(m_repetitions.case_index(copy));
+    }
+
+    /// Close @p connection, handing out its unstarted copies once more (to other workers).
+    void close(Connection & connection)
+    {
+        ::close(std::exchange(connection.m_fd, -1));
+        for (auto pos = connection.m_batch.crbegin(); pos != connection.m_batch.crend(); ++pos) {
+            ++m_num_pending;
+            m_resources.retry(*pos);
+            m_resources.release(m_repetitions.case_index(*pos));
+        }
+        connection.m_batch.clear();
+    }
+
+    /// Report worker of @p connection as disconnected while evaluating its current copy (if any).
+    void disconnected(Connection & connection)
+    {
+        if (not connection.m_batch.empty()) {
+            auto const & tc = m_cases[m_repetitions.case_index(connection.m_batch.front())];
+            auto details = std::ostringstream{};
+            details << "Worker " << connection.m_worker << " disconnected while evaluating the test-case.";
+            auto observation
+                = Observation{{"unknown", 0u}, ObservationStatus::fail_asserted, std::move(details).str(), {}};
+            m_reporter(CaseReporter::Start{tc.name().path()});
+            m_reporter(observation);
+            auto result = CaseResult{
+                std::string{tc.name().path()},
+                CaseStatus::abort,
+                elapsed_since(connection.m_start),
+                {std::move(observation)}};
+            result.m_worker = connection.m_worker;
+            m_reporter(CaseReporter::Stop{result.m_name_path, result.m_wall_time, result.m_status});
+            replay(result);
+            finish(connection, std::move(result));
+        }
+        close(connection);
+    }
+
+    /// Abandon worker of @p connection which exceeded the timeout of its current copy (and stop, depending on setup).
+    ///
+    /// The worker can't be killed remotely: Disconnecting it stops it once the test-case eventually finishes.
+    void expired(Connection & connection)
+    {
+        auto busy = std::vector<Activity>{};
+        for (auto const & other : m_connections) {
+            if (not other.m_batch.empty()) {
+                auto const name = m_cases[m_repetitions.case_index(other.m_batch.front())].name().path();
+                busy.emplace_back(Activity{other.m_worker, name, elapsed_since(other.m_start)});
+            }
+        }
+        auto const name = m_cases[m_repetitions.case_index(connection.m_batch.front())].name().path();
+        report_timeout(m_setup, name, connection.m_timeout, std::move(busy));
+
+        auto result = timeout_result(name, connection.m_timeout);
+        result.m_worker = connection.m_worker;
+        replay(result);
+        finish(connection, std::move(result));
+        close(connection);
+
+        switch (m_setup.m_on_timeout) {
+            case TimeoutMode::proceed:
+                break;
+            case TimeoutMode::terminate:
+                m_stopped = true;
+                break;
+            default:
+                std::terminate();
+        }
+    }
+
+    /// Hand @p result of executing @p copy on to the @c m_results (accounting for it in the @c m_budget and settling it
+    /// for its dependents).
+    ///
+    /// Failed attempts are handed out once more instead (c.f. @c m_retries), s.t. the next idle worker retries them.
+    /// Results of repeated test-cases are collected in @c m_repetitions instead (for combining them later).
+    void deliver(std::size_t const copy, CaseResult result)
+    {
+        if (m_retries.retry(copy, result)) {
+            ++m_num_pending;
+            m_resources.retry(copy);
+            return;
+        }
+        result = m_retries.finish(copy, std::move(result));
+        m_budget.account(result);
+        m_resources.settle(copy, result.m_status);
+        if (m_repetitions.aggregates()) {
+            m_repetitions.add(copy, std::move(result));
+        } else {
+            m_results.push(std::move(result));
+        }
+    }
+
+    /// Notify all listeners about the start of the test-case with @p name (once its worker is expected to start it).
+    ///
+    /// A @c Journal thus knows about the test-case before its result arrives (in case the coordinator dies meanwhile).
+    void announce(std::string_view const name) const
+    {
+        for (auto * listener : m_setup.m_listeners) {
+            listener->on_case_start(name);
+        }
+    }
+
+    /// Notify all listeners about the remaining events of @p result (which occurred in a worker, c.f. @c announce).
+    void replay(CaseResult const & result) const
+    {
+        auto const name = std::string_view{result.m_name_path};
+        for (auto * listener : m_setup.m_listeners) {
+            for (auto const & observation : result.m_observations) {
+                listener->on_observation(name, observation);
+            }
+            listener->on_case_stop(name, result.m_status, result.m_wall_time);
+        }
+    }
+
+    framework::Registry & m_cases;
+    Conductor::Setup const & m_setup;
+    Endpoint const & m_endpoint;
+    std::unique_ptr<Scheduler> m_scheduler;
+    ResourceScheduler m_resources; //!< hands out copies of @c m_scheduler once their resources are available.
+    /// Output facility for disconnections (everything else is reported by the workers); listeners are notified
+    /// separately.
+    CaseReporter m_reporter;
+    IgnoreBrokenPipes const m_ignore_broken_pipes = {};
+    ResultPipeline & m_results;
+    FailureBudget & m_budget;
+    Repetitions & m_repetitions; //!< maps planned copies to test-cases and collects results of repeated ones.
+    Retries m_retries; //!< decides which failed test-cases are executed again.
+    std::size_t m_num_pending; //!< number of copies which haven't been handed out (yet).
+    std::optional<std::size_t> m_lookahead = {}; //!< copy claimed (for checking completion) but not handed out.
+    int const m_listener; //!< socket accepting connections of workers.
+    std::string const m_build_id = build_id(); //!< expected in the greeting of every worker.
+    std::vector<Connection> m_connections = {};
+    std::size_t m_num_welcomed = 0ul; //!< number of workers welcomed so far.
+    bool m_stopped = false; //!< whether no further test-cases should be handed out.
+};
+
+/// Names (paths) of the batch encoded in @p frame; empty if the coordinator finished.
+std::vector<std::string> decode_batch(std::string_view frame)
+{
+    auto result = std::vector<std::string>(decode_integer(frame));
+    for (auto & name : result) {
+        name = decode_text(frame);
+    }
+    return result;
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool supports_distribution() noexcept
+{
+    return CLEANTEST_HAS_DISTRIBUTION;
+}
+
+std::string greeting(std::string_view const id)
+{
+    auto result = std::string{};
+    encode_text(result, greeting_tag);
+    encode_text(result, id);
+    return result;
+}
+
+std::optional<std::string> greeted_build(std::string_view frame)
+{
+    try {
+        if (decode_text(frame) != greeting_tag) {
+            return {};
+        }
+        auto result = std::string{decode_text(frame)};
+        if (not frame.empty()) {
+            return {};
+        }
+        return result;
+    } catch (std::runtime_error const &) {
+        return {};
+    }
+}
+
+void execute_distributed(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions)
+{
+#if CLEANTEST_HAS_DISTRIBUTION
+    Coordinator{cases, plan, dependencies, setup, results, budget, repetitions}.run();
+#else
+    static_cast<void>(cases);
+    static_cast<void>(plan);
+    static_cast<void>(dependencies);
+    static_cast<void>(setup);
+    static_cast<void>(results);
+    static_cast<void>(budget);
+    static_cast<void>(repetitions);
+    std::terminate(); // guarded by supports_distribution()
+#endif
+}
+
+std::size_t work_for(Endpoint const & endpoint, framework::Registry & cases, ColorTable const & colors)
+{
+#if CLEANTEST_HAS_DISTRIBUTION
+    auto const ignore_broken_pipes = IgnoreBrokenPipes{};
+    auto const fd = endpoint.connect(connection_patience);
+    auto lookup = std::unordered_map<std::string_view, std::size_t>{};
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        lookup.emplace(cases[i].name().path(), i);
+    }
+
+    auto console = std::ostringstream{};
+    auto evaluator = CaseEvaluator{{.m_output = console, .m_colors = colors, .m_buffering = BufferingMode::off}, true};
+    auto num_executed = 0ul;
+    auto connected = write_frame(fd, greeting(build_id()));
+    while (connected) {
+        auto const frame = read_frame(fd);
+        auto const batch = frame ? decode_batch(*frame) : std::vector<std::string>{};
+        connected = not batch.empty();
+        for (auto const & name : batch) {
+            auto result = CaseResult{name, CaseStatus::abort, CaseResult::Duration{}, {}};
+            if (auto const pos = lookup.find(name); pos != lookup.cend()) {
+                result = evaluator(cases[pos->second]);
+                ++num_executed;
+            } else {
+                result.m_observations.emplace_back(Observation{
+                    {"unknown", 0u},
+                    ObservationStatus::fail_asserted,
+                    "Unknown test-case (workers must execute the same binary as their coordinator).",
+                    {}});
+            }
+
+            auto buffer = std::string{};
+            encode_result(buffer, result);
+            encode_text(buffer, console.str());
+            console.str({});
+            if (not write_frame(fd, buffer)) {
+                connected = false;
+                break;
+            }
+        }
+    }
+    ::close(fd);
+    return num_executed;
+#else
+    static_cast<void>(endpoint);
+    static_cast<void>(cases);
+    static_cast<void>(colors);
+    throw std::runtime_error{"Distributed execution is not supported on this platform."};
+#endif
+}
+
+}
@@ -0,0 +1,59 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "ColorTable.h"
+#include "Conductor.h"
+#include "Dependencies.h"
+#include "Endpoint.h"
+#include "FailureBudget.h"
+#include "Plan.h"
+#include "Repetitions.h"
+#include "ResultPipeline.h"
+
+#include <framework/Registry.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Whether distributing test-cases onto workers connected via sockets (c.f. @c execute_distributed) is supported on
+/// this platform.
+bool supports_distribution() noexcept;
+
+/// Coordinate the execution of @p cases by worker processes (c.f. @c work_for) which connect to the @c m_coordination
+/// endpoint of @p setup, according to @p plan (respecting their @p dependencies).
+///
+/// Any number of workers may connect (and disconnect) at any time; this process doesn't execute any test-case itself.
+/// Only peers greeting as workers of the same build (by its build-id) are handed out test-cases.
+/// Idle workers pull batches of test-cases (by their name path): Batches shrink as fewer test-cases remain, s.t. the
+/// load is balanced dynamically. Workers stream back the results of their test-cases one by one; these are handed on
+/// to @p results (and accounted for in the failure @p budget). Test-cases of workers which disconnect prematurely are
+/// reported as aborted (the one in progress) or handed out again (the unstarted ones). Workers exceeding the timeout
+/// of their test-case are disconnected. The @p plan covers all copies of the @p repetitions.
+void execute_distributed(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions);
+
+/// Greeting sent by workers (c.f. @c work_for) right after connecting, introducing them as executing the build @p id.
+std::string greeting(std::string_view id);
+
+/// Build-id introduced by the @p frame of a worker; nothing if it isn't a greeting (c.f. @c greeting) at all.
+std::optional<std::string> greeted_build(std::string_view frame);
+
+/// Execute test-cases of @p cases as requested by the coordinator at @p endpoint (until it finished) and report them
+/// with @p colors; returns the number of executed test-cases.
+///
+/// Throws std::runtime_error if the coordinator can't be reached.
+std::size_t work_for(Endpoint const & endpoint, framework::Registry & cases, ColorTable const & colors);
+
+}
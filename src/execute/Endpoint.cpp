@@ -0,0 +1,195 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Endpoint.h"
+
+#if __has_include(<sys/socket.h>) and __has_include(<sys/un.h>) and __has_include(<netdb.h>)
+# define CLEANTEST_HAS_SOCKETS 1
+# include <netdb.h>
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_SOCKETS 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+#if CLEANTEST_HAS_SOCKETS
+
+/// Maximum number of pending connections of a listening socket.
+constexpr auto backlog = 128;
+
+/// Interval for retrying refused connections.
+constexpr auto retry_interval = std::chrono::milliseconds{50};
+
+/// Address of the Unix domain socket at @p path; throws std::runtime_error if @p path is too long.
+::sockaddr_un local_address(std::string const & path)
+{
+    auto result = ::sockaddr_un{};
+    result.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(result.sun_path)) {
+        throw std::runtime_error{"Socket path " + path + " is too long."};
+    }
+    std::copy(path.cbegin(), path.cend(), result.sun_path);
+    return result;
+}
+
+/// Resolved addresses of @p host and @p port (for listening if @p passive); throws std::runtime_error on failure.
+std::unique_ptr<::addrinfo, void (*)(::addrinfo *)> resolve(
+    std::string const & host, std::string const & port, bool const passive)
+{
+    auto hints = ::addrinfo{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+    ::addrinfo * result = nullptr;
+    if (auto const error = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &result); error != 0) {
+        throw std::runtime_error{"Failed to resolve " + host + ':' + port + " (" + ::gai_strerror(error) + ")."};
+    }
+    return {result, &::freeaddrinfo};
+}
+
+/// Socket of @p family connected to @p address (of @p size); nothing if the connection was refused.
+std::optional<int> try_connect(int const family, ::sockaddr const * address, ::socklen_t const size)
+{
+    auto const fd = ::socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throw std::runtime_error{std::string{"Failed to create socket ("} + std::strerror(errno) + ")."};
+    }
+    if (::connect(fd, address, size) == 0) {
+        return fd;
+    }
+    auto const error = errno;
+    ::close(fd);
+    if (error == ECONNREFUSED or error == ENOENT) {
+        return {};
+    }
+    throw std::runtime_error{std::string{"Failed to connect ("} + std::strerror(error) + ")."};
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Endpoint::Endpoint(std::string address, Family const family, std::string host, std::string port) :
+    m_address{std::move(address)}, m_family{family}, m_host{std::move(host)}, m_port{std::move(port)}
+{}
+
+std::optional<Endpoint> Endpoint::parse(std::string_view const address)
+{
+    if (auto const path = std::string_view{"unix:"}; address.starts_with(path) and address.size() > path.size()) {
+        return Endpoint{std::string{address}, Family::local, std::string{address.substr(path.size())}, {}};
+    }
+    if (auto const tcp = std::string_view{"tcp:"}; address.starts_with(tcp)) {
+        auto const location = address.substr(tcp.size());
+        auto const separator = location.rfind(':');
+        if (separator == std::string_view::npos or separator == 0ul) {
+            return {};
+        }
+        auto const port = location.substr(separator + 1ul);
+        if (port.empty() or port.size() > 5ul or not std::all_of(port.cbegin(), port.cend(), [](char const c) {
+                return c >= '0' and c <= '9';
+            })) {
+            return {};
+        }
+        auto host = location.substr(0ul, separator);
+        if (host.size() > 2ul and host.starts_with('[') and host.ends_with(']')) {
+            host = host.substr(1ul, host.size() - 2ul); // IPv6 address
+        }
+        return Endpoint{std::string{address}, Family::tcp, std::string{host}, std::string{port}};
+    }
+    return {};
+}
+
+int Endpoint::listen() const
+{
+#if CLEANTEST_HAS_SOCKETS
+    auto const listening = [this](int const family, ::sockaddr const * address, ::socklen_t const size) {
+        auto const fd = ::socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        auto const reuse = 1;
+        if (fd < 0 or (family != AF_UNIX and ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0)
+            or ::bind(fd, address, size) != 0 or ::listen(fd, backlog) != 0) {
+            auto const error = errno;
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw std::runtime_error{"Failed to listen on " + m_address + " (" + std::strerror(error) + ")."};
+        }
+        return fd;
+    };
+
+    switch (m_family) {
+        case Family::local: {
+            auto const address = local_address(m_host);
+            std::filesystem::remove(m_host); // stale socket (if any)
+            return listening(AF_UNIX, reinterpret_cast<::sockaddr const *>(&address), sizeof(address));
+        }
+        case Family::tcp: {
+            auto const resolved = resolve(m_host, m_port, true);
+            return listening(resolved->ai_family, resolved->ai_addr, resolved->ai_addrlen);
+        }
+        default:
+            std::terminate();
+    }
+#else
+    throw std::runtime_error{"Sockets aren't supported on this platform."};
+#endif
+}
+
+int Endpoint::connect(std::chrono::milliseconds const patience) const
+{
+#if CLEANTEST_HAS_SOCKETS
+    auto const deadline = std::chrono::steady_clock::now() + patience;
+    while (true) {
+        auto connected = std::optional<int>{};
+        switch (m_family) {
+            case Family::local: {
+                auto const address = local_address(m_host);
+                connected = try_connect(AF_UNIX, reinterpret_cast<::sockaddr const *>(&address), sizeof(address));
+                break;
+            }
+            case Family::tcp: {
+                auto const resolved = resolve(m_host, m_port, false);
+                for (auto const * cur = resolved.get(); cur != nullptr and not connected; cur = cur->ai_next) {
+                    connected = try_connect(cur->ai_family, cur->ai_addr, cur->ai_addrlen);
+                }
+                break;
+            }
+            default:
+                std::terminate();
+        }
+        if (connected) {
+            return *connected;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            throw std::runtime_error{"Failed to connect to " + m_address + " (no coordinator is listening)."};
+        }
+        std::this_thread::sleep_for(retry_interval);
+    }
+#else
+    static_cast<void>(patience);
+    throw std::runtime_error{"Sockets aren't supported on this platform."};
+#endif
+}
+
+void Endpoint::remove() const
+{
+    if (m_family == Family::local) {
+        auto ignored = std::error_code{};
+        std::filesystem::remove(m_host, ignored);
+    }
+}
+
+}
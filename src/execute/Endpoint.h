@@ -0,0 +1,55 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Address of the socket connecting the coordinator of a distributed execution with its workers (c.f. @c work_for).
+///
+/// Supports Unix domain sockets (form "unix:PATH") and TCP (form "tcp:HOST:PORT", IPv6 addresses in brackets).
+class Endpoint {
+public:
+    /// Parse @p address; nothing if it is malformed.
+    static std::optional<Endpoint> parse(std::string_view address);
+
+    /// Listen for connections on this endpoint and return the listening socket; throws std::runtime_error on failure.
+    ///
+    /// A stale socket file (e.g. of a crashed coordinator) is replaced.
+    [[nodiscard]] int listen() const;
+
+    /// Connect to this endpoint and return the connected socket; throws std::runtime_error on failure.
+    ///
+    /// Refused connections are retried during @p patience, s.t. workers can be started before the coordinator.
+    [[nodiscard]] int connect(std::chrono::milliseconds patience) const;
+
+    /// Remove the socket file (of Unix domain sockets) after listening on it.
+    void remove() const;
+
+    /// Textual representation (as parsed).
+    std::string const & address() const noexcept
+    {
+        return m_address;
+    }
+
+private:
+    /// Kind of socket.
+    enum class Family {
+        local, //!< Unix domain socket at path @c m_host.
+        tcp, //!< TCP socket at @c m_host and @c m_port.
+    };
+
+    Endpoint(std::string address, Family family, std::string host, std::string port);
+
+    std::string m_address;
+    Family m_family;
+    std::string m_host; //!< host name (or path of the socket file for @c Family::local).
+    std::string m_port; //!< port number (only for @c Family::tcp).
+};
+
+}
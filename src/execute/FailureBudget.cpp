@@ -0,0 +1,28 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "FailureBudget.h"
+
+#include <framework/CancellationSetup.h>
+
+namespace clean_test::execute {
+
+FailureBudget::FailureBudget(std::size_t const max_failures) noexcept : m_max_failures{max_failures}
+{}
+
+void FailureBudget::account(CaseResult const & result) noexcept
+{
+    if (m_max_failures == 0ul or tolerated(result) or static_cast<bool>(result.m_type)) {
+        return;
+    }
+    if (m_num_failures.fetch_add(1ul, std::memory_order_relaxed) + 1ul == m_max_failures) {
+        framework::CancellationSetup::request();
+    }
+}
+
+bool FailureBudget::exhausted() const noexcept
+{
+    return m_max_failures != 0ul and m_num_failures.load(std::memory_order_relaxed) >= m_max_failures;
+}
+
+}
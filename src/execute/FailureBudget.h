@@ -0,0 +1,39 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace clean_test::execute {
+
+/// Counter of failing results which cancels the test execution once their number reaches a limit (c.f. fail-fast).
+///
+/// Cancellation is cooperative: Workers check @c framework::cancellation_requested before claiming another test-case
+/// (and report unstarted ones as skipped), test-cases in flight may poll it in order to finish early.
+class FailureBudget {
+public:
+    /// Detailed c'tor: Cancel execution after @p max_failures failing results; 0 never cancels.
+    explicit FailureBudget(std::size_t max_failures) noexcept;
+
+    /// Account for @p result (from any thread); requests cancellation if the limit is reached.
+    void account(CaseResult const & result) noexcept;
+
+    /// Whether the limit has been reached.
+    [[nodiscard]] bool exhausted() const noexcept;
+
+    /// Maximum number of failing results before cancelling; 0 for unlimited.
+    [[nodiscard]] std::size_t limit() const noexcept
+    {
+        return m_max_failures;
+    }
+
+private:
+    std::size_t const m_max_failures;
+    std::atomic<std::size_t> m_num_failures = 0ul;
+};
+
+}
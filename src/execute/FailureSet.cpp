@@ -0,0 +1,44 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "FailureSet.h"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace clean_test::execute {
+
+void FailureSet::update(CaseResult const & result)
+{
+    if (static_cast<bool>(result.m_type) or result.m_status == CaseStatus::skip) {
+        return; // not executed (at least not as a regular test-case)
+    }
+    if (passed(result.m_status)) {
+        if (auto const pos = m_names.find(std::string_view{result.m_name_path}); pos != m_names.cend()) {
+            m_names.erase(pos);
+        }
+    } else {
+        m_names.emplace(result.m_name_path);
+    }
+}
+
+std::ostream & operator<<(std::ostream & out, FailureSet const & failures)
+{
+    for (auto const & name : failures.m_names) {
+        out << name << '\n';
+    }
+    return out;
+}
+
+std::istream & operator>>(std::istream & in, FailureSet & failures)
+{
+    for (auto line = std::string{}; std::getline(in, line);) {
+        if (not line.empty()) {
+            failures.m_names.emplace(std::move(line));
+        }
+    }
+    return in;
+}
+
+}
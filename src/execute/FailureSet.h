@@ -0,0 +1,54 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <utils/StringHash.h>
+
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Persistent set of (full name paths of) test-cases which didn't pass in their most recent execution.
+///
+/// The serialized form is line based: Every line holds the name path of one test-case.
+class FailureSet {
+public:
+    using Names = utils::StringSet;
+
+    /// Whether the test-case with @p name_path failed most recently.
+    bool contains(std::string_view const name_path) const
+    {
+        return m_names.find(name_path) != m_names.cend();
+    }
+
+    /// Record @p result (if it has been executed): failed ones are added, passed ones removed.
+    void update(CaseResult const & result);
+
+    /// Name paths of all recorded test-cases.
+    Names const & names() const
+    {
+        return m_names;
+    }
+
+    /// Number of recorded test-cases.
+    std::size_t size() const
+    {
+        return m_names.size();
+    }
+
+    /// Write serialized representation of @p failures into @p out.
+    friend std::ostream & operator<<(std::ostream & out, FailureSet const & failures);
+
+    /// Import serialized names from @p in into @p failures; silently skips empty lines.
+    friend std::istream & operator>>(std::istream & in, FailureSet & failures);
+
+private:
+    Names m_names;
+};
+
+}
@@ -0,0 +1,158 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Frames.h"
+
+#include "Serialization.h"
+
+#if __has_include(<unistd.h>)
+# define CLEANTEST_HAS_FRAMES 1
+# include <signal.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_FRAMES 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <exception>
+
+namespace clean_test::execute {
+namespace {
+
+/// Size of the length prefix of every frame.
+constexpr auto header_size = sizeof(std::uint64_t);
+
+/// Largest payload accepted: Guards against allocating for the length prefix of a corrupt (or foreign) frame.
+constexpr auto max_payload_size = std::uint64_t{1u} << 30u;
+
+/// Maximum number of bytes consumed by a single read of @c FrameBuffer::fill.
+constexpr auto chunk_size = 1ul << 16u;
+
+#if CLEANTEST_HAS_FRAMES
+
+/// Write all of @p data into @p fd; returns whether successful.
+bool write_all(int const fd, std::string_view data)
+{
+    while (not data.empty()) {
+        auto const num = ::write(fd, data.data(), data.size());
+        if (num < 0 and errno == EINTR) {
+            continue;
+        }
+        if (num <= 0) {
+            return false;
+        }
+        data.remove_prefix(static_cast<std::size_t>(num));
+    }
+    return true;
+}
+
+/// Read exactly @p size bytes from @p fd; nothing if the other end has been closed (or failed) prematurely.
+std::optional<std::string> read_all(int const fd, std::size_t const size)
+{
+    auto result = std::string(size, '\0');
+    for (auto done = 0ul; done < size;) {
+        auto const num = ::read(fd, result.data() + done, size - done);
+        if (num < 0 and errno == EINTR) {
+            continue;
+        }
+        if (num <= 0) {
+            return {};
+        }
+        done += static_cast<std::size_t>(num);
+    }
+    return result;
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool write_frame(int const fd, std::string_view const payload)
+{
+#if CLEANTEST_HAS_FRAMES
+    auto buffer = std::string{};
+    encode_text(buffer, payload);
+    return write_all(fd, buffer);
+#else
+    static_cast<void>(fd);
+    static_cast<void>(payload);
+    std::terminate(); // only used with isolated (or distributed) execution
+#endif
+}
+
+std::optional<std::string> read_frame(int const fd)
+{
+#if CLEANTEST_HAS_FRAMES
+    auto header = read_all(fd, header_size);
+    if (not header) {
+        return {};
+    }
+    auto data = std::string_view{*header};
+    auto const size = decode_integer(data);
+    if (size > max_payload_size) {
+        return {};
+    }
+    return read_all(fd, size);
+#else
+    static_cast<void>(fd);
+    std::terminate(); // only used with isolated (or distributed) execution
+#endif
+}
+
+bool FrameBuffer::fill(int const fd)
+{
+#if CLEANTEST_HAS_FRAMES
+    auto const offset = m_data.size();
+    m_data.resize(offset + chunk_size);
+    auto num = ::read(fd, m_data.data() + offset, chunk_size);
+    while (num < 0 and errno == EINTR) {
+        num = ::read(fd, m_data.data() + offset, chunk_size);
+    }
+    m_data.resize(offset + static_cast<std::size_t>(std::max<decltype(num)>(num, 0)));
+    if (num <= 0) {
+        return false;
+    }
+    if (m_data.size() >= header_size) {
+        auto data = std::string_view{m_data};
+        return decode_integer(data) <= max_payload_size;
+    }
+    return true;
+#else
+    static_cast<void>(fd);
+    std::terminate(); // only used with distributed execution
+#endif
+}
+
+std::optional<std::string> FrameBuffer::next()
+{
+    if (m_data.size() < header_size) {
+        return {};
+    }
+    auto data = std::string_view{m_data};
+    auto const size = decode_integer(data);
+    if (data.size() < size) {
+        return {};
+    }
+    auto result = std::string{data.substr(0ul, size)};
+    m_data.erase(0ul, header_size + size);
+    return result;
+}
+
+IgnoreBrokenPipes::IgnoreBrokenPipes()
+{
+#if CLEANTEST_HAS_FRAMES
+    m_reset = ::signal(SIGPIPE, SIG_IGN);
+#endif
+}
+
+IgnoreBrokenPipes::~IgnoreBrokenPipes()
+{
+#if CLEANTEST_HAS_FRAMES
+    ::signal(SIGPIPE, m_reset);
+#endif
+}
+
+}
@@ -0,0 +1,52 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Send length-prefixed @p payload via @p fd (e.g. a pipe or a socket); returns whether successful.
+bool write_frame(int fd, std::string_view payload);
+
+/// Receive length-prefixed payload from @p fd; nothing if the other end has been closed (or failed) prematurely or
+/// announced an excessively large payload.
+std::optional<std::string> read_frame(int fd);
+
+/// Receiver of length-prefixed payloads from a file descriptor polled along with others (e.g. sockets of many peers).
+///
+/// Data is accumulated across several reads, s.t. a peer sending an incomplete frame can't block the receiver.
+class FrameBuffer {
+public:
+    /// Append the data available from @p fd by a single read (which doesn't block once @p fd has been polled as
+    /// readable); false if the other end has been closed (or failed) or announced an excessively large payload.
+    [[nodiscard]] bool fill(int fd);
+
+    /// Take the next completely received payload (if any).
+    std::optional<std::string> next();
+
+private:
+    std::string m_data = {}; //!< received but not yet taken data (starting with the length of the next payload).
+};
+
+/// Scoped setup to ignore @c SIGPIPE: A crashed peer must not take down this process when sending to it.
+class IgnoreBrokenPipes {
+public:
+    IgnoreBrokenPipes();
+    ~IgnoreBrokenPipes();
+
+    // non-copyable and non-movable
+    IgnoreBrokenPipes(IgnoreBrokenPipes &&) = delete;
+    IgnoreBrokenPipes & operator=(IgnoreBrokenPipes &&) = delete;
+    IgnoreBrokenPipes(IgnoreBrokenPipes const &) = delete;
+    IgnoreBrokenPipes & operator=(IgnoreBrokenPipes const &) = delete;
+
+private:
+    using Handler = void (*)(int);
+    Handler m_reset = nullptr; //!< previous handler (restored on destruction).
+};
+
+}
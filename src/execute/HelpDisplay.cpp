@@ -25,6 +25,14 @@ std::ostream & operator<<(std::ostream & out, HelpDisplay const & hd)
            "  " << c("--list") << "  " << c("-l") << "\n"
            "    Instead of executing a test, display its name. This mode honors all general\n"
            "    options.\n"
+           "  " << c("--bisect-pollution") << "=NAME\n"
+           "    Narrow down which test-cases make test-case NAME fail when executed before it\n"
+           "    (e.g. by sharing static state). Replays subsets of those recorded in the\n"
+           "    " << c("--journal") << " on the same worker in forked trials (" << c("--jobs")
+        << " of them concurrently).\n"
+           "  " << c("--work-for") << "=ADDRESS\n"
+           "    Execute test-cases handed out by the coordinator at ADDRESS until it is\n"
+           "    done (c.f. " << c("--coordinate") << "). Workers must execute the same test binary.\n"
            "\n"
            "General options:\n"
            "  " << c("--color") << "=(" << c("automatic") << '|' << c("always") << '|' << c("never") << ")\n"
@@ -41,16 +49,91 @@ std::ostream & operator<<(std::ostream & out, HelpDisplay const & hd)
            "Execution options:\n"
            "  " << c("--buffered") << "  " << c("-b") << "\n"
            "    Enable buffering of messages for each test-case.\n"
-           "  " << c("--jobs") << "=N  " << c("-j") << " N\n"
+           "  " << c("--jobs") << "=(N|" << c("adaptive") << ")  " << c("-j") << " N\n"
            "    Execute at most N test-cases in parallel (default: " << default_config.m_num_jobs << "). "
            "The special value 0 \n"
-           "    instructs to utilize all available CPU cores.\n"
+           "    instructs to utilize all available CPU cores (considering the CPU affinity\n"
+           "    and the CPU quota of the cgroup). With " << c("adaptive") << ", the number of test-cases\n"
+           "    follows the measured CPU utilization: more for sleeping or I/O-bound ones,\n"
+           "    fewer once the cores are saturated.\n"
+           "    Test-cases tagged " << c("exclusive") << " run alone; those tagged " << c("lock") << ":NAME never run\n"
+           "    concurrently and those tagged " << c("mem") << ":SIZE[K|M|G|T] share the available memory.\n"
+           "    Test-cases tagged " << c("after") << ":PATH only run once the test-case (or all test-cases\n"
+           "    of the suite) PATH passed; else they are skipped.\n"
+           "  " << c("--pin") << "\n"
+           "    Bind every worker to a distinct CPU core (spread across NUMA nodes), e.g. for\n"
+           "    reproducible timings of CPU-heavy test-cases.\n"
+           "  " << c("--jobserver") << "\n"
+           "    Share the job budget of an enclosing GNU make (advertised in MAKEFLAGS):\n"
+           "    all but the first worker acquire a token before executing test-cases.\n"
+           "  " << c("--isolate") << "  " << c("-i") << "\n"
+           "    Execute test-cases in separate worker processes. Crashing test-cases are\n"
+           "    reported as aborted and their output to stdout / stderr is captured.\n"
+           "  " << c("--timeout") << "=SECONDS\n"
+           "    Abandon test-cases running longer than SECONDS (default: " << default_config.m_timeout.count()
+        << ", i.e. unlimited).\n"
+           "    Test-cases tagged with " << c("timeout") << ":SECONDS use their own timeout instead.\n"
+           "  " << c("--on-timeout") << "=(" << c("proceed") << '|' << c("terminate") << ")\n"
+           "    Control whether the remaining test-cases are executed after a timeout\n"
+           "    (default: " << c("proceed") << ").\n"
+           "  " << c("--fail-fast") << "[=N]\n"
+           "    Cancel execution after N failing test-cases (default: 1 if given, else never).\n"
+           "    Unstarted test-cases are skipped; running ones may poll " << c("cancellation_requested") << "().\n"
+           "  " << c("--repeat") << "=N\n"
+           "    Execute N copies of every test-case concurrently, e.g. for finding flaky ones\n"
+           "    (default: " << default_config.m_repetitions << "). Reports runs, failures and durations of\n"
+           "    every test-case.\n"
+           "  " << c("--until-fail") << "\n"
+           "    Cancel " << c("--repeat") << "ed execution on the first failing run.\n"
+           "  " << c("--retries") << "=N\n"
+           "    Execute failed (or aborted) test-cases up to N more times (default: "
+        << default_config.m_retries << ").\n"
+           "    Only the final attempt counts; flaky passes are reported (and marked in the\n"
+           "    report) as such.\n"
+           "  " << c("--quarantine") << "=PATH\n"
+           "    Tolerate failures of the test-cases listed in PATH (one per line).\n"
+           "  " << c("--shard") << "=I/N\n"
+           "    Only execute the I-th of N (similarly long) shards of all test-cases, e.g. for\n"
+           "    distributing them onto multiple machines. The shards are balanced by the\n"
+           "    durations recorded in the " << c("--history") << " (if available).\n"
            "  " << c("--report") << "=(" << c("junit") << ":)?PATH\n"
            "    Generate output in PATH with specified format (default: " << c("junit") << "-xml).\n"
+           "  " << c("--history") << "=PATH\n"
+           "    Record durations of test-cases in PATH and execute the longest test-cases\n"
+           "    first in subsequent runs (default: disabled).\n"
+           "  " << c("--order") << "=(" << c("duration") << '|' << c("risk") << ")\n"
+           "    Start the longest test-cases first (default: " << c("duration") << ") or, for " << c("risk")
+        << ", those\n"
+           "    which failed recently (or are new to the " << c("--history") << "), s.t. failures are reported\n"
+           "    early.\n"
+           "  " << c("--failures") << "=PATH\n"
+           "    Record names of test-cases which didn't pass in PATH (default: disabled).\n"
+           "  " << c("--rerun-failed") << "\n"
+           "    Only execute the test-cases recorded in the " << c("--failures") << " file.\n"
+           "  " << c("--cache") << "=PATH\n"
+           "    Cache passed test-cases of this build in PATH; these are reported as " << c("cached") << "\n"
+           "    (without executing them) by subsequent runs of the same build. Test-cases\n"
+           "    tagged " << c("nondeterministic") << " or " << c("side-effects") << " are always executed.\n"
+           "  " << c("--journal") << "=PATH\n"
+           "    Journal the progress of the execution in PATH (default: disabled). Signals\n"
+           "    " << c("SIGINT") << " and " << c("SIGTERM") << " skip unstarted test-cases but finish running ones.\n"
+           "  " << c("--resume") << "\n"
+           "    Resume the execution interrupted while writing the " << c("--journal") << ": Completed\n"
+           "    test-cases aren't executed again; running ones are reported as aborted.\n"
+           "  " << c("--coordinate") << "=ADDRESS\n"
+           "    Distribute the test-cases onto workers (of the same test binary, possibly on\n"
+           "    other hosts) connecting to ADDRESS via " << c("--work-for") << ". Supported addresses are\n"
+           "    " << c("unix") << ":PATH and " << c("tcp") << ":HOST:PORT. Idle workers pull batches of test-cases;\n"
+           "    their results are reported (and exported) as a single execution. Workers\n"
+           "    exceeding a " << c("--timeout") << " are dropped.\n"
            "\n"
            "Listing options:\n"
            "  " << c("--depth") << "=N  " << c("-d") << " N\n"
            "    Configure maximum depth N of the visualized tree (default: " << default_config.m_depth << ").\n"
+           "  " << c("--format") << "=(" << c("tree") << '|' << c("names") << ")\n"
+           "    List test-cases as tree (default: " << c("tree") << ") or, for " << c("names")
+        << ", one per line with its name\n"
+           "    and tags (separated by tabs) for processing them by other tools.\n"
            "\n"
            "For more information, please read the Clean Test documentation available at\n"
         << c("https://github.com/clean-test/clean-test") << ". If you happen to find a bug in \n"
@@ -0,0 +1,118 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "History.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <limits>
+#include <istream>
+#include <ostream>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto field_separator = '\t';
+
+/// Split off and parse the leading numeric field of @p line; nothing if @p line doesn't start with one.
+std::optional<std::int64_t> consume_number(std::string_view & line)
+{
+    auto const end = line.find(field_separator);
+    if (end == std::string_view::npos) {
+        return {};
+    }
+    auto result = std::int64_t{0};
+    if (auto [ptr, ec] = std::from_chars(line.data(), line.data() + end, result);
+        ec != std::errc{} or ptr != line.data() + end) {
+        return {};
+    }
+    line.remove_prefix(end + 1ul);
+    return result;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+History::Record const * History::find(std::string_view const name_path) const
+{
+    if (auto const pos = m_records.find(name_path); pos != m_records.cend()) {
+        return &pos->second;
+    }
+    return nullptr;
+}
+
+std::uint64_t History::risk(std::string_view const name_path) const
+{
+    auto const * const record = find(name_path);
+    if (record == nullptr) {
+        return 1u;
+    }
+    if (record->m_outcomes == 0u) {
+        return 0u;
+    }
+    // Timestamps (of the next millennia) fit into the lower bits; the number of failures (at most 32) above them.
+    constexpr auto timestamp_bits = 48u;
+    auto const timestamp = std::clamp<std::int64_t>(record->m_last_failed, 0, (std::int64_t{1} << timestamp_bits) - 1);
+    auto const num_failures = std::uint64_t{record->num_recent_failures()};
+    return 2u + ((num_failures << timestamp_bits) | static_cast<std::uint64_t>(timestamp));
+}
+
+void History::update(Outcome const & outcome)
+{
+    for (auto const & result : outcome.m_results) {
+        update(result);
+    }
+}
+
+void History::update(CaseResult const & result)
+{
+    if (static_cast<bool>(result.m_type) or result.m_status == CaseStatus::skip
+        or result.m_status == CaseStatus::cached) {
+        return; // no measurement of a real execution
+    }
+    auto const failed = not passed(result.m_status) or result.m_attempts;
+    auto & record = m_records[result.m_name_path];
+    record.m_wall_time = result.m_wall_time;
+    record.m_outcomes = (record.m_outcomes << 1u) | (failed ? 1u : 0u);
+    if (failed) {
+        auto const now = std::chrono::floor<std::chrono::seconds>(CaseResult::Clock::now());
+        record.m_last_failed = now.time_since_epoch().count();
+    }
+}
+
+std::ostream & operator<<(std::ostream & out, History const & history)
+{
+    for (auto const & [path, record] : history.m_records) {
+        out << record.m_wall_time.count() << field_separator << record.m_outcomes << field_separator
+            << record.m_last_failed << field_separator << path << '\n';
+    }
+    return out;
+}
+
+std::istream & operator>>(std::istream & in, History & history)
+{
+    for (auto line = std::string{}; std::getline(in, line);) {
+        auto remainder = std::string_view{line};
+        auto const wall_time = consume_number(remainder);
+        if (not wall_time or *wall_time < 0) {
+            continue;
+        }
+        auto record = History::Record{History::Duration{*wall_time}};
+        auto failures = remainder;
+        auto const outcomes = consume_number(failures);
+        auto const last_failed = consume_number(failures);
+        if (outcomes and last_failed and *outcomes >= 0 and *outcomes <= std::numeric_limits<std::uint32_t>::max()) {
+            record.m_outcomes = static_cast<std::uint32_t>(*outcomes);
+            record.m_last_failed = *last_failed;
+            remainder = failures;
+        }
+        if (remainder.empty()) {
+            continue;
+        }
+        history.m_records.insert_or_assign(std::string{remainder}, record);
+    }
+    return in;
+}
+
+}
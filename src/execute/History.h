@@ -0,0 +1,76 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Outcome.h"
+
+#include <execute/CaseResult.h>
+
+#include <utils/StringHash.h>
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace clean_test::execute {
+
+/// Persistent per-test-case details collected from previous executions (keyed by the cases' full name path).
+///
+/// The serialized form is line based: Tab-separated numeric fields are followed by the name path as final field. Lines
+/// with only the wall time (as recorded by former versions) are supported as well.
+class History {
+public:
+    using Duration = CaseResult::Duration;
+
+    /// Details recorded about one test-case.
+    class Record {
+    public:
+        Duration m_wall_time = {}; //!< (Most recently) measured execution (wall) time.
+        std::uint32_t m_outcomes = 0u; //!< whether the 32 most recent executions failed (bit 0: the latest one).
+        std::int64_t m_last_failed = 0; //!< when the latest failure was recorded (seconds since epoch); 0 for never.
+
+        /// Number of failures among the most recent executions.
+        std::size_t num_recent_failures() const noexcept
+        {
+            return static_cast<std::size_t>(std::popcount(m_outcomes));
+        }
+    };
+
+    /// Access recorded details about the test-case with @p name_path (if there are any).
+    Record const * find(std::string_view name_path) const;
+
+    /// Likelihood of the test-case with @p name_path to fail, for surfacing failures early (c.f. @c --order=risk).
+    ///
+    /// Test-cases which failed recently rank highest: by their number of recent failures, then by the time of their
+    /// latest failure. Unknown (i.e. recently added) test-cases follow with 1; all others are 0.
+    std::uint64_t risk(std::string_view name_path) const;
+
+    /// Record all (executed) test-case results of @p outcome; details about other test-cases are retained.
+    void update(Outcome const & outcome);
+
+    /// Record @p result (if it has been executed); it failed if it didn't pass (at the first attempt).
+    void update(CaseResult const & result);
+
+    /// Number of test-cases with recorded details.
+    std::size_t size() const
+    {
+        return m_records.size();
+    }
+
+    /// Write serialized representation of @p history into @p out.
+    friend std::ostream & operator<<(std::ostream & out, History const & history);
+
+    /// Import serialized records from @p in into @p history; silently skips malformed lines.
+    friend std::istream & operator>>(std::istream & in, History & history);
+
+private:
+    std::unordered_map<std::string, Record, utils::StringHash, std::equal_to<>> m_records;
+};
+
+}
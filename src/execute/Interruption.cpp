@@ -0,0 +1,45 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Interruption.h"
+
+#include <framework/CancellationSetup.h>
+
+#include <atomic>
+#include <csignal>
+
+namespace clean_test::execute {
+namespace {
+
+std::atomic<bool> interrupted_flag = false;
+static_assert(std::atomic<bool>::is_always_lock_free, "The flag must be usable from signal handlers.");
+
+extern "C" void drain(int const signal)
+{
+    interrupted_flag.store(true, std::memory_order_relaxed);
+    framework::CancellationSetup::request();
+    std::signal(signal, SIG_DFL); // repeating the signal terminates.
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+InterruptionSetup::InterruptionSetup()
+{
+    interrupted_flag.store(false, std::memory_order_relaxed);
+    m_reset_interrupt = std::signal(SIGINT, &drain);
+    m_reset_terminate = std::signal(SIGTERM, &drain);
+}
+
+InterruptionSetup::~InterruptionSetup()
+{
+    std::signal(SIGINT, m_reset_interrupt);
+    std::signal(SIGTERM, m_reset_terminate);
+}
+
+bool InterruptionSetup::interrupted() const noexcept
+{
+    return interrupted_flag.load(std::memory_order_relaxed);
+}
+
+}
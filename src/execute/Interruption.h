@@ -0,0 +1,37 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+namespace clean_test::execute {
+
+/// Scoped draining of the execution on @c SIGINT and @c SIGTERM (rather than terminating this process).
+///
+/// Upon either signal, unstarted test-cases are skipped while running ones are finished (c.f.
+/// @c framework::CancellationSetup::request), s.t. all reports are still completed. Repeating the signal terminates
+/// this process as usual.
+class InterruptionSetup {
+public:
+    /// Default c'tor: Install the signal handlers.
+    InterruptionSetup();
+
+    /// Non-trivial d'tor: Restore the previous signal handlers.
+    ~InterruptionSetup();
+
+    /// Whether any of the signals has been received during the lifetime of this object.
+    [[nodiscard]] bool interrupted() const noexcept;
+
+    // non-copyable and non-movable
+    InterruptionSetup(InterruptionSetup &&) = delete;
+    InterruptionSetup & operator=(InterruptionSetup &&) = delete;
+    InterruptionSetup(InterruptionSetup const &) = delete;
+    InterruptionSetup & operator=(InterruptionSetup const &) = delete;
+
+private:
+    using Handler = void (*)(int);
+
+    Handler m_reset_interrupt = nullptr; //!< previous handler of @c SIGINT.
+    Handler m_reset_terminate = nullptr; //!< previous handler of @c SIGTERM.
+};
+
+}
@@ -14,6 +14,8 @@
 #include <iomanip>
 #include <numeric>
 #include <ostream>
+#include <sstream>
+#include <string>
 #include <time.h>
 
 #if __has_include(<unistd.h>)
@@ -84,11 +86,25 @@ private:
 
 class XMLStats {
 public:
-    explicit XMLStats(Outcome::Results const & results) :
-        m_num_total{results.size()},
-        m_num_failed{count<CaseStatus::fail>(results)},
-        m_num_aborted{count<CaseStatus::abort>(results)}
-    {}
+    XMLStats() = default;
+
+    explicit XMLStats(Outcome::Results const & results)
+    {
+        for (auto const & r : results) {
+            add(r);
+        }
+    }
+
+    /// Account for @p result; quarantined ones are reported as skipped.
+    void add(CaseResult const & result)
+    {
+        ++m_num_total;
+        if (result.m_quarantined) {
+            return;
+        }
+        m_num_failed += (result.m_status == CaseStatus::fail);
+        m_num_aborted += (result.m_status == CaseStatus::abort) or (result.m_status == CaseStatus::timeout);
+    }
 
     friend std::ostream & operator<<(std::ostream & out, XMLStats const & stats)
     {
@@ -98,34 +114,38 @@ public:
     }
 
 private:
-    template <CaseStatus::Value status>
-    std::size_t count(Outcome::Results const & results)
-    {
-        return std::count_if(
-            results.cbegin(), results.cend(), [](CaseResult const & r) { return r.m_status == status; });
-    }
-
-    std::size_t m_num_total;
-    std::size_t m_num_failed;
-    std::size_t m_num_aborted;
+    std::size_t m_num_total = 0ul;
+    std::size_t m_num_failed = 0ul;
+    std::size_t m_num_aborted = 0ul;
 };
 
 class XMLHead {
 public:
     XMLStats m_stats;
     Outcome::Duration m_wall_time;
+    Timestamp m_timestamp = {};
+    /// Minimum size of the opening tags: They are padded with whitespace (before their closing '>') if necessary.
+    std::size_t m_width = 0ul;
 
     friend std::ostream & operator<<(std::ostream & out, XMLHead const & head)
     {
-        auto const & [stats, wall] = head;
-        auto const now = Timestamp{};
+        auto const & [stats, wall, now, width] = head;
+        auto padded = [&out, width = width](auto &&... content) {
+            auto buffer = std::ostringstream{};
+            buffer.copyfmt(out);
+            (buffer << ... << content);
+            auto const tag = std::move(buffer).str();
+            return tag + std::string(width - std::min(width, tag.size()), ' ') + ">\n";
+        };
+
         return out
             << R"(<?xml version="1.0" encoding="UTF-8"?>)" << '\n'
 
-            << "<testsuites " << stats << " time=\"" << seconds(wall) << "\" timestamp=\"" << now << "\">\n"
+            << padded("<testsuites ", stats, " time=\"", seconds(wall), "\" timestamp=\"", now, '"')
 
-            << " <testsuite name=\"/\" " << stats << " time=\"" << seconds(wall) << "\" timestamp=\"" << now << '\"'
-            << " hostname=\"" << Hostname{} << "\" id=\"0\"" << ">\n";
+            << padded(
+                   " <testsuite name=\"/\" ", stats, " time=\"", seconds(wall), "\" timestamp=\"", now, '"',
+                   " hostname=\"", Hostname{}, "\" id=\"0\"");
     }
 };
 
@@ -172,26 +192,63 @@ private:
     }
 };
 
+/// Summary of all attempts of a retried test-case (in the format of Maven Surefire).
+class XMLAttempts {
+public:
+    CaseResult const & m_result;
+
+    friend std::ostream & operator<<(std::ostream & out, XMLAttempts const & xml)
+    {
+        auto const & [r] = xml;
+        auto const & [num_attempts, first] = *r.m_attempts;
+        auto const eventually_passed = passed(r.m_status);
+        out << "   <" << (eventually_passed ? "flaky" : "rerun") << (first == CaseStatus::abort ? "Error" : "Failure")
+            << " message=\"" << (eventually_passed ? "Passed" : "Failed") << " after " << num_attempts
+            << " attempts.\" type=\"retry\" />\n";
+        return out;
+    }
+};
+
 class XMLCase {
 public:
     CaseResult const & result;
 
     friend std::ostream & operator<<(std::ostream & out, XMLCase const & c)
     {
-        static auto const status_description = std::array<std::string_view, CaseStatus::num_values>{
-            "passed", "failed", "aborted"};
+        static auto const status_description
+            = std::to_array<std::string_view>({"passed", "failed", "aborted", "skipped", "timeout", "cached"});
 
         auto const & [r] = c;
         auto const & obs = r.m_observations;
-        auto const has_children = not obs.empty() or (r.m_status == CaseStatus::skip);
-        out << "  <testcase name=\"" << r.m_name_path << "\" status=\"" << status_description[r.m_status]
-            << "\" time=\"" << seconds(r.m_wall_time) << "\"" << (has_children ? "" : " /") << ">\n";
-        for (auto const & o : obs) {
-            out << XMLObservation{o};
+        auto const has_children = not obs.empty() or (r.m_status == CaseStatus::skip) or r.m_attempts
+            or r.m_quarantined or not r.m_stdout.empty() or not r.m_stderr.empty();
+        auto const status = r.m_quarantined                          ? std::string_view{"quarantined"}
+                          : (r.m_attempts and passed(r.m_status)) ? std::string_view{"flaky"}
+                                                                    : status_description[r.m_status];
+        out << "  <testcase name=\"" << r.m_name_path << "\" status=\"" << status << "\" time=\""
+            << seconds(r.m_wall_time) << "\"" << (has_children ? "" : " /") << ">\n";
+        if (r.m_quarantined) {
+            // Failures of quarantined test-cases are tolerated: Don't let them fail the report either.
+            out << "   <skipped message=\"Quarantined test-case " << status_description[r.m_status] << ".\" />\n";
+        } else {
+            for (auto const & o : obs) {
+                out << XMLObservation{o};
+            }
+        }
+        if (r.m_attempts) {
+            out << XMLAttempts{r};
         }
         if (r.m_status == CaseStatus::skip) {
             out << "   <skipped />\n";
         }
+        for (auto const & [element, captured] : {std::pair{"system-out", &r.m_stdout}, {"system-err", &r.m_stderr}}) {
+            if (not captured->empty()) {
+                out << "   <" << element << '>';
+                auto encoder = XMLEncoder{out};
+                encoder << std::string_view{*captured};
+                out << "</" << element << ">\n";
+            }
+        }
         if (has_children) {
             out << "  </testcase>\n";
         }
@@ -224,6 +281,49 @@ public:
 }
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Details about the (already written) head of a @c JUnitStream.
+class JUnitStream::Head {
+public:
+    std::ostream::pos_type m_position; //!< where the head starts (for rewriting it); -1 if seeking is impossible.
+    std::size_t m_width; //!< width of the (padded) opening tags.
+    Timestamp m_timestamp; //!< when the stream has been started.
+    XMLStats m_stats; //!< accumulated statistics of all consumed results.
+};
+
+JUnitStream::JUnitStream(std::ostream & out) : m_out{out}, m_head{std::make_unique<Head>()}
+{
+    m_out << std::setprecision(3) << std::fixed;
+
+    // Reserve space for rewriting the head later on: Every count (and the wall time) may grow by (up to) 20 digits.
+    auto unpadded = std::ostringstream{};
+    unpadded.copyfmt(m_out);
+    unpadded << XMLHead{XMLStats{}, Outcome::Duration{}, m_head->m_timestamp};
+    m_head->m_width = unpadded.view().size() + 4ul * 20ul;
+
+    m_head->m_position = m_out.tellp();
+    m_out << XMLHead{XMLStats{}, Outcome::Duration{}, m_head->m_timestamp, m_head->m_width} << std::flush;
+}
+
+JUnitStream::~JUnitStream() = default;
+
+void JUnitStream::consume_impl(CaseResult const & result)
+{
+    m_head->m_stats.add(result);
+    m_out << XMLCase{result} << std::flush;
+}
+
+void JUnitStream::finish_impl(Outcome::Duration const wall_time)
+{
+    m_out << XMLTail{};
+    if (auto const & [position, width, timestamp, stats] = *m_head; position != std::ostream::pos_type(-1)) {
+        auto const end = m_out.tellp();
+        m_out.seekp(position);
+        m_out << XMLHead{stats, wall_time, timestamp, width};
+        m_out.seekp(end);
+    }
+    m_out << std::flush;
+}
+
 std::ostream & operator<<(std::ostream & out, JUnitExport data)
 {
     auto const reset = utils::ScopeGuard{[&out, precision = out.precision()] {
@@ -231,10 +331,10 @@ std::ostream & operator<<(std::ostream & out, JUnitExport data)
         out.unsetf(std::ios_base::floatfield); // std::defaultfloat
     }};
 
-    auto const & [wall_time, results] = data.m_outcome;
+    auto const & results = data.m_outcome.m_results;
     return out
         << std::setprecision(3) << std::fixed
-        << XMLHead{XMLStats{results}, wall_time} << XMLCases{results} << XMLTail{};
+        << XMLHead{XMLStats{results}, data.m_outcome.m_wall_time} << XMLCases{results} << XMLTail{};
 }
 
 }
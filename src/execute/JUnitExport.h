@@ -4,8 +4,10 @@
 #pragma once
 
 #include "Outcome.h"
+#include "ResultSink.h"
 
 #include <iosfwd>
+#include <memory>
 
 namespace clean_test::execute {
 
@@ -18,4 +20,25 @@ public:
     Outcome const & m_outcome;
 };
 
+/// Incremental variant of @c JUnitExport: Every consumed result is written (and flushed) immediately.
+///
+/// Thus the report of all finished test-cases survives even if the process is killed prematurely. The statistics in
+/// the head of the report are only known after finishing: They are rewritten in place (if @c m_out supports seeking).
+class JUnitStream final : public ResultSink {
+public:
+    /// Detailed c'tor: write head of the report into @p out (which is configured for formatting numbers).
+    explicit JUnitStream(std::ostream & out);
+
+    ~JUnitStream() override;
+
+private:
+    class Head;
+
+    void consume_impl(CaseResult const & result) final;
+    void finish_impl(Outcome::Duration wall_time) final;
+
+    std::ostream & m_out; //!< destination of the report.
+    std::unique_ptr<Head> m_head; //!< details for rewriting the head of the report.
+};
+
 }
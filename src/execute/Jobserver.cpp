@@ -0,0 +1,191 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Jobserver.h"
+
+#if __has_include(<fcntl.h>) and __has_include(<poll.h>) and __has_include(<unistd.h>)
+# define CLEANTEST_HAS_JOBSERVER 1
+# include <fcntl.h>
+# include <poll.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_JOBSERVER 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+
+namespace clean_test::execute {
+namespace {
+
+/// Parse @p text as (non-negative) file descriptor; nothing if malformed.
+std::optional<int> parse_descriptor(std::string_view const text)
+{
+    auto result = -1;
+    auto const [last, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+    if (error != std::errc{} or last != text.data() + text.size() or result < 0) {
+        return {};
+    }
+    return result;
+}
+
+/// Parse value of @c --jobserver-auth (or @c --jobserver-fds), e.g. "fifo:PATH" or "R,W".
+std::optional<JobserverAuth> parse_auth_value(std::string_view const value)
+{
+    if (value.starts_with("fifo:")) {
+        if (value.size() == 5ul) {
+            return {};
+        }
+        return JobserverAuth{.m_fifo = std::string{value.substr(5ul)}};
+    }
+    auto const separator = value.find(',');
+    if (separator == std::string_view::npos) {
+        return {};
+    }
+    auto const read = parse_descriptor(value.substr(0ul, separator));
+    auto const write = parse_descriptor(value.substr(separator + 1ul));
+    if (not read or not write) {
+        return {};
+    }
+    return JobserverAuth{.m_read = *read, .m_write = *write};
+}
+
+#if CLEANTEST_HAS_JOBSERVER
+
+/// Whether @p fd is an open file descriptor.
+bool is_open(int const fd)
+{
+    return ::fcntl(fd, F_GETFD) >= 0;
+}
+
+/// Open a separate, non-blocking description for reading from inherited @p fd.
+///
+/// Reading from a shared blocking description could stall, whenever another client grabs the token first. The
+/// duplicate (fallback if there is no procfs) only works reliably if the jobserver itself made it non-blocking.
+int open_reader(int const fd)
+{
+    auto const path = "/proc/self/fd/" + std::to_string(fd);
+    if (auto const result = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC); result >= 0) {
+        return result;
+    }
+    return ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<JobserverAuth> parse_jobserver_auth(std::string_view makeflags)
+{
+    auto result = std::optional<JobserverAuth>{};
+    while (not makeflags.empty()) {
+        auto const begin = std::min(makeflags.find_first_not_of(" \t"), makeflags.size());
+        makeflags.remove_prefix(begin);
+        auto const end = std::min(makeflags.find_first_of(" \t"), makeflags.size());
+        auto const word = makeflags.substr(0ul, end);
+        makeflags.remove_prefix(end);
+
+        for (auto const option : {std::string_view{"--jobserver-auth="}, std::string_view{"--jobserver-fds="}}) {
+            if (word.starts_with(option)) {
+                result = parse_auth_value(word.substr(option.size()));
+            }
+        }
+    }
+    return result;
+}
+
+std::unique_ptr<Jobserver> Jobserver::connect(JobserverAuth const & auth)
+{
+#if CLEANTEST_HAS_JOBSERVER
+    auto read = -1;
+    auto write = -1;
+    if (not auth.m_fifo.empty()) {
+        read = ::open(auth.m_fifo.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        write = (read < 0) ? -1 : ::open(auth.m_fifo.c_str(), O_WRONLY | O_CLOEXEC);
+    } else if (is_open(auth.m_read) and is_open(auth.m_write)) {
+        // Descriptors are only inherited for recursive make invocations (e.g. recipes prefixed with '+').
+        read = open_reader(auth.m_read);
+        write = ::fcntl(auth.m_write, F_DUPFD_CLOEXEC, 0);
+    }
+    if (read < 0 or write < 0) {
+        for (auto const fd : {read, write}) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+        return nullptr;
+    }
+    return std::unique_ptr<Jobserver>{new Jobserver{read, write}};
+#else
+    static_cast<void>(auth);
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<Jobserver> Jobserver::from_environment()
+{
+    auto const * const makeflags = std::getenv("MAKEFLAGS");
+    if (makeflags == nullptr) {
+        return nullptr;
+    }
+    auto const auth = parse_jobserver_auth(makeflags);
+    return auth ? connect(*auth) : nullptr;
+}
+
+Jobserver::~Jobserver()
+{
+#if CLEANTEST_HAS_JOBSERVER
+    for (auto const token : std::string{m_outstanding}) {
+        release(token);
+    }
+    ::close(m_read);
+    ::close(m_write);
+#endif
+}
+
+std::optional<Jobserver::Token> Jobserver::acquire(std::chrono::milliseconds const timeout)
+{
+#if CLEANTEST_HAS_JOBSERVER
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        auto token = Token{};
+        if (auto const num = ::read(m_read, &token, 1ul); num == 1) {
+            auto const lock = std::lock_guard{m_mutex};
+            m_outstanding.push_back(token);
+            return token;
+        } else if (num == 0 or (errno != EINTR and errno != EAGAIN and errno != EWOULDBLOCK)) {
+            return {}; // jobserver is gone
+        }
+
+        auto const remaining
+            = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) {
+            return {};
+        }
+        auto pending = ::pollfd{.fd = m_read, .events = POLLIN, .revents = 0};
+        ::poll(&pending, 1, static_cast<int>(std::min<decltype(remaining)>(remaining, 1'000'000)));
+    }
+#else
+    static_cast<void>(timeout);
+    return {};
+#endif
+}
+
+void Jobserver::release(Token const token)
+{
+#if CLEANTEST_HAS_JOBSERVER
+    auto const lock = std::lock_guard{m_mutex};
+    if (auto const pos = m_outstanding.find(token); pos != std::string::npos) {
+        m_outstanding.erase(pos, 1ul);
+    }
+    while (::write(m_write, &token, 1ul) < 0 and errno == EINTR) {
+    }
+#else
+    static_cast<void>(token);
+#endif
+}
+
+}
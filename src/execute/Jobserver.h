@@ -0,0 +1,69 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Connection details of a GNU make jobserver as advertised in @c MAKEFLAGS.
+class JobserverAuth {
+public:
+    std::string m_fifo = {}; //!< path of the named pipe holding the tokens (empty if inherited descriptors are used).
+    int m_read = -1; //!< inherited descriptor for reading tokens (if @c m_fifo is empty).
+    int m_write = -1; //!< inherited descriptor for returning tokens (if @c m_fifo is empty).
+
+    friend bool operator==(JobserverAuth const &, JobserverAuth const &) = default;
+};
+
+/// Parse the (last) jobserver of @p makeflags, i.e. "--jobserver-auth=fifo:PATH", "--jobserver-auth=R,W" or the
+/// legacy "--jobserver-fds=R,W"; nothing if there is none (or it's malformed).
+std::optional<JobserverAuth> parse_jobserver_auth(std::string_view makeflags);
+
+/// Client of a GNU make jobserver: Every token acquired permits running one additional job.
+///
+/// Every process owns one implicit token which doesn't need to be acquired: Only workers beyond the first one acquire
+/// a token before evaluating test-cases. Thus the overall parallelism of nested test executions is bounded by the
+/// enclosing build (e.g. `make -j64`) rather than multiplied per executable.
+class Jobserver {
+public:
+    using Token = char;
+
+    /// Connect to the jobserver of @p auth; nothing if its descriptors or its fifo aren't accessible.
+    static std::unique_ptr<Jobserver> connect(JobserverAuth const & auth);
+
+    /// Connect to the jobserver advertised in the environment variable @c MAKEFLAGS (if any).
+    static std::unique_ptr<Jobserver> from_environment();
+
+    /// Return all tokens which haven't been released (e.g. those of abandoned workers).
+    ~Jobserver();
+
+    /// Acquire a token waiting at most @p timeout; nothing if none became available.
+    std::optional<Token> acquire(std::chrono::milliseconds timeout);
+
+    /// Return @p token (acquired earlier) to the jobserver.
+    void release(Token token);
+
+    // non-copyable and non-movable
+    Jobserver(Jobserver &&) = delete;
+    Jobserver & operator=(Jobserver &&) = delete;
+    Jobserver(Jobserver const &) = delete;
+    Jobserver & operator=(Jobserver const &) = delete;
+
+private:
+    Jobserver(int read, int write) noexcept : m_read{read}, m_write{write}
+    {}
+
+    int const m_read; //!< owned, non-blocking descriptor for reading tokens.
+    int const m_write; //!< owned descriptor for returning tokens.
+    std::mutex m_mutex = {};
+    std::string m_outstanding = {}; //!< tokens acquired but not yet released.
+};
+
+}
@@ -0,0 +1,232 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Journal.h"
+
+#include "ResultCache.h"
+#include "Serialization.h"
+
+#if __has_include(<unistd.h>)
+# define CLEANTEST_HAS_FSYNC 1
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_FSYNC 0
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+
+namespace clean_test::execute {
+namespace {
+
+/// Type of a journal record (prefixing its payload).
+enum class RecordType : std::uint64_t {
+    start = 0, //!< followed by the name path of the starting test-case.
+    result = 1, //!< followed by the (compacted) result of a test-case and its worker process (+1; 0 if unknown).
+};
+
+/// Number of records after which the journal is synchronized to the disk.
+constexpr auto sync_batch = 64ul;
+
+/// Maximum duration records remain unsynchronized (while further records are appended).
+constexpr auto sync_interval = std::chrono::seconds{1};
+
+/// Record of @p type with @p payload (prefixed by its length).
+std::string make_record(RecordType const type, std::string_view const payload)
+{
+    auto body = std::string{};
+    encode_integer(body, static_cast<std::uint64_t>(type));
+    body.append(payload);
+    auto result = std::string{};
+    encode_integer(result, body.size());
+    return result.append(body);
+}
+
+/// Copy of @p result without the details of passed observations (which are irrelevant for resuming).
+CaseResult compact(CaseResult const & result)
+{
+    auto observations = CaseResult::Observations{};
+    std::copy_if(
+        result.m_observations.cbegin(),
+        result.m_observations.cend(),
+        std::back_inserter(observations),
+        [](Observation const & o) { return o.m_status != ObservationStatus::pass; });
+    auto compacted = CaseResult{result.m_name_path, result.m_status, result.m_wall_time, std::move(observations)};
+    compacted.m_stdout = result.m_stdout;
+    compacted.m_stderr = result.m_stderr;
+    compacted.m_statistics = result.m_statistics;
+    compacted.m_worker = result.m_worker;
+    return compacted;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Journal::Journal(std::filesystem::path const & path, bool const append) :
+    m_file{std::fopen(path.c_str(), append ? "ab" : "wb"), &std::fclose}
+{
+    if (not m_file) {
+        throw std::runtime_error{"Failed to open journal " + path.string() + '.'};
+    }
+}
+
+Journal::~Journal()
+{
+    auto const lock = std::lock_guard{m_mutex};
+    sync();
+}
+
+void Journal::on_case_start(std::string_view const name)
+{
+    auto payload = std::string{};
+    encode_text(payload, name);
+    auto const record = make_record(RecordType::start, payload);
+
+    auto const lock = std::lock_guard{m_mutex};
+    append(record);
+}
+
+void Journal::on_result(CaseResult const & result)
+{
+    if (static_cast<bool>(result.m_type)) {
+        return; // not a test-case
+    }
+    auto payload = std::string{};
+    encode_result(payload, compact(result));
+    encode_integer(payload, result.m_worker ? *result.m_worker + 1ul : 0ul);
+    auto const record = make_record(RecordType::result, payload);
+
+    auto const lock = std::lock_guard{m_mutex};
+    append(record);
+}
+
+void Journal::on_run_end(Duration)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    sync();
+}
+
+void Journal::append(std::string const & record)
+{
+    // Flushing hands the record to the operating system: It thus survives crashes (but not power losses) right away.
+    std::fwrite(record.data(), 1ul, record.size(), m_file.get());
+    std::fflush(m_file.get());
+    if (++m_num_unsynced >= sync_batch or Clock::now() - m_synced >= sync_interval) {
+        sync();
+    }
+}
+
+void Journal::sync()
+{
+    std::fflush(m_file.get());
+#if CLEANTEST_HAS_FSYNC
+    ::fsync(::fileno(m_file.get()));
+#endif
+    m_num_unsynced = 0ul;
+    m_synced = Clock::now();
+}
+
+std::optional<CaseResult> Resumption::lookup(framework::Name const & name) const
+{
+    if (auto const pos = m_completed.find(name.path()); pos != m_completed.cend()) {
+        return pos->second;
+    }
+    if (m_interrupted.contains(name.path())) {
+        auto observation = Observation{
+            {"unknown", 0u},
+            ObservationStatus::fail_asserted,
+            "Test-case was running when the previous execution got interrupted.",
+            {}};
+        return CaseResult{
+            std::string{name.path()}, CaseStatus::abort, CaseResult::Duration{}, {std::move(observation)}};
+    }
+    return {};
+}
+
+std::vector<std::string> Resumption::predecessors(std::string_view const name) const
+{
+    auto const last = std::find(m_started.crbegin(), m_started.crend(), name);
+    if (last == m_started.crend()) {
+        return {};
+    }
+
+    // Test-cases share their (static) state with all others executed by the same process.
+    auto const worker = [this](std::string_view const n) -> std::optional<std::size_t> {
+        auto const pos = m_completed.find(n);
+        return pos != m_completed.cend() ? pos->second.m_worker : std::nullopt;
+    };
+    auto const scope = worker(name);
+    auto result = std::vector<std::string>{};
+    auto seen = utils::StringSet{};
+    for (auto cur = m_started.cbegin(); cur != last.base() - 1; ++cur) {
+        if (*cur != name and (not scope or worker(*cur) == scope) and seen.emplace(*cur).second) {
+            result.emplace_back(*cur);
+        }
+    }
+    return result;
+}
+
+std::optional<CaseResult> previous_result(
+    framework::Name const & name, Resumption const * const resumption, ResultCache const * const cache)
+{
+    if (resumption != nullptr) {
+        if (auto result = resumption->lookup(name); result) {
+            return result;
+        }
+    }
+    if (cache != nullptr) {
+        return cache->lookup(name);
+    }
+    return {};
+}
+
+std::istream & operator>>(std::istream & in, Resumption & resumption)
+{
+    auto const content = std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    auto data = std::string_view{content};
+    auto started = utils::StringSet{};
+    try {
+        while (not data.empty()) {
+            auto const size = decode_integer(data);
+            if (size > data.size()) {
+                break; // truncated
+            }
+            auto record = data.substr(0ul, size);
+            data.remove_prefix(size);
+            switch (static_cast<RecordType>(decode_integer(record))) {
+                case RecordType::start:
+                    started.emplace(resumption.m_started.emplace_back(decode_text(record)));
+                    break;
+                case RecordType::result: {
+                    auto result = decode_result(record);
+                    if (not record.empty()) {
+                        if (auto const worker = decode_integer(record); worker > 0u) {
+                            result.m_worker = static_cast<std::size_t>(worker - 1u);
+                        }
+                    }
+                    started.erase(result.m_name_path);
+                    if (result.m_status != CaseStatus::skip) {
+                        auto name = result.m_name_path;
+                        resumption.m_completed.insert_or_assign(std::move(name), std::move(result));
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error{"Unknown journal record."};
+            }
+        }
+    } catch (std::runtime_error const &) {
+        // Truncated or malformed tail (e.g. of a crash while writing): All records before it are still valid.
+    }
+    for (auto & name : started) {
+        if (not resumption.m_completed.contains(name)) {
+            resumption.m_interrupted.emplace(name);
+        }
+    }
+    return in;
+}
+
+}
@@ -0,0 +1,107 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+#include <execute/Listener.h>
+
+#include <framework/Name.h>
+
+#include <utils/StringHash.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace clean_test::execute {
+class ResultCache;
+
+/// Append-only record of an execution, s.t. it can be resumed after being interrupted (c.f. @c Resumption).
+///
+/// Records the start of every test-case and its (compacted) result while the execution progresses. Every record is
+/// handed to the operating system immediately (thus survives crashes of this process); records are synchronized to the
+/// disk in batches. The serialized form is a sequence of length-prefixed records (c.f. @c Serialization).
+class Journal final : public Listener {
+public:
+    /// Detailed c'tor: Append to the journal at @p path (if @p append, else replace it); throws std::runtime_error if
+    /// the journal can't be opened.
+    Journal(std::filesystem::path const & path, bool append);
+
+    /// Non-trivial d'tor: Synchronizes all records to the disk.
+    ~Journal() final;
+
+    void on_case_start(std::string_view name) final;
+    void on_result(CaseResult const & result) final;
+    void on_run_end(Duration wall_time) final;
+
+    // non-copyable and non-movable
+    Journal(Journal &&) = delete;
+    Journal & operator=(Journal &&) = delete;
+    Journal(Journal const &) = delete;
+    Journal & operator=(Journal const &) = delete;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Append @p record (and synchronize if a batch is complete); requires @c m_mutex to be held.
+    void append(std::string const & record);
+
+    /// Synchronize all appended records to the disk; requires @c m_mutex to be held.
+    void sync();
+
+    std::mutex m_mutex = {};
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> m_file;
+    std::size_t m_num_unsynced = 0ul; //!< number of records appended since the last synchronization.
+    Clock::time_point m_synced = Clock::now(); //!< time of the last synchronization.
+};
+
+/// Results of an interrupted execution, recorded in its @c Journal, for resuming it (c.f. @c --resume).
+///
+/// Test-cases which completed aren't executed again: their recorded results are reported instead. Test-cases which
+/// were running when the execution got interrupted are reported as aborted. Skipped test-cases are executed again.
+class Resumption {
+public:
+    /// Result of the test-case @p name from the interrupted execution (if it completed or got interrupted).
+    std::optional<CaseResult> lookup(framework::Name const & name) const;
+
+    /// Number of test-cases which completed in the interrupted execution.
+    std::size_t num_completed() const noexcept
+    {
+        return m_completed.size();
+    }
+
+    /// Number of test-cases which were running when the execution got interrupted.
+    std::size_t num_interrupted() const noexcept
+    {
+        return m_interrupted.size();
+    }
+
+    /// Test-cases which started before the (latest) start of test-case @p name in the same process, i.e. on the same
+    /// worker process with isolated execution (in order of their start).
+    std::vector<std::string> predecessors(std::string_view name) const;
+
+    /// Import all records from @p in into @p resumption; a truncated trailing record (e.g. of a crash) is ignored.
+    friend std::istream & operator>>(std::istream & in, Resumption & resumption);
+
+private:
+    std::unordered_map<std::string, CaseResult, utils::StringHash, std::equal_to<>> m_completed = {};
+    utils::StringSet m_interrupted = {}; //!< test-cases which started but never completed.
+    std::vector<std::string> m_started = {}; //!< all test-cases in order of their start (including repeated ones).
+};
+
+/// Result of the test-case @p name from a previous execution, i.e. of the interrupted one of @p resumption or else
+/// from the @p cache (both are optional); nothing if the test-case must be executed.
+std::optional<CaseResult> previous_result(
+    framework::Name const & name, Resumption const * resumption, ResultCache const * cache);
+
+}
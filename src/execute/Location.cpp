@@ -0,0 +1,36 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "execute/Location.h"
+
+#include <utils/Guarded.h>
+
+#include <set>
+#include <string>
+
+namespace clean_test::execute {
+namespace {
+
+/// Process-wide storage for restored file names; intentionally never shrinks (there are only few distinct files).
+auto & interned_file_names()
+{
+    static auto singleton = utils::Guarded<std::set<std::string, std::less<>>>{};
+    return singleton;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Location::Location(std::string_view const file_name, std::uint_least32_t const line) :
+    m_file_name{[file_name] {
+        auto const names = interned_file_names().guard();
+        auto pos = names->find(file_name);
+        if (pos == names->end()) {
+            pos = names->emplace(file_name).first;
+        }
+        return pos->c_str();
+    }()},
+    m_line{line}
+{}
+
+}
@@ -6,18 +6,40 @@
 #include <framework/Registry.h>
 
 #include <execute/Badges.h>
+#include <execute/Bisection.h>
+#include <execute/BuildId.h>
 #include <execute/ColoringSetup.h>
 #include <execute/Conductor.h>
 #include <execute/Configuration.h>
+#include <execute/Distribution.h>
+#include <execute/Endpoint.h>
+#include <execute/FailureSet.h>
 #include <execute/HelpDisplay.h>
+#include <execute/History.h>
+#include <execute/Jobserver.h>
+#include <execute/Journal.h>
 #include <execute/JUnitExport.h>
 #include <execute/NameFilter.h>
+#include <execute/Orchestra.h>
+#include <execute/ProcessPool.h>
+#include <execute/ResultCache.h>
+#include <execute/ResultSink.h>
+#include <execute/Topology.h>
 #include <execute/TreeDisplay.h>
 
-#include <utils/RangesUtils.h>
+#include <utils/ScopeGuard.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace clean_test::execute {
 namespace {
@@ -27,14 +49,152 @@ ColorTable const & load_colors(Configuration const & cfg)
     return coloring_setup(cfg.m_coloring);
 }
 
+/// Load previously recorded @c FailureSet (if enabled); a missing file is a valid, empty @c FailureSet.
+std::optional<FailureSet> load_failures(Configuration const & cfg)
+{
+    if (cfg.m_failures_path.empty()) {
+        return {};
+    }
+
+    auto result = FailureSet{};
+    if (auto in = std::ifstream{cfg.m_failures_path}; in) {
+        in >> result;
+    }
+    return result;
+}
+
+/// Load the test-cases whose failures are tolerated (if enabled); a missing file is reported to @p logger.
+std::optional<FailureSet> load_quarantine(
+    std::ostream & logger, Configuration const & cfg, ColorTable const & colors)
+{
+    if (cfg.m_quarantine_path.empty()) {
+        return {};
+    }
+
+    auto result = FailureSet{};
+    if (auto in = std::ifstream{cfg.m_quarantine_path}; in) {
+        in >> result;
+    } else {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Warning: Failed to read quarantine "
+            << cfg.m_quarantine_path << "; no test-case is quarantined." << colors[Color::off] << std::endl;
+    }
+    return result;
+}
+
 auto load_filter(Configuration const & cfg)
 {
-    return NameFilter{cfg.m_filter_settings};
+    auto result = NameFilter{cfg.m_filter_settings};
+    if (cfg.m_rerun_failed) {
+        result.select(load_failures(cfg).value_or(FailureSet{}).names());
+    }
+    return result;
 }
 
-void serialize(std::ostream & logger, std::filesystem::path const & path, ColorTable const & colors, auto && data) {
+/// Load previously recorded @c History (if enabled); a missing file is a valid, empty @c History.
+std::optional<History> load_history(Configuration const & cfg)
+{
+    if (cfg.m_history_path.empty()) {
+        return {};
+    }
+
+    auto result = History{};
+    if (auto in = std::ifstream{cfg.m_history_path}; in) {
+        in >> result;
+    }
+    return result;
+}
+
+/// Load results cached by previous executions of this build with equivalent configuration (if enabled).
+///
+/// Caching is disabled (with a warning to @p logger ) if the build of this executable can't be identified.
+std::optional<ResultCache> load_cache(std::ostream & logger, Configuration const & cfg, ColorTable const & colors)
+{
+    if (cfg.m_cache_path.empty()) {
+        return {};
+    }
+
+    auto const id = build_id();
+    if (id.empty()) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: Result cache disabled since this executable has no GNU build-id." << colors[Color::off]
+            << std::endl;
+        return {};
+    }
+
+    // All settings which (potentially) influence the results of test-cases are part of the key.
+    auto key = std::ostringstream{};
+    key << id << "\tisolation=" << static_cast<int>(cfg.m_isolation) << "\ttimeout=" << cfg.m_timeout.count()
+        << "\ton-timeout=" << static_cast<int>(cfg.m_on_timeout);
+    auto result = ResultCache{std::move(key).str()};
+    if (auto in = std::ifstream{cfg.m_cache_path}; in) {
+        in >> result;
+    }
+    return result;
+}
+
+/// Load the results of the interrupted execution recorded in the journal (if resuming); a missing journal is valid.
+std::optional<Resumption> load_resumption(
+    std::ostream & logger, Configuration const & cfg, ColorTable const & colors)
+{
+    if (not cfg.m_resume) {
+        return {};
+    }
+
+    auto result = Resumption{};
+    if (auto in = std::ifstream{cfg.m_journal_path, std::ios::binary}; in) {
+        in >> result;
+    }
+    logger
+        << colors[Color::good] << badge(BadgeType::headline) << " Resuming: " << result.num_completed()
+        << " test-cases completed and " << result.num_interrupted() << " were interrupted." << colors[Color::off]
+        << std::endl;
+    return result;
+}
+
+/// Open the journal (if enabled), appending to it when resuming; reports any failures to @p logger.
+std::optional<Journal> open_journal(std::ostream & logger, Configuration const & cfg, ColorTable const & colors)
+{
+    if (cfg.m_journal_path.empty()) {
+        return {};
+    }
+
+    try {
+        return std::optional<Journal>{std::in_place, cfg.m_journal_path, cfg.m_resume};
+    } catch (std::runtime_error const & xcp) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Warning: " << xcp.what() << colors[Color::off]
+            << std::endl;
+        return {};
+    }
+}
+
+/// Connect to the jobserver of an enclosing GNU make (if enabled).
+///
+/// Execution proceeds without any jobserver (with a warning to @p logger ) if none is accessible.
+std::unique_ptr<Jobserver> connect_jobserver(
+    std::ostream & logger, Configuration const & cfg, ColorTable const & colors)
+{
+    if (not cfg.m_jobserver) {
+        return nullptr;
+    }
+
+    auto result = Jobserver::from_environment();
+    if (not result) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline)
+            << " Warning: No accessible jobserver in MAKEFLAGS; executing without one." << colors[Color::off]
+            << std::endl;
+    }
+    return result;
+}
+
+/// Open @p path for writing (if enabled); reports any failures to @p logger.
+std::optional<std::ofstream> open(std::ostream & logger, std::filesystem::path const & path, ColorTable const & colors)
+{
     if (path.empty()) {
-        return;
+        return {};
     }
 
     auto out = std::ofstream{path, std::ios_base::trunc | std::ios_base::out};
@@ -42,28 +202,297 @@ void serialize(std::ostream & logger, std::filesystem::path const & path, ColorT
         logger
             << colors[Color::bad] << badge(BadgeType::headline) << colors[Color::off]
             << " Error: Failed to write report into " << path << ".\n";
-        return;
+        return {};
+    }
+    return out;
+}
+
+void serialize(std::ostream & logger, std::filesystem::path const & path, ColorTable const & colors, auto && data) {
+    if (auto out = open(logger, path, colors); out) {
+        *out << data;
+    }
+}
+
+/// Sink for recording all results into a persistent @tparam Record (e.g. a @c History ) via its @c update.
+template <typename Record>
+class Recorder final : public ResultSink {
+public:
+    explicit Recorder(Record & record) : m_record{record}
+    {}
+
+private:
+    void consume_impl(CaseResult const & result) final
+    {
+        m_record.update(result);
+    }
+
+    void finish_impl(Outcome::Duration) final
+    {}
+
+    Record & m_record;
+};
+
+/// Sink for counting all results which failed (skipped test-cases didn't fail).
+class FailureCounter final : public ResultSink {
+public:
+    std::size_t m_num_failed = 0ul;
+
+private:
+    void consume_impl(CaseResult const & result) final
+    {
+        m_num_failed += not tolerated(result);
+    }
+
+    void finish_impl(Outcome::Duration) final
+    {}
+};
+
+/// Display the enabled test-cases in the configured @c ListingFormat.
+void list(std::ostream & logger, Configuration const & cfg)
+{
+    switch (cfg.m_listing) {
+        case ListingFormat::tree:
+            logger << TreeDisplay{framework::registry(), {load_colors(cfg), load_filter(cfg), cfg.m_depth}};
+            break;
+        case ListingFormat::names: {
+            auto const filter = load_filter(cfg);
+            for (auto const & tc : framework::registry()) {
+                if (not static_cast<bool>(filter(tc.name()))) {
+                    continue;
+                }
+                logger << tc.name().path();
+                for (auto const & tag : tc.name().tags()) {
+                    logger << '\t' << static_cast<std::string_view>(tag);
+                }
+                logger << '\n';
+            }
+            break;
+        }
+        default:
+            std::terminate();
     }
-    out << data;
 }
 
-int run(std::ostream & logger, Configuration const & cfg)
+int run(std::ostream & logger, Configuration const & cfg, Orchestra const * orchestra = nullptr)
 {
     auto const & colors = load_colors(cfg);
     auto const filter = load_filter(cfg);
+
+    // Results are streamed into all sinks (and not retained), s.t. memory consumption is independent of their number.
+    auto failures = FailureCounter{};
+    auto sinks = std::vector<ResultSink *>{&failures};
+    auto junit_file = open(logger, cfg.m_junit_path, colors);
+    auto junit = std::optional<JUnitStream>{};
+    if (junit_file) {
+        sinks.emplace_back(&junit.emplace(*junit_file));
+    }
+    auto history = load_history(cfg);
+    auto history_recorder = std::optional<Recorder<History>>{};
+    if (history) {
+        sinks.emplace_back(&history_recorder.emplace(*history));
+    }
+    auto failed = load_failures(cfg);
+    auto failure_recorder = std::optional<Recorder<FailureSet>>{};
+    if (failed) {
+        sinks.emplace_back(&failure_recorder.emplace(*failed));
+    }
+    auto cache = load_cache(logger, cfg, colors);
+    auto cache_recorder = std::optional<Recorder<ResultCache>>{};
+    if (cache) {
+        sinks.emplace_back(&cache_recorder.emplace(*cache));
+    }
+    auto const quarantine = load_quarantine(logger, cfg, colors);
+    auto const resumption = load_resumption(logger, cfg, colors);
+    auto journal = open_journal(logger, cfg, colors);
+    auto listeners = cfg.m_listeners;
+    if (journal) {
+        listeners.emplace_back(&*journal);
+    }
+    auto const jobserver = connect_jobserver(logger, cfg, colors);
+    auto const coordination = Endpoint::parse(cfg.m_coordination); // validated while parsing (if given)
+
     auto const conductor = Conductor{{
         .m_logger = logger,
         .m_colors = colors,
         .m_num_workers = cfg.m_num_jobs,
+        .m_adaptive_workers = cfg.m_adaptive_jobs,
         .m_buffering = cfg.m_buffering,
-        .m_filter = filter}};
+        .m_filter = filter,
+        .m_history = history ? &*history : nullptr,
+        .m_ordering = cfg.m_ordering,
+        .m_cache = cache ? &*cache : nullptr,
+        .m_resumption = resumption ? &*resumption : nullptr,
+        .m_quarantine = quarantine ? &*quarantine : nullptr,
+        .m_isolation = cfg.m_isolation,
+        .m_coordination = cfg.m_coordination.empty() ? nullptr : &*coordination,
+        .m_orchestra = orchestra,
+        .m_pinning = cfg.m_pinning,
+        .m_jobserver = jobserver.get(),
+        .m_shard_index = cfg.m_shard_index,
+        .m_num_shards = cfg.m_num_shards,
+        .m_timeout = cfg.m_timeout,
+        .m_on_timeout = cfg.m_on_timeout,
+        .m_max_failures = cfg.m_max_failures,
+        .m_repetitions = cfg.m_repetitions,
+        .m_until_fail = cfg.m_until_fail,
+        .m_retries = cfg.m_retries,
+        .m_interruptible = true,
+        .m_sinks = std::move(sinks),
+        .m_listeners = std::move(listeners),
+        .m_retain_results = false}};
+    auto const outcome = conductor.run();
 
-    auto outcome = conductor.run();
-    serialize(logger, cfg.m_junit_path, colors, JUnitExport{outcome});
+    if (history) {
+        serialize(logger, cfg.m_history_path, colors, *history);
+    }
+    if (failed) {
+        serialize(logger, cfg.m_failures_path, colors, *failed);
+    }
+    if (cache) {
+        serialize(logger, cfg.m_cache_path, colors, *cache);
+    }
 
-    return static_cast<int>(std::min<std::size_t>(
-        std::numeric_limits<int>::max(),
-        utils::count_if(outcome.m_results, [](auto const & r) { return r.m_status != CaseStatus::pass; })));
+    // An interrupted execution never passes (even if all of its executed test-cases did).
+    auto const num_failed = std::max<std::size_t>(failures.m_num_failed, outcome.m_interrupted ? 1ul : 0ul);
+    return static_cast<int>(std::min<std::size_t>(std::numeric_limits<int>::max(), num_failed));
+}
+
+/// Execute test-cases handed out by the configured coordinator (until it is done).
+int work(std::ostream & logger, Configuration const & cfg)
+{
+    auto const & colors = load_colors(cfg);
+    auto const coordinator = Endpoint::parse(cfg.m_coordinator);
+    if (not coordinator) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Error: Invalid coordinator address "
+            << cfg.m_coordinator << '.' << colors[Color::off] << std::endl;
+        return 1;
+    }
+
+    logger
+        << colors.colored(Color::good, badge(BadgeType::title)) << " Working for " << coordinator->address()
+        << std::endl;
+    try {
+        auto const num_executed = work_for(*coordinator, framework::registry(), colors);
+        logger
+            << colors.colored(Color::good, badge(BadgeType::title)) << " Executed " << num_executed
+            << " test-cases" << std::endl;
+    } catch (std::runtime_error const & xcp) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Error: " << xcp.what() << colors[Color::off]
+            << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+/// Execute (or list) the test-cases of the configured binaries, represented by the proxies of an @c Orchestra.
+int run_binaries(std::ostream & logger, Configuration const & cfg)
+{
+    auto const & colors = load_colors(cfg);
+    auto orchestra = std::optional<Orchestra>{};
+    try {
+        orchestra.emplace(cfg.m_binaries);
+    } catch (std::runtime_error const & xcp) {
+        logger
+            << colors[Color::bad] << badge(BadgeType::headline) << " Error: " << xcp.what() << colors[Color::off]
+            << std::endl;
+        return 1;
+    }
+
+    // The names of the proxies refer to the orchestra: They are registered only as long as it exists.
+    auto & registry = framework::registry();
+    auto const num_registered = registry.size();
+    auto proxies = orchestra->cases();
+    registry.insert(registry.end(), std::make_move_iterator(proxies.begin()), std::make_move_iterator(proxies.end()));
+    auto const unregister = utils::ScopeGuard{[&registry, num_registered] {
+        registry.erase(registry.begin() + static_cast<std::ptrdiff_t>(num_registered), registry.end());
+    }};
+
+    switch (cfg.m_operation) {
+        case OperationMode::list:
+            list(logger, cfg);
+            return 0;
+        case OperationMode::run:
+            return run(logger, cfg, &*orchestra);
+        case OperationMode::help:
+        case OperationMode::bisect:
+        case OperationMode::work:
+        default:
+            std::terminate(); // guarded by main
+    }
+}
+
+/// Narrow down which test-cases pollute the configured victim, among those executed before it in the recorded journal.
+int bisect_pollution(std::ostream & logger, Configuration const & cfg)
+{
+    auto const & colors = load_colors(cfg);
+    auto const error = [&logger, &colors](auto const &... details) {
+        logger << colors[Color::bad] << badge(BadgeType::headline) << " Error: ";
+        (logger << ... << details) << colors[Color::off] << std::endl;
+        return 1;
+    };
+    if (not supports_isolation()) {
+        return error("Bisecting requires forking processes, which isn't supported on this platform.");
+    }
+    auto recorded = Resumption{};
+    if (auto in = std::ifstream{cfg.m_journal_path, std::ios::binary}; in) {
+        in >> recorded;
+    } else {
+        return error("Failed to read journal ", cfg.m_journal_path, '.');
+    }
+
+    auto & cases = framework::registry();
+    auto const find = [&cases](std::string_view const name) -> std::optional<std::size_t> {
+        auto const pos = std::find_if(cases.cbegin(), cases.cend(), [name](framework::Case const & tc) {
+            return tc.name().path() == name;
+        });
+        return pos != cases.cend() ? std::optional{static_cast<std::size_t>(pos - cases.cbegin())} : std::nullopt;
+    };
+    auto const & victim = cfg.m_pollution_victim;
+    auto const victim_index = find(victim);
+    if (not victim_index) {
+        return error("Unknown test-case ", victim, '.');
+    }
+    auto candidates = std::vector<std::size_t>{};
+    for (auto const & name : recorded.predecessors(victim)) {
+        if (auto const index = find(name); index) {
+            candidates.emplace_back(*index);
+        }
+    }
+
+    logger
+        << colors.colored(Color::good, badge(BadgeType::title)) << " Bisecting " << candidates.size()
+        << " test-cases executed before " << victim << std::endl;
+    auto const num_parallel = cfg.m_num_jobs == 0ul ? available_cpus() : cfg.m_num_jobs;
+    auto const bisection
+        = bisect(candidates.size(), num_parallel, forked_trials(cases, candidates, *victim_index, num_parallel));
+    switch (bisection.m_verdict) {
+        case Bisection::Verdict::polluted:
+            logger
+                << colors[Color::bad] << badge(BadgeType::headline) << ' ' << victim << " fails after "
+                << bisection.m_culprits.size() << " polluting test-case(s):" << colors[Color::off] << '\n';
+            for (auto const culprit : bisection.m_culprits) {
+                logger << "    " << cases[candidates[culprit]].name().path() << '\n';
+            }
+            break;
+        case Bisection::Verdict::self_failing:
+            logger
+                << colors[Color::bad] << badge(BadgeType::headline) << ' ' << victim
+                << " fails on its own: It isn't polluted by other test-cases." << colors[Color::off] << '\n';
+            break;
+        case Bisection::Verdict::unreproducible:
+            logger
+                << colors[Color::bad] << badge(BadgeType::headline) << ' ' << victim
+                << " passes even after all test-cases executed before it." << colors[Color::off] << '\n';
+            break;
+        default:
+            std::terminate();
+    }
+    logger
+        << colors.colored(Color::good, badge(BadgeType::title)) << " Ran " << bisection.m_num_trials << " trials in "
+        << bisection.m_num_rounds << " rounds" << std::endl;
+    return bisection.m_verdict == Bisection::Verdict::polluted ? 0 : 1;
 }
 
 }
@@ -81,21 +510,95 @@ int main(int argc, char ** argv)
     }
 }
 
+int orchestrate(int argc, char ** argv)
+{
+    // Options precede the binaries (separated by "--").
+    auto const separator
+        = std::find_if(argv, argv + argc, [](char const * arg) { return arg == std::string_view{"--"}; });
+    auto const num_options = static_cast<int>(separator - argv);
+    try {
+        auto cfg = Configuration::parse(num_options, argv);
+        if (separator != argv + argc) {
+            cfg.m_binaries.assign(separator + 1, argv + argc);
+        }
+
+        auto const unsupported = [&cfg]() -> std::string_view {
+            if (cfg.m_operation == OperationMode::bisect) {
+                return "--bisect-pollution";
+            }
+            if (cfg.m_operation == OperationMode::work) {
+                return "--work-for";
+            }
+            if (not cfg.m_coordination.empty()) {
+                return "--coordinate";
+            }
+            if (cfg.m_isolation != IsolationMode::off) {
+                return "--isolate";
+            }
+            if (cfg.m_pinning != PinningMode::off) {
+                return "--pin";
+            }
+            if (cfg.m_adaptive_jobs) {
+                return "--jobs=adaptive";
+            }
+            if (cfg.m_jobserver) {
+                return "--jobserver";
+            }
+            if (not cfg.m_cache_path.empty()) {
+                return "--cache";
+            }
+            return {};
+        }();
+        if (not unsupported.empty()) {
+            throw std::invalid_argument{
+                "Option " + std::string{unsupported} + " isn't supported for multiple binaries."};
+        }
+        if (cfg.m_operation == OperationMode::help) {
+            auto & logger = (cfg.m_logger ? *cfg.m_logger : std::cout);
+            logger
+                << "Usage: " << argv[0] << " [OPTION...] -- BINARY...\n"
+                   "Executes the test-cases of all BINARY (built with Clean Test) in one pool of worker processes.\n"
+                   "They are named by the file name of their BINARY (followed by their own name) and all OPTIONs\n"
+                   "apply to them together.\n\n";
+            return main(cfg);
+        }
+        if (cfg.m_binaries.empty()) {
+            throw std::invalid_argument{"Missing test binaries (after \"--\")."};
+        }
+        return main(cfg);
+    } catch (std::invalid_argument const & xcp) {
+        std::cout
+            << coloring_setup(ColoringMode::automatic).colored(Color::bad, "ERROR")
+            << ": Failed to parse command line. " << xcp.what() << '\n';
+        return 1;
+    }
+}
+
 int main(Configuration const & cfg)
 {
     auto & logger = (cfg.m_logger ? *cfg.m_logger : std::cout);
+    if (not cfg.m_binaries.empty()
+        and (cfg.m_operation == OperationMode::list or cfg.m_operation == OperationMode::run)) {
+        return run_binaries(logger, cfg);
+    }
     switch (cfg.m_operation) {
         case OperationMode::help:
             logger << HelpDisplay{load_colors(cfg)};
             break;
 
         case OperationMode::list:
-            logger << TreeDisplay{framework::registry(), {load_colors(cfg), load_filter(cfg), cfg.m_depth}};
+            list(logger, cfg);
             break;
 
         case OperationMode::run:
             return run(logger, cfg);
 
+        case OperationMode::bisect:
+            return bisect_pollution(logger, cfg);
+
+        case OperationMode::work:
+            return work(logger, cfg);
+
         default:
             std::terminate();
     }
@@ -76,6 +76,9 @@ NameFilter::NameFilter(std::vector<NameFilterSetting> const & settings)
 
 NameFilterToggle NameFilter::operator()(framework::Name const & name) const
 {
+    if (m_selection and m_selection->find(name.path()) == m_selection->cend()) {
+        return NameFilterToggle::disabled;
+    }
     for (auto const & matcher : m_matchers) {
         if (auto const toggle = matcher(name); toggle) {
             return *toggle;
@@ -90,4 +93,9 @@ void NameFilter::add(NameFilterToggle toggle, NameFilterProperty property, std::
     m_default = NameFilterToggle{not static_cast<bool>(toggle)};
 }
 
+void NameFilter::select(utils::StringSet paths)
+{
+    m_selection = std::move(paths);
+}
+
 }
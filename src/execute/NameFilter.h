@@ -5,6 +5,9 @@
 
 #include <execute/NameFilterSetting.h>
 
+#include <utils/StringHash.h>
+
+#include <optional>
 #include <regex>
 #include <string_view>
 #include <vector>
@@ -22,6 +25,9 @@ namespace clean_test::execute {
 ///
 /// Example: Assume one added filter with "^a"-pattern on @c NameFilterProperty::path with @c NameFilterToggle::enabled.
 /// This disables all cases but those whose @c Name 's path starts with "a".
+///
+/// Additionally, the filter can be restricted to an explicit selection of name paths (c.f. @c ::select). These are
+/// looked up by hash (rather than being matched by patterns) and are considered before all other criteria.
 class NameFilter {
 public:
     // Explicitly default all c'tors / d'tor to avoid instantiation of the @c std::vector with fwd declared Matcher.
@@ -43,10 +49,14 @@ public:
     /// Advise to return @p toggle when @p pattern matches @p property of a name.
     void add(NameFilterToggle toggle, NameFilterProperty property, std::string_view pattern);
 
+    /// Disable all test-cases whose path is not among the @p paths (exact matches only).
+    void select(utils::StringSet paths);
+
 private:
     class Matcher;
 
     NameFilterToggle m_default = NameFilterToggle::enabled;
     std::vector<Matcher> m_matchers;
+    std::optional<utils::StringSet> m_selection = {}; //!< the only enabled paths (if restricted at all).
 };
 }
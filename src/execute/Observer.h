@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "Observation.h"
+#include <execute/Observation.h>
 
 #include <utils/Guarded.h>
 
@@ -0,0 +1,784 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Orchestra.h"
+
+#include "CaseReporter.h"
+#include "Distribution.h"
+#include "Endpoint.h"
+#include "Frames.h"
+#include "Journal.h"
+#include "NameFilter.h"
+#include "Resources.h"
+#include "Retries.h"
+#include "Scheduler.h"
+#include "Serialization.h"
+#include "Watchdog.h"
+
+#include <framework/Cancellation.h>
+#include <framework/ConcreteCaseRunner.h>
+
+#if __has_include(<sys/wait.h>) and __has_include(<poll.h>) and __has_include(<sys/socket.h>)                        \
+    and __has_include(<unistd.h>)
+# define CLEANTEST_HAS_ORCHESTRATION 1
+# include <fcntl.h>
+# include <poll.h>
+# include <signal.h>
+# include <sys/socket.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_ORCHESTRATION 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+/// Placeholder for executing proxy test-cases, which are executed by worker processes of their binary only.
+void remote(Observer &)
+{
+    std::terminate();
+}
+
+/// Split @p line into its fields separated by @p separator.
+std::vector<std::string_view> split(std::string_view line, char const separator)
+{
+    auto result = std::vector<std::string_view>{};
+    for (auto pos = line.find(separator); pos != std::string_view::npos; pos = line.find(separator)) {
+        result.emplace_back(line.substr(0ul, pos));
+        line.remove_prefix(pos + 1ul);
+    }
+    result.emplace_back(line);
+    return result;
+}
+
+#if CLEANTEST_HAS_ORCHESTRATION
+
+using Clock = DeadlineClock;
+
+/// Interval for checking whether starting worker processes exited prematurely.
+constexpr auto start_poll_interval = std::chrono::milliseconds{100};
+
+/// Commandline for executing a binary, prepared before forking: The forked process only calls async-signal-safe
+/// functions (i.e. doesn't allocate) until executing it.
+class Command {
+public:
+    /// Detailed c'tor: Execute @p binary with @p arguments.
+    Command(std::filesystem::path const & binary, std::vector<std::string> arguments) :
+        m_arguments{std::move(arguments)}
+    {
+        m_arguments.insert(m_arguments.begin(), binary.string());
+        for (auto & argument : m_arguments) {
+            m_argv.emplace_back(argument.data());
+        }
+        m_argv.emplace_back(nullptr);
+    }
+
+    /// Replace the current (forked) process by executing the command.
+    [[noreturn]] void exec() const noexcept
+    {
+        ::execv(m_argv.front(), m_argv.data());
+        ::_exit(127);
+    }
+
+private:
+    std::vector<std::string> m_arguments; //!< including the binary (in front).
+    std::vector<char *> m_argv = {}; //!< referring to @c m_arguments (terminated by @c nullptr ).
+};
+
+/// Wait for process @p pid to exit and return its exit status.
+int reap(::pid_t const pid)
+{
+    auto status = 0;
+    while (::waitpid(pid, &status, 0) < 0 and errno == EINTR) {
+    }
+    return status;
+}
+
+/// Standard output of executing @p binary with @p arguments; throws std::runtime_error unless it exits successfully.
+std::string output_of(std::filesystem::path const & binary, std::vector<std::string> arguments)
+{
+    auto const command = Command{binary, std::move(arguments)};
+    int channel[2];
+    if (::pipe(channel) != 0) {
+        throw std::runtime_error{"Failed to create pipe for listing " + binary.string() + '.'};
+    }
+    std::cout.flush();
+    std::fflush(nullptr); // avoid duplicating pending output
+    auto const pid = ::fork();
+    if (pid == 0) {
+        ::dup2(channel[1], STDOUT_FILENO);
+        ::close(channel[0]);
+        ::close(channel[1]);
+        command.exec();
+    }
+    ::close(channel[1]);
+    if (pid < 0) {
+        ::close(channel[0]);
+        throw std::runtime_error{"Failed to fork process for listing " + binary.string() + '.'};
+    }
+
+    auto result = std::string{};
+    char buffer[4096];
+    while (true) {
+        auto const num = ::read(channel[0], buffer, sizeof(buffer));
+        if (num > 0) {
+            result.append(buffer, static_cast<std::size_t>(num));
+        } else if (num == 0 or errno != EINTR) {
+            break;
+        }
+    }
+    ::close(channel[0]);
+    if (auto const status = reap(pid); not WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS) {
+        throw std::runtime_error{"Failed to list test-cases of " + binary.string() + '.'};
+    }
+    return result;
+}
+
+/// Fresh directory for the sockets of the worker processes.
+std::filesystem::path make_directory()
+{
+    auto const result
+        = std::filesystem::temp_directory_path() / ("clean-test-run-" + std::to_string(::getpid()) + ".d");
+    std::filesystem::remove_all(result);
+    std::filesystem::create_directory(result);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pool of worker processes executing test-cases of multiple binaries: The (single-threaded) main process only
+/// dispatches test-cases.
+class Orchestration {
+public:
+    Orchestration(
+        framework::Registry & cases,
+        Plan const & plan,
+        DependencyGraph const & dependencies,
+        Conductor::Setup const & setup,
+        ResultPipeline & results,
+        FailureBudget & budget,
+        Repetitions & repetitions) :
+        m_cases{cases},
+        m_setup{setup},
+        m_orchestra{*setup.m_orchestra},
+        m_scheduler{make_scheduler(SchedulingMode::shared_cursor, plan, 1ul)},
+        m_resources{*m_scheduler, repetitions, requirements(cases, setup.m_filter), dependencies, setup.m_memory},
+        m_reporter{{.m_output = setup.m_logger, .m_colors = setup.m_colors, .m_buffering = setup.m_buffering}},
+        m_results{results},
+        m_budget{budget},
+        m_repetitions{repetitions},
+        m_retries{cases.size(), setup.m_retries, setup.m_quarantine},
+        m_queues(m_orchestra.binaries().size()),
+        m_broken(m_orchestra.binaries().size(), false),
+        m_directory{make_directory()}
+    {}
+
+    ~Orchestration()
+    {
+        for (auto & worker : m_workers) {
+            if (worker.m_pid > 0) {
+                retire(worker);
+            }
+        }
+        auto ignored = std::error_code{};
+        std::filesystem::remove_all(m_directory, ignored);
+    }
+
+    // non-copyable and non-movable
+    Orchestration(Orchestration &&) = delete;
+    Orchestration & operator=(Orchestration &&) = delete;
+    Orchestration(Orchestration const &) = delete;
+    Orchestration & operator=(Orchestration const &) = delete;
+
+    void run() &&
+    {
+        while (true) {
+            schedule();
+            if (finished()) {
+                break;
+            }
+            await();
+            std::erase_if(m_workers, [](Worker const & worker) { return worker.m_pid < 0; });
+        }
+    }
+
+private:
+    /// One worker process (of a single binary) and its connection.
+    class Worker {
+    public:
+        ::pid_t m_pid = -1; //!< -1 once retired.
+        std::size_t m_binary = 0ul; //!< index of the binary executed by the worker.
+        std::size_t m_number = 0ul; //!< number of the worker process (counting all processes spawned before).
+        std::filesystem::path m_socket = {}; //!< where the worker connects to.
+        int m_listener = -1; //!< socket accepting the connection of the worker (until it connected).
+        int m_fd = -1; //!< connection to the worker (once it connected).
+        bool m_greeted = false; //!< whether the worker sent its greeting (c.f. @c greeting) via @c m_fd.
+        std::optional<std::size_t> m_copy = {}; //!< copy currently evaluated by the worker (if any).
+        Clock::time_point m_start = {}; //!< when evaluation of @c m_copy started.
+        CaseResult::Duration m_timeout = {}; //!< limit for evaluating @c m_copy (0 for unlimited).
+    };
+
+    /// Index of the binary executing @p copy.
+    std::size_t binary(std::size_t const copy) const
+    {
+        return m_orchestra.origin(m_cases[m_repetitions.case_index(copy)].name().path())->m_binary;
+    }
+
+    /// Number of worker processes which haven't been retired.
+    std::size_t num_alive() const
+    {
+        return static_cast<std::size_t>(
+            std::count_if(m_workers.cbegin(), m_workers.cend(), [](Worker const & w) { return w.m_pid > 0; }));
+    }
+
+    /// Whether @p worker would be idle (i.e. may be replaced by a worker of another binary).
+    bool vacant(Worker const & worker) const
+    {
+        return worker.m_pid > 0 and not worker.m_copy and m_queues[worker.m_binary].empty();
+    }
+
+    /// Hand out queued copies to idle workers and claim further ones as long as any of them finds a worker.
+    void schedule()
+    {
+        for (auto b = 0ul; b < m_queues.size(); ++b) {
+            cover(b);
+        }
+        for (auto w = 0ul; w < m_workers.size(); ++w) {
+            dispatch(m_workers[w]);
+        }
+        while (not m_stopped
+               and (num_alive() < m_setup.m_num_workers
+                    or std::any_of(m_workers.cbegin(), m_workers.cend(), [this](Worker const & w) {
+                           return vacant(w);
+                       }))) {
+            auto const copy = claim();
+            if (not copy) {
+                break;
+            }
+            auto const b = binary(*copy);
+            m_queues[b].emplace_back(*copy);
+            cover(b);
+            for (auto w = 0ul; w < m_workers.size(); ++w) {
+                dispatch(m_workers[w]);
+            }
+        }
+    }
+
+    /// Claim the next copy to be executed by a worker: Test-cases which are skipped, have been executed previously or
+    /// belong to a binary which can't be executed are handed on right away. Nothing if no copy is available (right
+    /// now).
+    std::optional<std::size_t> claim()
+    {
+        while (true) {
+            auto const copy = m_resources.next(0ul).m_copy;
+            if (not copy) {
+                return {};
+            }
+            auto const index = m_repetitions.case_index(*copy);
+            auto & tc = m_cases[index];
+            if (framework::cancellation_requested() or not static_cast<bool>(m_setup.m_filter(tc.name()))
+                or not m_resources.satisfied(index)) {
+                deliver(*copy, CaseResult{std::string{tc.name().path()}, CaseStatus::skip, CaseResult::Duration{}, {}});
+                m_resources.release(index);
+                continue;
+            }
+            if (auto previous = previous_result(tc.name(), m_setup.m_resumption, m_setup.m_cache); previous) {
+                deliver(*copy, std::move(*previous));
+                m_resources.release(index);
+                continue;
+            }
+            if (m_broken[binary(*copy)]) {
+                abandon(*copy);
+                continue;
+            }
+            return copy;
+        }
+    }
+
+    /// Ensure that the queued copies of binary @p b find workers: Start further ones, replacing idle workers of other
+    /// binaries once the pool is full.
+    void cover(std::size_t const b)
+    {
+        auto const supply = [this, b] {
+            return static_cast<std::size_t>(std::count_if(m_workers.cbegin(), m_workers.cend(), [b](Worker const & w) {
+                return w.m_pid > 0 and w.m_binary == b and not w.m_copy;
+            }));
+        };
+        while (m_queues[b].size() > supply()) {
+            if (num_alive() >= m_setup.m_num_workers) {
+                auto const spare = std::find_if(m_workers.begin(), m_workers.end(), [this, b](Worker const & w) {
+                    return w.m_binary != b and vacant(w);
+                });
+                if (spare == m_workers.end()) {
+                    return;
+                }
+                retire(*spare);
+            }
+            spawn(b);
+        }
+    }
+
+    /// Start a (new) worker process of binary @p b.
+    void spawn(std::size_t const b)
+    {
+        auto worker = Worker{.m_binary = b, .m_number = m_num_spawned++};
+        worker.m_socket = m_directory / (std::to_string(worker.m_number) + ".sock");
+        auto const address = "unix:" + worker.m_socket.string();
+        worker.m_listener = Endpoint::parse(address)->listen();
+        auto const command = Command{m_orchestra.binaries()[b], {"--work-for=" + address, "--color=never"}};
+
+        m_setup.m_logger.flush();
+        std::fflush(nullptr); // avoid duplicating pending output
+        auto const paused = m_results.pause(); // the worker doesn't inherit any locks held by its consumer
+        auto const pid = ::fork();
+        if (pid == 0) {
+            if (m_setup.m_interruptible) {
+                // Signals (e.g. of the terminal) reach the whole process group: The main process drains the workers.
+                ::signal(SIGINT, SIG_IGN);
+                ::signal(SIGTERM, SIG_IGN);
+            }
+            if (auto const null = ::open("/dev/null", O_WRONLY); null >= 0) {
+                ::dup2(null, STDOUT_FILENO); // results are reported by the main process
+            }
+            command.exec();
+        }
+        if (pid < 0) {
+            ::close(worker.m_listener);
+            throw std::runtime_error{"Failed to fork worker process of " + m_orchestra.label(b) + '.'};
+        }
+        worker.m_pid = pid;
+        m_workers.emplace_back(std::move(worker));
+    }
+
+    /// Shut down (and await) the process of @p worker.
+    void retire(Worker & worker)
+    {
+        if (worker.m_fd >= 0) {
+            auto finished = std::string{};
+            encode_integer(finished, 0ul); // an empty batch tells the worker to finish
+            static_cast<void>(write_frame(worker.m_fd, finished));
+        } else {
+            ::kill(worker.m_pid, SIGKILL);
+        }
+        release(worker);
+        reap(worker.m_pid);
+        worker.m_pid = -1;
+    }
+
+    /// Close all sockets of @p worker.
+    void release(Worker & worker)
+    {
+        if (worker.m_listener >= 0) {
+            ::close(std::exchange(worker.m_listener, -1));
+            auto ignored = std::error_code{};
+            std::filesystem::remove(worker.m_socket, ignored);
+        }
+        if (worker.m_fd >= 0) {
+            ::close(std::exchange(worker.m_fd, -1));
+        }
+    }
+
+    /// Hand out the next queued copy (of its binary) to @p worker (if it is idle).
+    void dispatch(Worker & worker)
+    {
+        auto & queue = m_queues[worker.m_binary];
+        if (worker.m_pid < 0 or worker.m_fd < 0 or worker.m_copy or queue.empty()) {
+            return;
+        }
+        auto const copy = queue.front();
+        queue.pop_front();
+        auto const & tc = m_cases[m_repetitions.case_index(copy)];
+        auto request = std::string{};
+        encode_integer(request, 1ul);
+        encode_text(request, m_orchestra.origin(tc.name().path())->m_path);
+        worker.m_copy = copy;
+        worker.m_start = Clock::now();
+        worker.m_timeout = timeout(tc.name(), m_setup.m_timeout);
+        announce(tc.name().path());
+        if (not write_frame(worker.m_fd, request)) {
+            crashed(worker);
+        }
+    }
+
+    /// Whether all copies have been finished (or no further ones should be handed out).
+    bool finished() const
+    {
+        auto const busy = std::any_of(m_workers.cbegin(), m_workers.cend(), [](Worker const & w) {
+            return w.m_pid > 0 and w.m_copy;
+        });
+        auto const queued = std::any_of(m_queues.cbegin(), m_queues.cend(), [](auto const & q) {
+            return not q.empty();
+        });
+        // Without any busy worker, all workers are vacant: further copies have been claimed if there were any.
+        return not busy and (m_stopped or not queued);
+    }
+
+    /// Wait for connections, results or crashes of workers (or the expiry of a timeout).
+    void await()
+    {
+        auto fds = std::vector<::pollfd>{};
+        auto owners = std::vector<std::size_t>{};
+        for (auto w = 0ul; w < m_workers.size(); ++w) {
+            if (auto const & worker = m_workers[w]; worker.m_pid > 0) {
+                auto const fd = (worker.m_fd >= 0) ? worker.m_fd : worker.m_listener;
+                fds.emplace_back(::pollfd{.fd = fd, .events = POLLIN, .revents = 0});
+                owners.emplace_back(w);
+            }
+        }
+        if (::poll(fds.data(), fds.size(), poll_timeout()) < 0) {
+            if (errno != EINTR) {
+                throw std::runtime_error{"Failed to wait for worker processes."};
+            }
+            return;
+        }
+
+        for (auto i = 0ul; i < fds.size(); ++i) {
+            if (auto & worker = m_workers[owners[i]]; fds[i].revents != 0) {
+                if (worker.m_fd >= 0) {
+                    receive(worker);
+                } else {
+                    accept(worker);
+                }
+            }
+        }
+        auto const now = Clock::now();
+        for (auto & worker : m_workers) {
+            if (worker.m_pid > 0 and worker.m_fd < 0) {
+                failed_start(worker);
+            } else if (worker.m_pid > 0 and worker.m_copy and worker.m_timeout != CaseResult::Duration{}
+                       and worker.m_start + worker.m_timeout <= now) {
+                expired(worker);
+            }
+        }
+    }
+
+    /// Milliseconds until the earliest deadline of any busy worker; -1 (i.e. infinite) if there is no deadline.
+    ///
+    /// Workers which haven't connected yet are checked periodically (c.f. @c failed_start).
+    int poll_timeout() const
+    {
+        auto result = -1;
+        auto const now = Clock::now();
+        for (auto const & worker : m_workers) {
+            if (worker.m_pid > 0 and worker.m_fd < 0) {
+                auto const interval = static_cast<int>(start_poll_interval.count());
+                result = (result < 0) ? interval : std::min(result, interval);
+            }
+            if (worker.m_pid > 0 and worker.m_copy and worker.m_timeout != CaseResult::Duration{}) {
+                auto const remaining
+                    = std::chrono::ceil<std::chrono::milliseconds>(worker.m_start + worker.m_timeout - now).count();
+                auto const bounded = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, 1'000'000));
+                result = (result < 0) ? bounded : std::min(result, bounded);
+            }
+        }
+        return result;
+    }
+
+    /// Accept the connection of (starting) @p worker.
+    void accept(Worker & worker)
+    {
+        auto const fd = ::accept(worker.m_listener, nullptr, nullptr);
+        if (fd < 0) {
+            return; // e.g. aborted by the worker in the meantime
+        }
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC); // not inherited by subsequently started workers
+        release(worker);
+        worker.m_fd = fd;
+    }
+
+    /// Handle (starting) @p worker which exited before connecting: Its binary can't be executed.
+    void failed_start(Worker & worker)
+    {
+        auto status = 0;
+        if (::waitpid(worker.m_pid, &status, WNOHANG) != worker.m_pid) {
+            return;
+        }
+        release(worker);
+        worker.m_pid = -1;
+        auto const b = worker.m_binary;
+        m_broken[b] = true;
+        while (not m_queues[b].empty()) {
+            auto const copy = m_queues[b].front();
+            m_queues[b].pop_front();
+            abandon(copy);
+        }
+    }
+
+    /// Report @p copy (of a binary which can't be executed) as aborted.
+    void abandon(std::size_t const copy)
+    {
+        auto const index = m_repetitions.case_index(copy);
+        auto const & tc = m_cases[index];
+        auto const b = binary(copy);
+        auto details = "Failed to start worker process of " + m_orchestra.binaries()[b].string() + '.';
+        auto observation = Observation{{"unknown", 0u}, ObservationStatus::fail_asserted, std::move(details), {}};
+        auto result
+            = CaseResult{std::string{tc.name().path()}, CaseStatus::abort, CaseResult::Duration{}, {observation}};
+        announce(tc.name().path());
+        report(result);
+        deliver(copy, std::move(result));
+        m_resources.release(index);
+    }
+
+    /// Import result of the current copy of @p worker (or handle the crash of its process).
+    ///
+    /// Workers execute other binaries (i.e. builds) than this one: Their greeting isn't checked for the build-id.
+    void receive(Worker & worker)
+    {
+        auto const frame = read_frame(worker.m_fd);
+        if (frame and not worker.m_greeted and greeted_build(*frame)) {
+            worker.m_greeted = true;
+            return;
+        }
+        if (not frame or not worker.m_copy) {
+            crashed(worker); // idle workers mustn't send anything
+            return;
+        }
+
+        auto data = std::string_view{*frame};
+        auto result = decode_result(data); // the console output of the worker is reported from the result instead
+        result.m_name_path = m_cases[m_repetitions.case_index(*worker.m_copy)].name().path();
+        result.m_worker = worker.m_number;
+        report(result);
+        vacate(worker, std::move(result));
+    }
+
+    /// Report @p worker as crashed while evaluating its current copy (if any).
+    void crashed(Worker & worker)
+    {
+        release(worker);
+        auto const status = reap(worker.m_pid);
+        worker.m_pid = -1;
+        if (not worker.m_copy) {
+            return;
+        }
+
+        auto details = std::ostringstream{};
+        if (WIFSIGNALED(status)) {
+            details << "Worker process terminated by signal " << WTERMSIG(status) << " (" << strsignal(WTERMSIG(status))
+                    << ").";
+        } else {
+            details << "Worker process exited unexpectedly with status " << WEXITSTATUS(status) << '.';
+        }
+        auto const & tc = m_cases[m_repetitions.case_index(*worker.m_copy)];
+        auto observation = Observation{{"unknown", 0u}, ObservationStatus::fail_asserted, std::move(details).str(), {}};
+        auto result = CaseResult{
+            std::string{tc.name().path()}, CaseStatus::abort, elapsed_since(worker.m_start), {std::move(observation)}};
+        result.m_worker = worker.m_number;
+        report(result);
+        vacate(worker, std::move(result));
+    }
+
+    /// Kill @p worker which exceeded the timeout of its current copy (and stop, depending on the setup).
+    void expired(Worker & worker)
+    {
+        auto busy = std::vector<Activity>{};
+        for (auto const & other : m_workers) {
+            if (other.m_pid > 0 and other.m_copy) {
+                auto const name = m_cases[m_repetitions.case_index(*other.m_copy)].name().path();
+                busy.emplace_back(Activity{other.m_number, name, elapsed_since(other.m_start)});
+            }
+        }
+        auto const name = m_cases[m_repetitions.case_index(*worker.m_copy)].name().path();
+        report_timeout(m_setup, name, worker.m_timeout, std::move(busy));
+
+        ::kill(worker.m_pid, SIGKILL);
+        release(worker);
+        reap(worker.m_pid);
+        worker.m_pid = -1;
+        auto result = timeout_result(name, worker.m_timeout);
+        result.m_worker = worker.m_number;
+        replay(result);
+        vacate(worker, std::move(result));
+
+        switch (m_setup.m_on_timeout) {
+            case TimeoutMode::proceed:
+                break;
+            case TimeoutMode::terminate:
+                m_stopped = true;
+                break;
+            default:
+                std::terminate();
+        }
+    }
+
+    /// Hand on @p result of the current copy of @p worker (releasing its resources).
+    void vacate(Worker & worker, CaseResult result)
+    {
+        auto const copy = *std::exchange(worker.m_copy, std::nullopt);
+        deliver(copy, std::move(result));
+        m_resources.release(m_repetitions.case_index(copy));
+    }
+
+    /// Report all events of @p result (which occurred in a worker process) under the name of its proxy.
+    void report(CaseResult const & result)
+    {
+        m_reporter(CaseReporter::Start{result.m_name_path});
+        for (auto const & observation : result.m_observations) {
+            m_reporter(observation);
+        }
+        m_reporter(CaseReporter::Stop{result.m_name_path, result.m_wall_time, result.m_status});
+        replay(result);
+    }
+
+    /// Notify all listeners about the start of the test-case with @p name when handing it out to a worker (s.t. it is
+    /// journaled as interrupted if this process is killed before its result arrives).
+    void announce(std::string_view const name) const
+    {
+        for (auto * listener : m_setup.m_listeners) {
+            listener->on_case_start(name);
+        }
+    }
+
+    /// Notify all listeners about the remaining events of @p result (c.f. @c announce).
+    void replay(CaseResult const & result) const
+    {
+        auto const name = std::string_view{result.m_name_path};
+        for (auto * listener : m_setup.m_listeners) {
+            for (auto const & observation : result.m_observations) {
+                listener->on_observation(name, observation);
+            }
+            listener->on_case_stop(name, result.m_status, result.m_wall_time);
+        }
+    }
+
+    /// Hand @p result of executing @p copy on to the @c m_results (accounting for it in the @c m_budget and settling it
+    /// for its dependents).
+    ///
+    /// Failed attempts are handed out once more instead (c.f. @c m_retries), s.t. the next idle worker retries them.
+    /// Results of repeated test-cases are collected in @c m_repetitions instead (for combining them later).
+    void deliver(std::size_t const copy, CaseResult result)
+    {
+        if (m_retries.retry(copy, result)) {
+            m_resources.retry(copy);
+            return;
+        }
+        result = m_retries.finish(copy, std::move(result));
+        m_budget.account(result);
+        m_resources.settle(copy, result.m_status);
+        if (m_repetitions.aggregates()) {
+            m_repetitions.add(copy, std::move(result));
+        } else {
+            m_results.push(std::move(result));
+        }
+    }
+
+    framework::Registry & m_cases;
+    Conductor::Setup const & m_setup;
+    Orchestra const & m_orchestra;
+    std::unique_ptr<Scheduler> m_scheduler;
+    ResourceScheduler m_resources; //!< hands out copies of @c m_scheduler once their resources are available.
+    CaseReporter m_reporter; //!< output facility for the results of all workers (listeners are notified separately).
+    IgnoreBrokenPipes const m_ignore_broken_pipes = {};
+    ResultPipeline & m_results;
+    FailureBudget & m_budget;
+    Repetitions & m_repetitions; //!< maps planned copies to test-cases and collects results of repeated ones.
+    Retries m_retries; //!< decides which failed test-cases are executed again.
+    std::vector<std::deque<std::size_t>> m_queues; //!< claimed copies awaiting a worker (by index of binary).
+    std::vector<bool> m_broken; //!< whether worker processes can't be started (by index of binary).
+    std::filesystem::path const m_directory; //!< for the sockets of the workers.
+    std::vector<Worker> m_workers = {};
+    std::size_t m_num_spawned = 0ul; //!< number of worker processes spawned so far.
+    bool m_stopped = false; //!< whether no further test-cases should be handed out.
+};
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Orchestra::Orchestra(std::vector<std::filesystem::path> binaries) : m_binaries{std::move(binaries)}
+{
+#if CLEANTEST_HAS_ORCHESTRATION
+    for (auto b = 0ul; b < m_binaries.size(); ++b) {
+        auto const base = m_binaries[b].filename().string();
+        auto label = base;
+        for (auto n = 2ul; std::find(m_labels.cbegin(), m_labels.cend(), label) != m_labels.cend(); ++n) {
+            label = base + '~' + std::to_string(n);
+        }
+        auto const & prefix = m_labels.emplace_back(std::move(label));
+
+        auto listing = std::istringstream{output_of(m_binaries[b], {"--list", "--format=names", "--color=never"})};
+        for (auto line = std::string{}; std::getline(listing, line);) {
+            if (line.empty()) {
+                continue;
+            }
+            auto const fields = split(line, '\t');
+            auto name = framework::Name{prefix} / fields.front();
+            for (auto pos = fields.cbegin() + 1; pos != fields.cend(); ++pos) {
+                // Dependencies refer to test-cases of the same binary.
+                auto tag = pos->starts_with("after:") ? "after:" + prefix + '/' + std::string{pos->substr(6ul)}
+                                                      : std::string{*pos};
+                name /= framework::Tag{m_tags.emplace_back(std::move(tag))};
+            }
+            m_origins.emplace(std::string{name.path()}, Origin{b, std::string{fields.front()}});
+            m_names.emplace_back(std::move(name));
+        }
+    }
+#else
+    throw std::runtime_error{"Executing multiple test binaries is not supported on this platform."};
+#endif
+}
+
+framework::Registry Orchestra::cases() const
+{
+    auto const runner = std::make_shared<framework::ConcreteCaseRunner<void (*)(Observer &)>>(&remote);
+    auto result = framework::Registry{};
+    result.reserve(m_names.size());
+    for (auto const & name : m_names) {
+        result.emplace_back(name, runner);
+    }
+    return result;
+}
+
+Orchestra::Origin const * Orchestra::origin(std::string_view const path) const
+{
+    auto const pos = m_origins.find(path);
+    return (pos != m_origins.cend()) ? &pos->second : nullptr;
+}
+
+bool supports_orchestration() noexcept
+{
+    return CLEANTEST_HAS_ORCHESTRATION;
+}
+
+void execute_orchestrated(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions)
+{
+#if CLEANTEST_HAS_ORCHESTRATION
+    Orchestration{cases, plan, dependencies, setup, results, budget, repetitions}.run();
+#else
+    static_cast<void>(cases);
+    static_cast<void>(plan);
+    static_cast<void>(dependencies);
+    static_cast<void>(setup);
+    static_cast<void>(results);
+    static_cast<void>(budget);
+    static_cast<void>(repetitions);
+    std::terminate(); // guarded by supports_orchestration()
+#endif
+}
+
+}
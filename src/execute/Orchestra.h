@@ -0,0 +1,97 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Conductor.h"
+#include "Dependencies.h"
+#include "FailureBudget.h"
+#include "Plan.h"
+#include "Repetitions.h"
+#include "ResultPipeline.h"
+
+#include <framework/Registry.h>
+
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Test-cases of several test binaries (built with Clean Test), which are executed together (c.f.
+/// @c execute_orchestrated).
+///
+/// Every test-case is represented by a proxy named by the label of its binary (i.e. its file name, made unique by a
+/// suffix if required) followed by its own name path; the proxy carries its tags (with @c after dependencies relative
+/// to the binary). Proxies can't be executed by this process.
+class Orchestra {
+public:
+    /// Origin of a proxy test-case.
+    class Origin {
+    public:
+        std::size_t m_binary; //!< index of the binary.
+        std::string m_path; //!< name path within the binary.
+    };
+
+    /// Detailed c'tor: Enumerate the test-cases of all @p binaries via their listing of @c ListingFormat::names.
+    ///
+    /// Throws std::runtime_error if any of the binaries can't be listed.
+    explicit Orchestra(std::vector<std::filesystem::path> binaries);
+
+    [[nodiscard]] std::vector<std::filesystem::path> const & binaries() const noexcept
+    {
+        return m_binaries;
+    }
+
+    /// Label of the binary with @p index (first component of the names of its proxies).
+    [[nodiscard]] std::string const & label(std::size_t index) const
+    {
+        return m_labels.at(index);
+    }
+
+    /// Proxies of all test-cases (in order of the binaries and their listing).
+    [[nodiscard]] framework::Registry cases() const;
+
+    /// Origin of the proxy test-case with name @p path; @c nullptr if unknown.
+    [[nodiscard]] Origin const * origin(std::string_view path) const;
+
+    // non-copyable and non-movable (the names of the proxies refer to the stored tags)
+    Orchestra(Orchestra &&) = delete;
+    Orchestra & operator=(Orchestra &&) = delete;
+    Orchestra(Orchestra const &) = delete;
+    Orchestra & operator=(Orchestra const &) = delete;
+
+private:
+    std::vector<std::filesystem::path> m_binaries;
+    std::vector<std::string> m_labels; //!< by index of binary.
+    std::deque<std::string> m_tags = {}; //!< storage of all tags (referenced by @c m_names).
+    std::vector<framework::Name> m_names = {}; //!< of all proxies.
+    std::map<std::string, Origin, std::less<>> m_origins = {}; //!< by name path of the proxies.
+};
+
+/// Whether executing test-cases of several binaries (c.f. @c execute_orchestrated) is supported on this platform.
+bool supports_orchestration() noexcept;
+
+/// Execute the proxy @p cases of the @c m_orchestra of @p setup according to @p plan (respecting their
+/// @p dependencies) in one global pool of worker processes (as many as workers of @p setup).
+///
+/// Every worker process executes test-cases of a single binary (c.f. @c work_for), one after another: Workers are
+/// started on demand and reused for subsequent test-cases of the same binary. Once the pool is full, idle workers of
+/// other binaries are replaced. Their results are handed on to @p results (and accounted for in the failure
+/// @p budget) under the names of the proxies. Crashing workers are reported as aborted; those exceeding the timeout
+/// of their test-case are killed. The @p plan covers all copies of the @p repetitions.
+void execute_orchestrated(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions);
+
+}
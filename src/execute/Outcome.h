@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "CaseResult.h"
+#include <execute/CaseResult.h>
 
 #include <chrono>
 #include <vector>
@@ -19,6 +19,7 @@ public:
 
     Duration m_wall_time; //!< elapsed wall-time of entire test-case execution.
     Results m_results; //!< test-case specific results of all executed tests.
+    bool m_interrupted = false; //!< whether execution has been drained after a signal (c.f. @c InterruptionSetup).
 };
 
 }
@@ -0,0 +1,80 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Plan.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+namespace clean_test::execute {
+
+Plan registration_order(std::size_t const num_cases)
+{
+    auto result = Plan{.m_order = std::vector<std::size_t>(num_cases)};
+    std::iota(result.m_order.begin(), result.m_order.end(), 0ul);
+    return result;
+}
+
+Plan longest_first(std::vector<Plan::Duration> const & estimates, std::size_t const num_workers)
+{
+    auto result = registration_order(estimates.size());
+    auto & order = result.m_order;
+    std::stable_sort(order.begin(), order.end(), [&estimates](std::size_t const l, std::size_t const r) {
+        return estimates[l] > estimates[r];
+    });
+
+    // Greedy assignment: next (i.e. longest remaining) case goes to the currently least loaded worker.
+    using Load = std::pair<Plan::Duration, std::size_t>; // accumulated load and worker index
+    auto loads = std::priority_queue<Load, std::vector<Load>, std::greater<>>{};
+    for (auto w = 0ul; w < num_workers; ++w) {
+        loads.emplace(Plan::Duration{}, w);
+    }
+    result.m_workers.reserve(order.size());
+    for (auto const index : order) {
+        auto [load, worker] = loads.top();
+        loads.pop();
+        result.m_workers.emplace_back(worker);
+        load += estimates[index];
+        result.m_makespan = std::max(result.m_makespan, load);
+        loads.emplace(load, worker);
+    }
+    return result;
+}
+
+Plan riskiest_first(Plan const & plan, std::vector<std::uint64_t> const & risks, std::size_t const num_workers)
+{
+    auto const num_cases = plan.m_order.size();
+    auto positions = std::vector<std::size_t>(num_cases);
+    std::iota(positions.begin(), positions.end(), 0ul);
+    auto const risky_end = std::stable_partition(positions.begin(), positions.end(), [&](std::size_t const pos) {
+        return risks[plan.m_order[pos]] != 0u;
+    });
+    std::stable_sort(positions.begin(), risky_end, [&](std::size_t const l, std::size_t const r) {
+        return risks[plan.m_order[l]] > risks[plan.m_order[r]];
+    });
+
+    // The makespan of the reordered plan is unknown (thus not predicted).
+    auto result = Plan{};
+    result.m_order.reserve(num_cases);
+    result.m_workers.reserve(num_cases);
+    auto const num_risky = static_cast<std::size_t>(risky_end - positions.begin());
+    auto const num_others = num_cases - num_risky;
+    for (auto i = 0ul; i < num_cases; ++i) {
+        auto const pos = positions[i];
+        result.m_order.emplace_back(plan.m_order[pos]);
+        if (i < num_risky) {
+            result.m_workers.emplace_back(i % num_workers);
+        } else if (not plan.m_workers.empty()) {
+            result.m_workers.emplace_back(plan.m_workers[pos]);
+        } else {
+            // Contiguous shares of (almost) equal size, as for plans without preferred workers.
+            result.m_workers.emplace_back((i - num_risky) * num_workers / num_others);
+        }
+    }
+    return result;
+}
+
+}
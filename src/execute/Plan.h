@@ -0,0 +1,46 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Intended distribution of test-cases onto workers, i.e. in which order and on which worker cases should be run.
+class Plan {
+public:
+    using Duration = CaseResult::Duration;
+
+    /// Case indices in the order in which they should be started.
+    std::vector<std::size_t> m_order;
+
+    /// Preferred worker for the case at the corresponding position of @c m_order.
+    ///
+    /// The special value of @c {} (empty) denotes an equal split of @c m_order into contiguous ranges.
+    std::vector<std::size_t> m_workers = {};
+
+    /// Expected wall time until all cases have been run (or zero if unknown).
+    Duration m_makespan = {};
+};
+
+/// Plan @p num_cases to be run in registration order.
+Plan registration_order(std::size_t num_cases);
+
+/// Plan cases with expected durations @p estimates on @p num_workers with the longest processing time first.
+///
+/// Cases are sorted by descending duration (ties in registration order) and each is greedily assigned to the worker
+/// with the least accumulated load.
+Plan longest_first(std::vector<Plan::Duration> const & estimates, std::size_t num_workers);
+
+/// Plan cases with nonzero @p risks (by index) before all others of @p plan on @p num_workers.
+///
+/// Risky cases are sorted by descending risk (ties in order of @p plan) and dealt to the workers round-robin, s.t.
+/// every worker starts with them. The other cases follow in order of @p plan (on their planned workers, if any).
+Plan riskiest_first(Plan const & plan, std::vector<std::uint64_t> const & risks, std::size_t num_workers);
+
+}
@@ -0,0 +1,651 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ProcessPool.h"
+
+#include "Badges.h"
+#include "ResultCache.h"
+#include "CaseEvaluator.h"
+#include "CaseReporter.h"
+#include "ColorTable.h"
+#include "Frames.h"
+#include "Jobserver.h"
+#include "Journal.h"
+#include "NameFilter.h"
+#include "Resources.h"
+#include "Retries.h"
+#include "Scheduler.h"
+#include "Serialization.h"
+#include "Topology.h"
+#include "Watchdog.h"
+
+#include <framework/Cancellation.h>
+#include <framework/CancellationSetup.h>
+
+#include <utils/OSyncStream.h>
+
+#if __has_include(<sys/wait.h>) and __has_include(<poll.h>) and __has_include(<unistd.h>)
+# define CLEANTEST_HAS_PROCESS_POOL 1
+# include <poll.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_PROCESS_POOL 0
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace clean_test::execute {
+namespace {
+
+#if CLEANTEST_HAS_PROCESS_POOL
+
+using Clock = DeadlineClock;
+
+/// Entire current content of (regular) file @p fd.
+std::string content(int const fd)
+{
+    struct stat info;
+    if (::fstat(fd, &info) != 0 or info.st_size <= 0) {
+        return {};
+    }
+    auto result = std::string(static_cast<std::size_t>(info.st_size), '\0');
+    auto const num = ::pread(fd, result.data(), result.size(), 0);
+    result.resize(static_cast<std::size_t>(std::max<decltype(num)>(num, 0)));
+    return result;
+}
+
+/// Discard everything written to (regular) file @p fd so far.
+void clear(int const fd)
+{
+    if (::ftruncate(fd, 0) == 0) {
+        ::lseek(fd, 0, SEEK_SET);
+    }
+}
+
+/// Flush all buffered output of the standard streams into their file descriptors.
+void flush_standard_streams()
+{
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+}
+
+/// Temporary file for capturing the output of a standard stream; removed automatically.
+class CaptureFile {
+public:
+    CaptureFile() : m_file{std::tmpfile()}
+    {
+        if (m_file == nullptr) {
+            throw std::runtime_error{"Failed to create capture file for isolated execution."};
+        }
+    }
+
+    ~CaptureFile()
+    {
+        std::fclose(m_file);
+    }
+
+    CaptureFile(CaptureFile const &) = delete;
+    CaptureFile & operator=(CaptureFile const &) = delete;
+
+    int fd() const
+    {
+        return ::fileno(m_file);
+    }
+
+private:
+    std::FILE * m_file;
+};
+
+/// Scoped relocation of the cancellation flag into memory shared with all (subsequently forked) worker processes.
+///
+/// The current state of the flag is carried over in both directions (i.e. into the shared memory and back).
+class SharedCancellation {
+public:
+    using Flag = framework::CancellationSetup::Flag;
+
+    SharedCancellation() :
+        m_memory{::mmap(nullptr, sizeof(Flag), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)}
+    {
+        if (m_memory == MAP_FAILED) {
+            throw std::runtime_error{"Failed to allocate shared memory for isolated execution."};
+        }
+        m_setup.emplace(*new (m_memory) Flag{framework::cancellation_requested()});
+    }
+
+    ~SharedCancellation()
+    {
+        auto const cancelled = framework::cancellation_requested();
+        m_setup.reset();
+        if (cancelled) {
+            framework::CancellationSetup::request();
+        }
+        ::munmap(m_memory, sizeof(Flag));
+    }
+
+    SharedCancellation(SharedCancellation const &) = delete;
+    SharedCancellation & operator=(SharedCancellation const &) = delete;
+
+private:
+    void * m_memory;
+    std::optional<framework::CancellationSetup> m_setup = {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pool of worker processes: Forked from the main process, which only dispatches cases.
+///
+/// Besides the dispatching thread, only the consumer of the @c ResultPipeline is running (possibly along idle threads
+/// of a @c ThreadPool): It is paused while forking (c.f. @c spawn), s.t. workers inherit no locks held by it.
+class ProcessPool {
+public:
+    ProcessPool(
+        framework::Registry & cases,
+        Plan const & plan,
+        DependencyGraph const & dependencies,
+        Conductor::Setup const & setup,
+        ResultPipeline & results,
+        FailureBudget & budget,
+        Repetitions & repetitions) :
+        m_cases{cases},
+        m_setup{setup},
+        m_scheduler{make_scheduler(setup.m_scheduling, plan, setup.m_num_workers)},
+        m_resources{*m_scheduler, repetitions, requirements(cases, setup.m_filter), dependencies, setup.m_memory},
+        m_reporter{{.m_output = setup.m_logger, .m_colors = setup.m_colors, .m_buffering = setup.m_buffering}},
+        m_slots(setup.m_num_workers),
+        m_results{results},
+        m_budget{budget},
+        m_repetitions{repetitions},
+        m_retries{cases.size(), setup.m_retries, setup.m_quarantine},
+        m_cpus{setup.m_pinning == PinningMode::cores ? pinning_order() : std::vector<std::size_t>{}}
+    {
+        for (auto & slot : m_slots) {
+            spawn(slot);
+        }
+    }
+
+    ~ProcessPool()
+    {
+        for (auto & slot : m_slots) {
+            retire(slot);
+        }
+    }
+
+    ProcessPool(ProcessPool const &) = delete;
+    ProcessPool & operator=(ProcessPool const &) = delete;
+
+    void run() &&
+    {
+        while (true) {
+            for (auto s = 0ul; s < m_slots.size(); ++s) {
+                if (not m_slots[s].m_copy) {
+                    dispatch(s);
+                }
+            }
+            if (not await_results()) {
+                break;
+            }
+        }
+    }
+
+private:
+    /// One worker process and its communication channels.
+    class Slot {
+    public:
+        ::pid_t m_pid = -1;
+        int m_request = -1; //!< pipe for sending case indices to the worker.
+        int m_response = -1; //!< pipe for receiving results from the worker.
+        CaptureFile m_stdout = {}; //!< where the worker's standard output ends up.
+        CaptureFile m_stderr = {}; //!< where the worker's standard error ends up.
+        std::optional<std::size_t> m_copy = {}; //!< copy of the case currently evaluated by the worker (if any).
+        Clock::time_point m_start = {}; //!< when evaluation of @c m_copy started.
+        CaseResult::Duration m_timeout = {}; //!< limit for evaluating @c m_copy (0 for unlimited).
+        std::optional<Jobserver::Token> m_token = {}; //!< held while evaluating @c m_copy (if required).
+        std::size_t m_worker = 0ul; //!< number of the worker process (counting all processes spawned before).
+    };
+
+    /// Fork a (new) worker process for @p slot.
+    void spawn(Slot & slot)
+    {
+        int request[2];
+        int response[2];
+        if (::pipe(request) != 0) {
+            throw std::runtime_error{"Failed to create pipe for isolated execution."};
+        }
+        if (::pipe(response) != 0) {
+            ::close(request[0]);
+            ::close(request[1]);
+            throw std::runtime_error{"Failed to create pipe for isolated execution."};
+        }
+
+        m_setup.m_logger.flush();
+        flush_standard_streams(); // avoid duplicating pending output
+        auto const paused = m_results.pause(); // e.g. its sinks may hold locks of streams or a journal
+        auto const pid = ::fork();
+        if (pid == 0) {
+            ::close(request[1]);
+            ::close(response[0]);
+            for (auto const & other : m_slots) {
+                ::close(other.m_request);
+                ::close(other.m_response);
+            }
+            if (not m_cpus.empty()) {
+                pin_current_thread(m_cpus[static_cast<std::size_t>(&slot - m_slots.data()) % m_cpus.size()]);
+            }
+            serve(request[0], response[1], slot.m_stdout.fd(), slot.m_stderr.fd());
+        }
+
+        ::close(request[0]);
+        ::close(response[1]);
+        if (pid < 0) {
+            ::close(request[1]);
+            ::close(response[0]);
+            throw std::runtime_error{"Failed to fork worker process for isolated execution."};
+        }
+        slot.m_pid = pid;
+        slot.m_worker = m_num_spawned++;
+        slot.m_request = request[1];
+        slot.m_response = response[0];
+    }
+
+    /// Shut down worker process of @p slot (if any) and return its exit status.
+    int retire(Slot & slot)
+    {
+        ::close(slot.m_request);
+        ::close(slot.m_response);
+        slot.m_request = slot.m_response = -1;
+
+        auto status = 0;
+        if (slot.m_pid > 0) {
+            while (::waitpid(slot.m_pid, &status, 0) < 0 and errno == EINTR) {
+            }
+        }
+        slot.m_pid = -1;
+        return status;
+    }
+
+    /// Main loop of a worker process: Evaluate requested cases until the request pipe is closed.
+    [[noreturn]] void serve(int const request, int const response, int const out, int const err)
+    {
+        try {
+            ::dup2(out, STDOUT_FILENO);
+            ::dup2(err, STDERR_FILENO);
+            if (m_setup.m_interruptible) {
+                // Signals (e.g. of the terminal) reach the whole process group: The main process drains the workers.
+                ::signal(SIGINT, SIG_IGN);
+                ::signal(SIGTERM, SIG_IGN);
+            }
+
+            auto console = std::ostringstream{};
+            auto evaluator = CaseEvaluator{
+                {.m_output = console, .m_colors = m_setup.m_colors, .m_buffering = BufferingMode::off}, true};
+            while (auto const frame = read_frame(request)) {
+                auto data = std::string_view{*frame};
+                auto const index = decode_integer(data);
+
+                flush_standard_streams();
+                clear(out);
+                clear(err);
+                auto result = evaluator(m_cases.at(index));
+                flush_standard_streams();
+                result.m_stdout = content(out);
+                result.m_stderr = content(err);
+
+                auto buffer = std::string{};
+                encode_result(buffer, result);
+                encode_text(buffer, console.str());
+                console.str({});
+                if (not write_frame(response, buffer)) {
+                    break;
+                }
+            }
+        } catch (...) {
+            ::_exit(EXIT_FAILURE);
+        }
+        ::_exit(EXIT_SUCCESS); // skip any cleanup: that's the responsibility of the main process.
+    }
+
+    /// Hand out the next enabled case to worker process @p s (if there are any left and it is admitted to).
+    void dispatch(std::size_t const s)
+    {
+        auto & slot = m_slots[s];
+        while (not m_stopped and admitted(s)) {
+            auto const copy = m_resources.next(s).m_copy;
+            if (not copy) {
+                break;
+            }
+            auto const index = m_repetitions.case_index(*copy);
+            auto & tc = m_cases[index];
+            if (framework::cancellation_requested() or not static_cast<bool>(m_setup.m_filter(tc.name()))
+                or not m_resources.satisfied(index)) {
+                deliver(*copy, CaseResult{std::string{tc.name().path()}, CaseStatus::skip, CaseResult::Duration{}, {}});
+                m_resources.release(index);
+                continue;
+            }
+            if (auto previous = previous_result(tc.name(), m_setup.m_resumption, m_setup.m_cache); previous) {
+                deliver(*copy, std::move(*previous));
+                m_resources.release(index);
+                continue;
+            }
+
+            auto request = std::string{};
+            encode_integer(request, index);
+            slot.m_copy = copy;
+            slot.m_start = Clock::now();
+            slot.m_timeout = timeout(tc.name(), m_setup.m_timeout);
+            announce(tc.name().path());
+            if (not write_frame(slot.m_request, request)) {
+                // The worker already died (before evaluating anything): Replace it and try again once.
+                retire(slot);
+                spawn(slot);
+                if (not write_frame(slot.m_request, request)) {
+                    crashed(slot);
+                    continue;
+                }
+            }
+            return;
+        }
+        release(slot);
+    }
+
+    /// Whether worker process @p s may evaluate another case: All but the first one hold a token of the jobserver (if
+    /// any) while evaluating cases. Doesn't wait for tokens (c.f. @c poll_timeout).
+    bool admitted(std::size_t const s)
+    {
+        auto & slot = m_slots[s];
+        if (m_setup.m_jobserver == nullptr or s == 0ul or slot.m_token) {
+            return true;
+        }
+        slot.m_token = m_setup.m_jobserver->acquire(std::chrono::milliseconds{0});
+        return static_cast<bool>(slot.m_token);
+    }
+
+    /// Return the token of the jobserver held by @p slot (if any).
+    void release(Slot & slot)
+    {
+        if (slot.m_token) {
+            m_setup.m_jobserver->release(*std::exchange(slot.m_token, std::nullopt));
+        }
+    }
+
+    /// Mark @p slot as idle after its current case finished (releasing its resources).
+    void vacate(Slot & slot)
+    {
+        m_resources.release(m_repetitions.case_index(*std::exchange(slot.m_copy, std::nullopt)));
+        release(slot);
+    }
+
+    /// Wait for (at least one) busy worker to finish; returns whether any of the workers is busy at all.
+    bool await_results()
+    {
+        auto busy = std::vector<::pollfd>{};
+        auto owners = std::vector<Slot *>{};
+        for (auto & slot : m_slots) {
+            if (slot.m_copy) {
+                busy.emplace_back(::pollfd{.fd = slot.m_response, .events = POLLIN, .revents = 0});
+                owners.emplace_back(&slot);
+            }
+        }
+        if (busy.empty()) {
+            return false;
+        }
+
+        while (::poll(busy.data(), busy.size(), poll_timeout()) < 0) {
+            if (errno != EINTR) {
+                throw std::runtime_error{"Failed to wait for results of isolated execution."};
+            }
+        }
+        for (auto i = 0ul; i < busy.size(); ++i) {
+            if (busy[i].revents != 0) {
+                receive(*owners[i]);
+            }
+        }
+        auto const now = Clock::now();
+        for (auto * slot : owners) {
+            if (slot->m_copy and slot->m_timeout != CaseResult::Duration{} and slot->m_start + slot->m_timeout <= now) {
+                expired(*slot);
+            }
+        }
+        return true;
+    }
+
+    /// Milliseconds until the earliest deadline of any busy worker; -1 (i.e. infinite) if there is no deadline.
+    ///
+    /// Idle workers waiting for a token of the jobserver are retried periodically.
+    int poll_timeout() const
+    {
+        auto result = -1;
+        if (m_setup.m_jobserver != nullptr
+            and std::any_of(m_slots.cbegin() + 1, m_slots.cend(), [](Slot const & slot) { return not slot.m_copy; })) {
+            result = static_cast<int>(token_poll_interval.count());
+        }
+        auto const now = Clock::now();
+        for (auto const & slot : m_slots) {
+            if (slot.m_copy and slot.m_timeout != CaseResult::Duration{}) {
+                auto const remaining
+                    = std::chrono::ceil<std::chrono::milliseconds>(slot.m_start + slot.m_timeout - now).count();
+                auto const bounded = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, 1'000'000));
+                result = (result < 0) ? bounded : std::min(result, bounded);
+            }
+        }
+        return result;
+    }
+
+    /// Kill worker of @p slot which exceeded the timeout of its current case; replace it (depending on the setup).
+    void expired(Slot & slot)
+    {
+        auto busy = std::vector<Activity>{};
+        for (auto s = 0ul; s < m_slots.size(); ++s) {
+            if (auto const & other = m_slots[s]; other.m_copy) {
+                auto const & tc = m_cases[m_repetitions.case_index(*other.m_copy)];
+                busy.emplace_back(Activity{s, tc.name().path(), elapsed_since(other.m_start)});
+            }
+        }
+        auto const name = m_cases[m_repetitions.case_index(*slot.m_copy)].name().path();
+        report_timeout(m_setup, name, slot.m_timeout, std::move(busy));
+
+        ::kill(slot.m_pid, SIGKILL);
+        retire(slot);
+        auto result = timeout_result(name, slot.m_timeout);
+        result.m_worker = slot.m_worker;
+        result.m_stdout = content(slot.m_stdout.fd());
+        result.m_stderr = content(slot.m_stderr.fd());
+        replay(result);
+        report_captured(result);
+        deliver(*slot.m_copy, std::move(result));
+        vacate(slot);
+
+        switch (m_setup.m_on_timeout) {
+            case TimeoutMode::proceed:
+                spawn(slot);
+                break;
+            case TimeoutMode::terminate:
+                m_stopped = true;
+                break;
+            default:
+                std::terminate();
+        }
+    }
+
+    /// Import result of @p slot 's current case (or handle the crash of its worker).
+    void receive(Slot & slot)
+    {
+        auto const frame = read_frame(slot.m_response);
+        if (not frame) {
+            crashed(slot);
+            return;
+        }
+
+        auto data = std::string_view{*frame};
+        auto result = decode_result(data);
+        result.m_worker = slot.m_worker;
+        auto const console = decode_text(data);
+        utils::OSyncStream{m_setup.m_logger} << console;
+        replay(result);
+        report_captured(result);
+        deliver(*slot.m_copy, std::move(result));
+        vacate(slot);
+    }
+
+    /// Report worker of @p slot as crashed while evaluating its current case; replace it by a new worker.
+    void crashed(Slot & slot)
+    {
+        auto const wall_time = elapsed_since(slot.m_start);
+        auto const status = retire(slot);
+        auto details = std::ostringstream{};
+        if (WIFSIGNALED(status)) {
+            details << "Worker process terminated by signal " << WTERMSIG(status) << " (" << strsignal(WTERMSIG(status))
+                    << ").";
+        } else {
+            details << "Worker process exited unexpectedly with status " << WEXITSTATUS(status) << '.';
+        }
+
+        auto const & tc = m_cases[m_repetitions.case_index(*slot.m_copy)];
+        auto observation = Observation{{"unknown", 0u}, ObservationStatus::fail_asserted, std::move(details).str(), {}};
+        m_reporter(CaseReporter::Start{tc.name().path()});
+        m_reporter(observation);
+        auto result = CaseResult{std::string{tc.name().path()}, CaseStatus::abort, wall_time, {std::move(observation)}};
+        result.m_worker = slot.m_worker;
+        result.m_stdout = content(slot.m_stdout.fd());
+        result.m_stderr = content(slot.m_stderr.fd());
+        m_reporter(CaseReporter::Stop{result.m_name_path, result.m_wall_time, result.m_status});
+        replay(result);
+        report_captured(result);
+        deliver(*slot.m_copy, std::move(result));
+
+        vacate(slot);
+        spawn(slot);
+    }
+
+    /// Hand @p result of the case planned as @p copy on to the @c m_results (accounting for it in the @c m_budget and
+    /// settling it for its dependents).
+    ///
+    /// Failed attempts are handed out once more instead (c.f. @c m_retries), s.t. the next idle worker retries them.
+    /// Results of repeated cases are collected in @c m_repetitions instead (for combining them later).
+    void deliver(std::size_t const copy, CaseResult result)
+    {
+        if (m_retries.retry(copy, result)) {
+            m_resources.retry(copy);
+            return;
+        }
+        result = m_retries.finish(copy, std::move(result));
+        m_budget.account(result);
+        m_resources.settle(copy, result.m_status);
+        if (m_repetitions.aggregates()) {
+            m_repetitions.add(copy, std::move(result));
+        } else {
+            m_results.push(std::move(result));
+        }
+    }
+
+    /// Notify all listeners about the start of the test-case with @p name (right when handing it out to a worker).
+    ///
+    /// Thus the start is recorded (e.g. in a @c Journal) even if this process doesn't survive the test-case.
+    void announce(std::string_view const name) const
+    {
+        for (auto * listener : m_setup.m_listeners) {
+            listener->on_case_start(name);
+        }
+    }
+
+    /// Notify all listeners about the remaining events of @p result (which occurred in a worker process, c.f.
+    /// @c announce).
+    void replay(CaseResult const & result) const
+    {
+        auto const name = std::string_view{result.m_name_path};
+        for (auto * listener : m_setup.m_listeners) {
+            for (auto const & observation : result.m_observations) {
+                listener->on_observation(name, observation);
+            }
+            listener->on_case_stop(name, result.m_status, result.m_wall_time);
+        }
+    }
+
+    /// Display the captured output of unsuccessful @p result s.
+    void report_captured(CaseResult const & result) const
+    {
+        if (result.m_status == CaseStatus::pass) {
+            return;
+        }
+        auto out = utils::OSyncStream{m_setup.m_logger};
+        for (auto const & [stream, captured] : {std::pair{"stdout", &result.m_stdout}, {"stderr", &result.m_stderr}}) {
+            if (not captured->empty()) {
+                out << m_setup.m_colors[Color::bad] << badge(BadgeType::headline) << m_setup.m_colors[Color::off]
+                    << " Captured " << stream << " of " << result.m_name_path << ":\n"
+                    << *captured << (captured->ends_with('\n') ? "" : "\n");
+            }
+        }
+    }
+
+    /// Interval for retrying to acquire tokens of the jobserver for idle workers.
+    static constexpr auto token_poll_interval = std::chrono::milliseconds{50};
+
+    framework::Registry & m_cases;
+    Conductor::Setup const & m_setup;
+    SharedCancellation const m_cancellation = {}; //!< established before forking any worker process.
+    std::unique_ptr<Scheduler> m_scheduler;
+    ResourceScheduler m_resources; //!< hands out cases of @c m_scheduler once their resources are available.
+    /// Output facility for crashes (everything else is reported by the workers); listeners are notified separately.
+    CaseReporter m_reporter;
+    IgnoreBrokenPipes const m_ignore_broken_pipes = {};
+    std::vector<Slot> m_slots;
+    std::size_t m_num_spawned = 0ul; //!< number of worker processes spawned so far.
+    ResultPipeline & m_results;
+    FailureBudget & m_budget;
+    Repetitions & m_repetitions; //!< maps planned copies to cases and collects results of repeated ones.
+    Retries m_retries; //!< decides which failed cases are executed again.
+    std::vector<std::size_t> const m_cpus; //!< CPUs for pinning the worker processes to (by slot); empty if unpinned.
+    bool m_stopped = false; //!< whether no further cases should be dispatched.
+};
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool supports_isolation() noexcept
+{
+    return CLEANTEST_HAS_PROCESS_POOL;
+}
+
+void execute_isolated(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions)
+{
+#if CLEANTEST_HAS_PROCESS_POOL
+    ProcessPool{cases, plan, dependencies, setup, results, budget, repetitions}.run();
+#else
+    static_cast<void>(cases);
+    static_cast<void>(plan);
+    static_cast<void>(dependencies);
+    static_cast<void>(setup);
+    static_cast<void>(results);
+    static_cast<void>(budget);
+    static_cast<void>(repetitions);
+    std::terminate(); // guarded by supports_isolation()
+#endif
+}
+
+}
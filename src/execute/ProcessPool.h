@@ -0,0 +1,38 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Conductor.h"
+#include "Dependencies.h"
+#include "FailureBudget.h"
+#include "Outcome.h"
+#include "Plan.h"
+#include "Repetitions.h"
+#include "ResultPipeline.h"
+
+#include <framework/Registry.h>
+
+namespace clean_test::execute {
+
+/// Whether executing test-cases in isolated processes (c.f. @c execute_isolated) is supported on this platform.
+bool supports_isolation() noexcept;
+
+/// Execute @p cases in a pool of pre-forked worker processes (one for each worker of @p setup) according to @p plan
+/// (respecting their @p dependencies).
+///
+/// The worker processes are forked once (and only replaced after crashes). They receive case indices via pipes and
+/// send back serialized @c CaseResult s including the captured standard output and error of the test-case. These are
+/// handed on to @p results (and accounted for in the failure @p budget). The cancellation flag is shared with the
+/// worker processes, s.t. their test-cases can observe cancellations. The @p plan covers all copies of the
+/// @p repetitions (whose results are combined there).
+void execute_isolated(
+    framework::Registry & cases,
+    Plan const & plan,
+    DependencyGraph const & dependencies,
+    Conductor::Setup const & setup,
+    ResultPipeline & results,
+    FailureBudget & budget,
+    Repetitions & repetitions);
+
+}
@@ -0,0 +1,65 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Repetitions.h"
+
+#include <algorithm>
+
+namespace clean_test::execute {
+
+Repetitions::Repetitions(std::size_t const num_cases, std::size_t const num_repetitions) :
+    m_num_cases{num_cases}, m_num_repetitions{num_repetitions}, m_runs(num_cases)
+{}
+
+void Repetitions::add(std::size_t const copy, CaseResult result)
+{
+    auto const lock = std::scoped_lock{m_mutex};
+    auto & runs = m_runs[case_index(copy)];
+    if (result.m_status != CaseStatus::skip) {
+        runs.m_wall_times.emplace_back(result.m_wall_time);
+    }
+    auto const failed = not passed(result.m_status);
+    runs.m_num_failures += failed;
+
+    // Keep the first failure; else the latest run (preferred over skipped copies).
+    auto const replace = [&] {
+        if (not runs.m_representative) {
+            return true;
+        }
+        if (not passed(runs.m_representative->m_status)) {
+            return false;
+        }
+        return failed or result.m_status != CaseStatus::skip;
+    }();
+    if (replace) {
+        runs.m_representative = std::move(result);
+    }
+}
+
+std::vector<CaseResult> Repetitions::combine() &&
+{
+    auto const lock = std::scoped_lock{m_mutex};
+    auto results = std::vector<CaseResult>{};
+    for (auto & runs : m_runs) {
+        if (not runs.m_representative) {
+            continue;
+        }
+        auto & result = results.emplace_back(std::move(*runs.m_representative));
+        auto & wall_times = runs.m_wall_times;
+        if (wall_times.empty()) {
+            continue; // all copies have been skipped.
+        }
+        std::sort(wall_times.begin(), wall_times.end());
+        auto const median = wall_times[wall_times.size() / 2ul];
+        result.m_wall_time = median;
+        result.m_statistics = CaseResult::Statistics{
+            .m_num_runs = wall_times.size(),
+            .m_num_failures = runs.m_num_failures,
+            .m_min = wall_times.front(),
+            .m_median = median,
+            .m_max = wall_times.back()};
+    }
+    return results;
+}
+
+}
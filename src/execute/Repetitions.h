@@ -0,0 +1,67 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Aggregation of the results of test-cases executed in several logical copies (c.f. stress testing).
+///
+/// Every one of @c num_cases test-cases is executed @c num_repetitions times. Plans cover all copies: The copy with
+/// index @c i refers to the test-case with index @c i % num_cases (thus subsequent copies of one test-case are spread).
+/// The results of all copies of a test-case are combined into a single one with @c CaseResult::Statistics.
+class Repetitions {
+public:
+    /// Detailed c'tor: Prepare aggregation of @p num_repetitions copies of each of @p num_cases test-cases.
+    Repetitions(std::size_t num_cases, std::size_t num_repetitions);
+
+    /// Number of copies of all test-cases.
+    [[nodiscard]] std::size_t num_copies() const noexcept
+    {
+        return m_num_cases * m_num_repetitions;
+    }
+
+    /// Index of the test-case executed as @p copy.
+    [[nodiscard]] std::size_t case_index(std::size_t const copy) const noexcept
+    {
+        return copy % m_num_cases;
+    }
+
+    /// Whether results have to be combined at all (i.e. test-cases are executed more than once).
+    [[nodiscard]] bool aggregates() const noexcept
+    {
+        return m_num_repetitions > 1ul;
+    }
+
+    /// Account for @p result of executing @p copy (from any thread).
+    void add(std::size_t copy, CaseResult result);
+
+    /// Combined results of all test-cases (in order of their indices) which have been added at least once.
+    ///
+    /// The combined result reports the median wall time. It has the status, observations and output of the first failed
+    /// run (if any); else the status of the last run (which passed or has been skipped).
+    std::vector<CaseResult> combine() &&;
+
+private:
+    /// Results collected for all copies of a single test-case.
+    class Runs {
+    public:
+        std::optional<CaseResult> m_representative = {}; //!< first failing (or else last) result.
+        std::vector<CaseResult::Duration> m_wall_times = {}; //!< of all runs (i.e. copies which haven't been skipped).
+        std::size_t m_num_failures = 0ul; //!< number of runs which didn't pass.
+    };
+
+    std::size_t const m_num_cases;
+    std::size_t const m_num_repetitions;
+    std::mutex m_mutex; //!< protecting @c m_runs.
+    std::vector<Runs> m_runs;
+};
+
+}
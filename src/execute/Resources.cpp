@@ -0,0 +1,242 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Resources.h"
+
+#include "NameFilter.h"
+#include "Repetitions.h"
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto exclusive_tag = std::string_view{"exclusive"};
+constexpr auto memory_tag_prefix = std::string_view{"mem:"};
+constexpr auto lock_tag_prefix = std::string_view{"lock:"};
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<std::size_t> parse_memory(std::string_view text)
+{
+    auto shift = 0;
+    if (not text.empty()) {
+        switch (text.back()) {
+            case 'K': shift = 10; break;
+            case 'M': shift = 20; break;
+            case 'G': shift = 30; break;
+            case 'T': shift = 40; break;
+            default: break;
+        }
+    }
+    if (shift != 0) {
+        text.remove_suffix(1ul);
+    }
+
+    auto result = std::size_t{0};
+    if (auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), result);
+        text.empty() or ec != std::errc{} or end != text.data() + text.size()) {
+        return {};
+    }
+    if (result > (std::numeric_limits<std::size_t>::max() >> shift)) {
+        return {};
+    }
+    return result << shift;
+}
+
+Requirements requirements(framework::Name const & name)
+{
+    auto result = Requirements{};
+    for (auto const & tag : name.tags()) {
+        auto const text = static_cast<std::string_view>(tag);
+        if (text == exclusive_tag) {
+            result.m_exclusive = true;
+        } else if (text.starts_with(memory_tag_prefix)) {
+            result.m_memory = parse_memory(text.substr(memory_tag_prefix.size())).value_or(result.m_memory);
+        } else if (text.starts_with(lock_tag_prefix) and text.size() > lock_tag_prefix.size()) {
+            result.m_locks.emplace_back(text.substr(lock_tag_prefix.size()));
+        }
+    }
+    std::sort(result.m_locks.begin(), result.m_locks.end());
+    result.m_locks.erase(std::unique(result.m_locks.begin(), result.m_locks.end()), result.m_locks.end());
+    return result;
+}
+
+std::vector<Requirements> requirements(framework::Registry const & cases, NameFilter const & filter)
+{
+    auto result = std::vector<Requirements>{};
+    result.reserve(cases.size());
+    for (auto const & tc : cases) {
+        result.emplace_back(static_cast<bool>(filter(tc.name())) ? requirements(tc.name()) : Requirements{});
+    }
+    return result;
+}
+
+ResourceScheduler::ResourceScheduler(
+    Scheduler & scheduler,
+    Repetitions const & repetitions,
+    std::vector<Requirements> requirements,
+    DependencyGraph const & dependencies,
+    std::size_t const memory) :
+    m_scheduler{scheduler},
+    m_repetitions{repetitions},
+    m_requirements{std::move(requirements)},
+    m_dependencies{dependencies},
+    m_constrained{
+        not dependencies.empty()
+        or std::any_of(m_requirements.cbegin(), m_requirements.cend(), [](Requirements const & r) {
+               return not r.empty();
+           })},
+    m_memory{memory}
+{
+    if (not m_dependencies.empty()) {
+        m_num_unsettled.resize(m_requirements.size(), 0ul);
+        m_failed.resize(m_requirements.size(), false);
+        for (auto copy = 0ul; copy < repetitions.num_copies(); ++copy) {
+            ++m_num_unsettled[repetitions.case_index(copy)];
+        }
+    }
+}
+
+ResourceScheduler::Claim ResourceScheduler::next(std::size_t const worker)
+{
+    if (not m_constrained and not m_retrying.load(std::memory_order_relaxed)) {
+        return {m_scheduler.next(worker), 0ul};
+    }
+
+    auto const lock = std::lock_guard{m_mutex};
+    // Retried and deferred copies take precedence (in order of their claiming).
+    for (auto pos = m_deferred.begin(); pos != m_deferred.end(); ++pos) {
+        if (available(*pos)) {
+            auto const copy = *pos;
+            m_deferred.erase(pos);
+            reserve(copy);
+            return {copy, m_epoch};
+        }
+    }
+    // Nothing else is compatible with an exclusive test-case: Don't bother claiming any further ones.
+    while (not m_drained and not m_exclusive) {
+        auto const copy = m_scheduler.next(worker);
+        if (not copy) {
+            m_drained = true;
+        } else if (available(*copy)) {
+            reserve(*copy);
+            return {copy, m_epoch};
+        } else {
+            m_deferred.emplace_back(*copy);
+        }
+    }
+    return {std::nullopt, m_epoch};
+}
+
+void ResourceScheduler::release(std::size_t const index)
+{
+    if (not m_constrained) {
+        return;
+    }
+
+    auto const & requirements = m_requirements[index];
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        --m_num_running;
+        m_exclusive = m_exclusive and not requirements.m_exclusive;
+        m_memory_used -= std::min(requirements.m_memory, m_memory);
+        for (auto const & name : requirements.m_locks) {
+            m_locks.erase(name);
+        }
+        ++m_epoch;
+    }
+    m_released.notify_all();
+}
+
+void ResourceScheduler::retry(std::size_t const copy)
+{
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        m_deferred.emplace_front(copy);
+        m_retrying.store(true, std::memory_order_relaxed);
+        ++m_epoch;
+    }
+    m_released.notify_all();
+}
+
+void ResourceScheduler::settle(std::size_t const copy, CaseStatus const status)
+{
+    if (m_dependencies.empty()) {
+        return;
+    }
+    auto const index = m_repetitions.case_index(copy);
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        --m_num_unsettled[index];
+        m_failed[index] = m_failed[index] or (status != CaseStatus::pass and status != CaseStatus::cached);
+        ++m_epoch;
+    }
+    m_released.notify_all();
+}
+
+bool ResourceScheduler::satisfied(std::size_t const index) const
+{
+    if (m_dependencies.empty()) {
+        return true;
+    }
+    auto const lock = std::lock_guard{m_mutex};
+    auto const & prerequisites = m_dependencies.prerequisites(index);
+    return m_dependencies.satisfiable(index)
+        and std::none_of(prerequisites.cbegin(), prerequisites.cend(), [this](auto const p) { return m_failed[p]; });
+}
+
+bool ResourceScheduler::exhausted() const
+{
+    if (not m_constrained) {
+        return true;
+    }
+    auto const lock = std::lock_guard{m_mutex};
+    return m_drained and m_deferred.empty();
+}
+
+void ResourceScheduler::await(std::size_t const epoch)
+{
+    auto lock = std::unique_lock{m_mutex};
+    m_released.wait(lock, [this, epoch] { return m_epoch != epoch; });
+}
+
+bool ResourceScheduler::available(std::size_t const copy) const
+{
+    auto const index = m_repetitions.case_index(copy);
+    // Unsatisfiable test-cases are ready right away (to be skipped): those of a cycle can't wait for each other.
+    if (not m_dependencies.empty() and m_dependencies.satisfiable(index)) {
+        auto const & prerequisites = m_dependencies.prerequisites(index);
+        if (std::any_of(prerequisites.cbegin(), prerequisites.cend(), [this](auto const p) {
+                return m_num_unsettled[p] > 0ul;
+            })) {
+            return false;
+        }
+    }
+
+    auto const & requirements = m_requirements[index];
+    if (m_exclusive or (requirements.m_exclusive and m_num_running > 0ul)) {
+        return false;
+    }
+    if (m_memory_used + std::min(requirements.m_memory, m_memory) > m_memory) {
+        return false;
+    }
+    return std::none_of(requirements.m_locks.cbegin(), requirements.m_locks.cend(), [this](auto const & name) {
+        return m_locks.contains(name);
+    });
+}
+
+void ResourceScheduler::reserve(std::size_t const copy)
+{
+    auto const & requirements = m_requirements[m_repetitions.case_index(copy)];
+    ++m_num_running;
+    m_exclusive = requirements.m_exclusive;
+    m_memory_used += std::min(requirements.m_memory, m_memory);
+    m_locks.insert(requirements.m_locks.cbegin(), requirements.m_locks.cend());
+}
+
+}
@@ -0,0 +1,138 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Dependencies.h"
+#include "Scheduler.h"
+
+#include <execute/CaseStatus.h>
+
+#include <framework/Name.h>
+#include <framework/Registry.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace clean_test::execute {
+class NameFilter;
+class Repetitions;
+
+/// Resources a test-case requires exclusively while being executed (as declared by its tags).
+class Requirements {
+public:
+    bool m_exclusive = false; //!< "exclusive": no other test-case is executed concurrently.
+    std::size_t m_memory = 0ul; //!< "mem:SIZE": bytes of memory (reserved from the budget of all workers).
+    std::vector<std::string> m_locks = {}; //!< "lock:NAME": not held by any other test-case concurrently.
+
+    /// Whether anything is required at all.
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return not m_exclusive and m_memory == 0ul and m_locks.empty();
+    }
+
+    friend bool operator==(Requirements const &, Requirements const &) = default;
+};
+
+/// Parse @p text of form "NUMBER[K|M|G|T]" as number of bytes (with binary units); nothing if malformed.
+std::optional<std::size_t> parse_memory(std::string_view text);
+
+/// Resources required by the test-case of @p name (as declared by its tags).
+///
+/// Malformed tags are ignored; the last "mem:SIZE" tag takes precedence.
+Requirements requirements(framework::Name const & name);
+
+/// Resources required by all @p cases (by index); none for those disabled by @p filter.
+std::vector<Requirements> requirements(framework::Registry const & cases, NameFilter const & filter);
+
+/// Resource (and dependency) aware distribution of test-cases (c.f. @c Scheduler) onto concurrently running workers.
+///
+/// A test-case is only handed out once all of its @c Requirements are available; they are reserved until it is
+/// released. Likewise, it's only handed out once all copies of the test-cases it depends on have been settled. Test-
+/// cases claimed from the underlying @c Scheduler which aren't ready are deferred: They are handed out (in order) as
+/// soon as they become ready, while compatible ones keep being handed out in the meantime. Without any requirements
+/// and dependencies, this is a plain wrapper of the underlying @c Scheduler.
+class ResourceScheduler {
+public:
+    /// Outcome of claiming the next test-case.
+    class Claim {
+    public:
+        std::optional<std::size_t> m_copy; //!< claimed copy; nothing if all are handed out or none is available.
+        std::size_t m_epoch; //!< number of releases so far (c.f. @c await).
+    };
+
+    /// Detailed c'tor: Distribute copies of @p scheduler (c.f. @p repetitions) of test-cases with @p requirements (by
+    /// index) constrained by a total budget of @p memory and ordered by their @p dependencies.
+    ///
+    /// Requiring more than the budget of @p memory is clamped to it (i.e. the test-case can still be executed).
+    ResourceScheduler(
+        Scheduler & scheduler,
+        Repetitions const & repetitions,
+        std::vector<Requirements> requirements,
+        DependencyGraph const & dependencies,
+        std::size_t memory);
+
+    /// Claim the next copy to be executed by @p worker (reserving its resources).
+    Claim next(std::size_t worker);
+
+    /// Release resources of the (finished) test-case with @p index.
+    void release(std::size_t index);
+
+    /// Hand out (finished) @p copy once more, before all others (e.g. for retrying it after failing); it must not be
+    /// settled before.
+    void retry(std::size_t copy);
+
+    /// Account for the @p status of (finished) @p copy: Its dependents become ready once all copies have been settled.
+    void settle(std::size_t copy, CaseStatus status);
+
+    /// Whether all dependencies of the (handed out) test-case with @p index passed; else it must be skipped.
+    [[nodiscard]] bool satisfied(std::size_t index) const;
+
+    /// Whether all copies have been handed out (once @c next didn't claim any).
+    [[nodiscard]] bool exhausted() const;
+
+    /// Wait until resources have been released after the @p epoch of a previous @c Claim.
+    void await(std::size_t epoch);
+
+    // non-copyable and non-movable
+    ResourceScheduler(ResourceScheduler &&) = delete;
+    ResourceScheduler & operator=(ResourceScheduler &&) = delete;
+    ResourceScheduler(ResourceScheduler const &) = delete;
+    ResourceScheduler & operator=(ResourceScheduler const &) = delete;
+
+private:
+    /// Whether resources of @p copy are available and its dependencies settled (requires locked @c m_mutex).
+    bool available(std::size_t copy) const;
+    /// Reserve resources of @p copy (requires locked @c m_mutex).
+    void reserve(std::size_t copy);
+
+    Scheduler & m_scheduler;
+    Repetitions const & m_repetitions;
+    std::vector<Requirements> const m_requirements; //!< by index of test-case.
+    DependencyGraph const & m_dependencies;
+    bool const m_constrained; //!< whether any test-case has requirements or dependencies at all.
+    std::atomic<bool> m_retrying = false; //!< whether any copy has been retried (thus @c m_deferred must be checked).
+    std::size_t const m_memory; //!< total budget of memory.
+
+    mutable std::mutex m_mutex = {};
+    std::condition_variable m_released = {};
+    std::deque<std::size_t> m_deferred = {}; //!< claimed copies waiting for their resources.
+    bool m_drained = false; //!< whether all copies have been claimed from the @c m_scheduler.
+    std::size_t m_epoch = 0ul; //!< number of releases.
+    std::size_t m_num_running = 0ul; //!< number of test-cases holding resources.
+    bool m_exclusive = false; //!< whether an exclusive test-case is running.
+    std::size_t m_memory_used = 0ul;
+    std::set<std::string> m_locks = {}; //!< held by running test-cases.
+    std::vector<std::size_t> m_num_unsettled = {}; //!< number of copies which haven't been settled (by test-case).
+    std::vector<bool> m_failed = {}; //!< whether any settled copy didn't pass (by test-case).
+};
+
+}
@@ -0,0 +1,81 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ResultCache.h"
+
+#include <algorithm>
+#include <array>
+#include <istream>
+#include <ostream>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto bypassing_tags = std::to_array<std::string_view>({"nondeterministic", "side-effects"});
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool cacheable(framework::Name const & name)
+{
+    auto const & tags = name.tags();
+    return std::none_of(tags.cbegin(), tags.cend(), [](framework::Tag const & tag) {
+        return std::find(bypassing_tags.cbegin(), bypassing_tags.cend(), static_cast<std::string_view>(tag))
+               != bypassing_tags.cend();
+    });
+}
+
+ResultCache::ResultCache(std::string key) : m_key{std::move(key)}
+{}
+
+std::optional<CaseResult> ResultCache::lookup(framework::Name const & name) const
+{
+    if (m_previous.find(name.path()) == m_previous.cend() or not cacheable(name)) {
+        return {};
+    }
+    return CaseResult{std::string{name.path()}, CaseStatus::cached, CaseResult::Duration{}, {}};
+}
+
+void ResultCache::update(CaseResult const & result)
+{
+    if (static_cast<bool>(result.m_type) or result.m_status == CaseStatus::skip) {
+        return; // not executed (at least not as a regular test-case)
+    }
+    if (passed(result.m_status)) {
+        m_passed.emplace(result.m_name_path);
+    } else {
+        m_failed.emplace(result.m_name_path);
+    }
+}
+
+std::ostream & operator<<(std::ostream & out, ResultCache const & cache)
+{
+    out << cache.m_key << '\n';
+    for (auto const & name : cache.m_previous) {
+        if (not cache.m_passed.contains(name) and not cache.m_failed.contains(name)) {
+            out << name << '\n';
+        }
+    }
+    for (auto const & name : cache.m_passed) {
+        if (not cache.m_failed.contains(name)) {
+            out << name << '\n';
+        }
+    }
+    return out;
+}
+
+std::istream & operator>>(std::istream & in, ResultCache & cache)
+{
+    auto line = std::string{};
+    if (not std::getline(in, line) or line != cache.m_key) {
+        return in; // recorded for a different build or configuration
+    }
+    while (std::getline(in, line)) {
+        if (not line.empty()) {
+            cache.m_previous.emplace(std::move(line));
+        }
+    }
+    return in;
+}
+
+}
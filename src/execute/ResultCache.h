@@ -0,0 +1,60 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <framework/Name.h>
+
+#include <utils/StringHash.h>
+
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// Whether results of the test-case @p name may be cached: Not if it is tagged "nondeterministic" or "side-effects".
+bool cacheable(framework::Name const & name);
+
+/// Persistent set of test-cases which passed in previous executions of the same build under the same configuration.
+///
+/// All entries are keyed by (a fingerprint of) the build-id of the executable and the configuration of the execution:
+/// Loading entries recorded under any other key results in an empty cache. Entries from previous executions are only
+/// read during execution, s.t. workers can look them up concurrently to recording new results (from a single thread).
+///
+/// The serialized form is line based: The first line holds the key, every other line the name path of a test-case.
+class ResultCache {
+public:
+    /// Detailed c'tor: Cache results of executions identified by @p key (e.g. build-id and configuration).
+    explicit ResultCache(std::string key);
+
+    /// Cached result of the test-case @p name (if it passed previously and is @c cacheable ).
+    std::optional<CaseResult> lookup(framework::Name const & name) const;
+
+    /// Record @p result (if it has been executed): passed ones are added, failed ones removed.
+    void update(CaseResult const & result);
+
+    /// Number of cached test-cases from previous executions.
+    std::size_t size() const
+    {
+        return m_previous.size();
+    }
+
+    /// Write serialized representation of @p cache (including all updates) into @p out.
+    friend std::ostream & operator<<(std::ostream & out, ResultCache const & cache);
+
+    /// Import serialized entries from @p in into @p cache; entries recorded under a different key are ignored.
+    friend std::istream & operator>>(std::istream & in, ResultCache & cache);
+
+private:
+    std::string m_key;
+    utils::StringSet m_previous = {}; //!< test-cases which passed in previous executions.
+    utils::StringSet m_passed = {}; //!< test-cases which passed in this execution.
+    utils::StringSet m_failed = {}; //!< test-cases which didn't pass in this execution.
+};
+
+}
@@ -0,0 +1,100 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ResultPipeline.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace clean_test::execute {
+
+ResultPipeline::Pause::Pause(ResultPipeline & pipeline) : m_pipeline{pipeline}
+{
+    auto lock = std::unique_lock{m_pipeline.m_mutex};
+    m_pipeline.m_paused = true;
+    m_pipeline.m_idle.wait(lock, [this] { return not m_pipeline.m_consuming; });
+}
+
+ResultPipeline::Pause::~Pause()
+{
+    {
+        auto const lock = std::lock_guard{m_pipeline.m_mutex};
+        m_pipeline.m_paused = false;
+    }
+    m_pipeline.m_not_empty.notify_one();
+}
+
+ResultPipeline::ResultPipeline(std::vector<ResultSink *> sinks, bool const retain, std::size_t const capacity) :
+    m_sinks{std::move(sinks)}, m_retain{retain}, m_capacity{std::max(capacity, 1ul)}, m_consumer{[this] { drain(); }}
+{}
+
+ResultPipeline::~ResultPipeline()
+{
+    close();
+}
+
+void ResultPipeline::push(CaseResult result)
+{
+    auto lock = std::unique_lock{m_mutex};
+    m_not_full.wait(lock, [this] { return m_queue.size() < m_capacity; });
+    m_queue.emplace_back(std::move(result));
+    if (m_queue.size() == 1ul) {
+        m_not_empty.notify_one();
+    }
+}
+
+Outcome::Results ResultPipeline::finish(Outcome::Duration const wall_time)
+{
+    close();
+    for (auto * sink : m_sinks) {
+        sink->finish(wall_time);
+    }
+    return std::move(m_retained);
+}
+
+void ResultPipeline::close()
+{
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        m_closed = true;
+    }
+    m_not_empty.notify_one();
+    if (m_consumer.joinable()) {
+        m_consumer.join();
+    }
+}
+
+void ResultPipeline::drain()
+{
+    auto batch = std::deque<CaseResult>{};
+    while (true) {
+        {
+            auto lock = std::unique_lock{m_mutex};
+            m_not_empty.wait(lock, [this] { return not m_paused and (m_closed or not m_queue.empty()); });
+            if (m_queue.empty()) {
+                return; // closed and drained
+            }
+            std::swap(batch, m_queue);
+            m_consuming = true;
+        }
+        m_not_full.notify_all();
+
+        for (auto & result : batch) {
+            for (auto * sink : m_sinks) {
+                sink->consume(result);
+            }
+            if (m_retain) {
+                m_retained.emplace_back(std::move(result));
+            }
+        }
+        batch.clear();
+
+        {
+            auto const lock = std::lock_guard{m_mutex};
+            m_consuming = false;
+        }
+        m_idle.notify_all();
+    }
+}
+
+}
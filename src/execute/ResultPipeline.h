@@ -0,0 +1,96 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Outcome.h"
+#include "ResultSink.h"
+
+#include <execute/CaseResult.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Transport of test-case results from (concurrently running) producers to @c ResultSink s.
+///
+/// Producers push into a bounded queue and block while it is full. A dedicated consumer thread drains the queue and
+/// hands every result to all sinks (in order). Results are only kept beyond that if retaining them is requested; memory
+/// consumption is thus independent of the number of test-cases otherwise.
+class ResultPipeline {
+public:
+    static constexpr std::size_t default_capacity = 1024ul;
+
+    /// Scope during which the consumer thread doesn't hand results to any sink (c.f. @c pause).
+    class Pause {
+    public:
+        explicit Pause(ResultPipeline & pipeline);
+
+        /// Non-trivial d'tor: Let the consumer proceed.
+        ~Pause();
+
+        // non-copyable and non-movable
+        Pause(Pause &&) = delete;
+        Pause & operator=(Pause &&) = delete;
+        Pause(Pause const &) = delete;
+        Pause & operator=(Pause const &) = delete;
+
+    private:
+        ResultPipeline & m_pipeline;
+    };
+
+    /// Detailed c'tor: start consumer for delivering to @p sinks (and retaining results iff @p retain).
+    ResultPipeline(std::vector<ResultSink *> sinks, bool retain, std::size_t capacity = default_capacity);
+
+    /// Non-trivial d'tor: Waits for all results being consumed (without finishing the sinks).
+    ~ResultPipeline();
+
+    ResultPipeline(ResultPipeline const &) = delete;
+    ResultPipeline & operator=(ResultPipeline const &) = delete;
+
+    /// Hand over @p result for being consumed (eventually); blocks while the queue is full.
+    void push(CaseResult result);
+
+    /// Wait for all results being consumed and finish all sinks with @p wall_time; returns all retained results.
+    Outcome::Results finish(Outcome::Duration wall_time);
+
+    /// Wait until the consumer is idle and keep it idle until the returned @c Pause ends, e.g. for forking safely: The
+    /// consumer thread holds no locks (e.g. of the sinks) then.
+    ///
+    /// Results pushed during the pause are queued (but @c push blocks once the queue is full). Don't @c finish
+    /// meanwhile.
+    [[nodiscard]] Pause pause()
+    {
+        return Pause{*this};
+    }
+
+private:
+    /// Stop accepting results and wait for the consumer to complete.
+    void close();
+
+    /// Main loop of the consumer thread.
+    void drain();
+
+    std::vector<ResultSink *> const m_sinks;
+    bool const m_retain; //!< whether results are kept (in @c m_retained) after they have been consumed.
+    std::size_t const m_capacity; //!< maximum number of queued results.
+
+    std::mutex m_mutex;
+    std::condition_variable m_not_full; //!< notified after draining the queue.
+    std::condition_variable m_not_empty; //!< notified after pushing into the (empty) queue, closing it or resuming.
+    std::condition_variable m_idle; //!< notified after the consumer finished handing a batch to the sinks.
+    std::deque<CaseResult> m_queue; //!< results to be consumed.
+    bool m_closed = false; //!< whether all results have been pushed.
+    bool m_paused = false; //!< whether the consumer must not take further batches (c.f. @c Pause).
+    bool m_consuming = false; //!< whether the consumer is handing a batch to the sinks.
+
+    Outcome::Results m_retained = {}; //!< all consumed results (iff @c m_retain); only accessed by the consumer.
+    std::thread m_consumer;
+};
+
+}
@@ -0,0 +1,37 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Outcome.h"
+
+#include <execute/CaseResult.h>
+
+namespace clean_test::execute {
+
+/// Consumer of test-case results while they are being produced (i.e. during test execution).
+///
+/// All results of one execution are consumed sequentially (by the same thread) before finishing.
+class ResultSink {
+public:
+    virtual ~ResultSink() = default;
+
+    /// Process (freshly finished) @p result.
+    void consume(CaseResult const & result)
+    {
+        consume_impl(result);
+    }
+
+    /// Complete processing after all results (of an execution with @p wall_time) have been consumed.
+    void finish(Outcome::Duration const wall_time)
+    {
+        finish_impl(wall_time);
+    }
+
+private:
+    /// Implementation helpers for the template method design idiom.
+    virtual void consume_impl(CaseResult const & result) = 0;
+    virtual void finish_impl(Outcome::Duration wall_time) = 0;
+};
+
+}
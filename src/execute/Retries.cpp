@@ -0,0 +1,50 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Retries.h"
+
+#include "FailureSet.h"
+
+#include <framework/Cancellation.h>
+
+namespace clean_test::execute {
+
+Retries::Retries(std::size_t const num_cases, std::size_t const max_retries, FailureSet const * const quarantine) :
+    m_max_retries{max_retries},
+    m_quarantine{quarantine},
+    m_entries(max_retries > 0ul ? num_cases : 0ul)
+{}
+
+bool Retries::retry(std::size_t const index, CaseResult const & result)
+{
+    if (m_max_retries == 0ul or static_cast<bool>(result.m_type)
+        or (result.m_status != CaseStatus::fail and result.m_status != CaseStatus::abort)
+        or framework::cancellation_requested()) {
+        return false;
+    }
+
+    auto const lock = std::lock_guard{m_mutex};
+    auto & entry = m_entries[index];
+    if (entry.m_num_retries == m_max_retries) {
+        return false;
+    }
+    if (entry.m_num_retries++ == 0ul) {
+        entry.m_first = result.m_status;
+    }
+    return true;
+}
+
+CaseResult Retries::finish(std::size_t const index, CaseResult result) const
+{
+    if (m_max_retries > 0ul) {
+        auto const lock = std::lock_guard{m_mutex};
+        if (auto const & entry = m_entries[index]; entry.m_num_retries > 0ul) {
+            result.m_attempts = CaseResult::Attempts{entry.m_num_retries + 1ul, entry.m_first};
+        }
+    }
+    result.m_quarantined = m_quarantine != nullptr and not passed(result.m_status)
+        and m_quarantine->contains(result.m_name_path);
+    return result;
+}
+
+}
@@ -0,0 +1,47 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace clean_test::execute {
+class FailureSet;
+
+/// Bookkeeping for executing failed test-cases again (c.f. @c --retries) and tolerating quarantined ones.
+///
+/// Test-cases which failed or aborted are retried up to a limit (timeouts aren't: they are too expensive). Their final
+/// result is annotated with the number of attempts and the status of the first one. Final results of quarantined
+/// test-cases (i.e. recorded in a @c FailureSet) which didn't pass are marked as such: Their failures are tolerated.
+class Retries {
+public:
+    /// Detailed c'tor: Retry each of @p num_cases test-cases up to @p max_retries times; tolerate failures of those
+    /// in @p quarantine (if any).
+    Retries(std::size_t num_cases, std::size_t max_retries, FailureSet const * quarantine);
+
+    /// Whether the test-case with @p index must be executed again after @p result of its latest attempt (from any
+    /// thread); never once cancellation has been requested.
+    [[nodiscard]] bool retry(std::size_t index, CaseResult const & result);
+
+    /// Final @p result of the test-case with @p index (annotated with its attempts and quarantine).
+    [[nodiscard]] CaseResult finish(std::size_t index, CaseResult result) const;
+
+private:
+    /// Attempts of a single test-case which have been retried.
+    class Entry {
+    public:
+        std::size_t m_num_retries = 0ul;
+        CaseStatus m_first = CaseStatus::pass; //!< status of the first attempt (if retried at all).
+    };
+
+    std::size_t const m_max_retries;
+    FailureSet const * const m_quarantine;
+    mutable std::mutex m_mutex = {}; //!< protecting @c m_entries.
+    std::vector<Entry> m_entries;
+};
+
+}
@@ -0,0 +1,83 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "execute/Runner.h"
+
+#include "ColoringSetup.h"
+#include "Conductor.h"
+#include "FailureSet.h"
+#include "NameFilter.h"
+#include "ThreadPool.h"
+
+#include <framework/Registry.h>
+
+#include <execute/Configuration.h>
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+/// Load the test-cases whose failures are tolerated (if enabled); a missing file quarantines nothing.
+std::optional<FailureSet> load_quarantine(Configuration const & cfg)
+{
+    if (cfg.m_quarantine_path.empty()) {
+        return {};
+    }
+
+    auto result = FailureSet{};
+    if (auto in = std::ifstream{cfg.m_quarantine_path}; in) {
+        in >> result;
+    }
+    return result;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Everything shared by all invocations of a @c Runner.
+class Runner::State {
+public:
+    explicit State(Configuration const & cfg) :
+        m_quarantine{load_quarantine(cfg)},
+        m_conductor{{
+            .m_logger = cfg.m_logger ? *cfg.m_logger : std::cout,
+            .m_colors = coloring_setup(cfg.m_coloring),
+            .m_num_workers = cfg.m_num_jobs,
+            .m_adaptive_workers = cfg.m_adaptive_jobs,
+            .m_buffering = cfg.m_buffering,
+            .m_filter = m_filter, // replaced by the filter of every invocation
+            .m_ordering = cfg.m_ordering,
+            .m_quarantine = m_quarantine ? &*m_quarantine : nullptr,
+            .m_isolation = cfg.m_isolation,
+            .m_pinning = cfg.m_pinning,
+            .m_threads = &m_threads,
+            .m_timeout = cfg.m_timeout,
+            .m_on_timeout = cfg.m_on_timeout,
+            .m_max_failures = cfg.m_max_failures,
+            .m_repetitions = cfg.m_repetitions,
+            .m_until_fail = cfg.m_until_fail,
+            .m_retries = cfg.m_retries,
+            .m_listeners = cfg.m_listeners}}
+    {}
+
+    NameFilter const m_filter = {};
+    std::optional<FailureSet> const m_quarantine;
+    ThreadPool m_threads = {}; //!< hosting the workers of all invocations.
+    Conductor const m_conductor;
+};
+
+Runner::Runner(Configuration const & configuration) : m_state{std::make_unique<State>(configuration)}
+{}
+
+Runner::~Runner() = default;
+
+Runner::Results Runner::run(std::vector<NameFilterSetting> const & filter)
+{
+    return m_state->m_conductor.run(framework::registry(), NameFilter{filter}).m_results;
+}
+
+}
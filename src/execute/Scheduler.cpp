@@ -0,0 +1,194 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Scheduler.h"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace clean_test::execute {
+namespace {
+
+/// Classic scheduling: every claim is a compare-and-swap on the one cursor shared by all workers.
+class SharedCursorScheduler final : public Scheduler {
+public:
+    explicit SharedCursorScheduler(std::vector<std::size_t> order) : m_order{std::move(order)}, m_next{0ul}
+    {}
+
+private:
+    std::optional<std::size_t> next_impl(std::size_t) final
+    {
+        auto const num = m_order.size();
+        auto previous = m_next.load(std::memory_order_relaxed);
+        while (previous < num and not m_next.compare_exchange_weak(previous, previous + 1, std::memory_order_relaxed)) {
+        }
+        if (previous < num) {
+            return m_order[previous];
+        }
+        return {};
+    }
+
+    std::vector<std::size_t> const m_order; //!< case indices to be handed out (in this order).
+    std::atomic<std::size_t> m_next; //!< position of the next case in @c m_order.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Half-open range [begin, end) of positions (of planned cases), packed into a single word for lock-free updates.
+class Range {
+public:
+    using Packed = std::uint64_t;
+    using Index = std::uint32_t;
+
+    static constexpr std::size_t max_index = std::numeric_limits<Index>::max();
+
+    constexpr Range(std::size_t const begin, std::size_t const end) :
+        m_begin{static_cast<Index>(begin)}, m_end{static_cast<Index>(end)}
+    {}
+
+    constexpr explicit Range(Packed const packed) :
+        m_begin{static_cast<Index>(packed >> 32u)}, m_end{static_cast<Index>(packed)}
+    {}
+
+    constexpr Packed packed() const
+    {
+        return (Packed{m_begin} << 32u) | Packed{m_end};
+    }
+
+    constexpr std::size_t size() const
+    {
+        return (m_begin < m_end) ? (m_end - m_begin) : 0ul;
+    }
+
+    Index m_begin;
+    Index m_end;
+};
+
+/// Scheduling with per-worker ranges: a worker claims from the front of its own range without contention and only
+/// touches the ranges of others (by stealing half from their back) once its own range is exhausted.
+///
+/// Ranges only ever shrink or get replaced by disjoint (freshly stolen) ones. A stale snapshot of a range can thus
+/// never compare equal to its current value, which makes plain compare-and-swap updates ABA-safe.
+class WorkStealingScheduler final : public Scheduler {
+public:
+    WorkStealingScheduler(Plan const & plan, std::size_t const num_workers) : m_order{}, m_slots(num_workers)
+    {
+        auto const num_cases = plan.m_order.size();
+        if (plan.m_workers.empty()) {
+            // Seed every worker with a contiguous share of (almost) equal size.
+            m_order = plan.m_order;
+            for (auto w = 0ul; w < num_workers; ++w) {
+                auto const begin = num_cases * w / num_workers;
+                auto const end = num_cases * (w + 1ul) / num_workers;
+                m_slots[w].m_range.store(Range{begin, end}.packed(), std::memory_order_relaxed);
+            }
+            return;
+        }
+
+        // Seed every worker with the cases planned for it (keeping their relative order).
+        auto ends = std::vector<std::size_t>(num_workers, 0ul);
+        for (auto const w : plan.m_workers) {
+            ++ends[w % num_workers];
+        }
+        std::partial_sum(ends.cbegin(), ends.cend(), ends.begin());
+        for (auto w = 0ul; w < num_workers; ++w) {
+            auto const begin = (w == 0ul) ? 0ul : ends[w - 1ul];
+            m_slots[w].m_range.store(Range{begin, ends[w]}.packed(), std::memory_order_relaxed);
+        }
+        m_order.resize(num_cases);
+        for (auto pos = num_cases; pos-- > 0ul;) {
+            m_order[--ends[plan.m_workers[pos] % num_workers]] = plan.m_order[pos];
+        }
+    }
+
+private:
+    /// Separate cache line for each worker's range to avoid false sharing.
+    class alignas(64) Slot {
+    public:
+        std::atomic<Range::Packed> m_range{Range{0ul, 0ul}.packed()};
+    };
+
+    std::optional<std::size_t> next_impl(std::size_t const worker) final
+    {
+        auto position = pop_front(m_slots[worker]);
+        if (not position) {
+            position = steal(worker);
+        }
+        if (position) {
+            return m_order[*position];
+        }
+        return {};
+    }
+
+    static std::optional<std::size_t> pop_front(Slot & slot)
+    {
+        auto packed = slot.m_range.load(std::memory_order_acquire);
+        while (true) {
+            auto const range = Range{packed};
+            if (range.size() == 0ul) {
+                return {};
+            }
+            if (slot.m_range.compare_exchange_weak(
+                    packed, Range{range.m_begin + 1ul, range.m_end}.packed(), std::memory_order_acq_rel)) {
+                return range.m_begin;
+            }
+        }
+    }
+
+    /// Take over the back half of the largest range of any other worker; keep all but its first position for later.
+    std::optional<std::size_t> steal(std::size_t const thief)
+    {
+        auto const num_workers = m_slots.size();
+        while (true) {
+            auto victim = thief;
+            auto largest = Range{0ul, 0ul};
+            for (auto offset = 1ul; offset < num_workers; ++offset) {
+                auto const candidate = (thief + offset) % num_workers;
+                auto const range = Range{m_slots[candidate].m_range.load(std::memory_order_acquire)};
+                if (range.size() > largest.size()) {
+                    victim = candidate;
+                    largest = range;
+                }
+            }
+            if (largest.size() == 0ul) {
+                return {}; // nothing left anywhere
+            }
+
+            auto expected = largest.packed();
+            auto const split = largest.m_end - (largest.size() + 1ul) / 2ul;
+            if (m_slots[victim].m_range.compare_exchange_strong(
+                    expected, Range{largest.m_begin, split}.packed(), std::memory_order_acq_rel)) {
+                m_slots[thief].m_range.store(Range{split + 1ul, largest.m_end}.packed(), std::memory_order_release);
+                return split;
+            }
+        }
+    }
+
+    std::vector<std::size_t> m_order; //!< case indices; the ranges of @c m_slots refer to positions herein.
+    std::vector<Slot> m_slots;
+};
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<Scheduler> make_scheduler(SchedulingMode const mode, Plan const & plan, std::size_t const num_workers)
+{
+    switch (mode) {
+        case SchedulingMode::shared_cursor:
+            return std::make_unique<SharedCursorScheduler>(plan.m_order);
+        case SchedulingMode::work_stealing:
+            if (plan.m_order.size() > Range::max_index) {
+                // Positions don't fit into packed ranges anymore: Gracefully fall back to the unlimited alternative.
+                return std::make_unique<SharedCursorScheduler>(plan.m_order);
+            }
+            return std::make_unique<WorkStealingScheduler>(plan, num_workers);
+        default:
+            std::terminate();
+    }
+}
+
+}
@@ -0,0 +1,45 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Plan.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+namespace clean_test::execute {
+
+/// Strategy for distributing test-cases onto the workers of a @c Conductor.
+enum class SchedulingMode {
+    /// All workers claim cases one after another from a single, shared cursor.
+    shared_cursor,
+    /// Every worker owns a contiguous range of cases; idle workers steal half of the largest remaining range.
+    work_stealing,
+};
+
+/// Thread-safe distribution of test-case indices to concurrently running workers.
+///
+/// Every case index of the underlying @c Plan is handed out exactly once (to any worker).
+class Scheduler {
+public:
+    virtual ~Scheduler() = default;
+
+    /// Claim the next case index to be executed by @p worker; nothing once all cases have been handed out.
+    std::optional<std::size_t> next(std::size_t const worker)
+    {
+        return next_impl(worker);
+    }
+
+private:
+    /// Implementation helper for the template method design idiom.
+    virtual std::optional<std::size_t> next_impl(std::size_t worker) = 0;
+};
+
+/// Create @c Scheduler of given @p mode for distributing the cases of @p plan onto @p num_workers.
+///
+/// The @c Plan::m_order is followed for claiming cases; work stealing seeds the workers as in @c Plan::m_workers.
+std::unique_ptr<Scheduler> make_scheduler(SchedulingMode mode, Plan const & plan, std::size_t num_workers);
+
+}
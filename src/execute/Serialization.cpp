@@ -0,0 +1,107 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Serialization.h"
+
+#include <stdexcept>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto integer_size = sizeof(std::uint64_t);
+
+/// Consume integer from the front of @p data and verify it is smaller than @p limit.
+std::uint64_t decode_bounded(std::string_view & data, std::uint64_t const limit)
+{
+    auto const result = decode_integer(data);
+    if (result >= limit) {
+        throw std::runtime_error{"Malformed serialization: value out of range."};
+    }
+    return result;
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void encode_integer(std::string & buffer, std::uint64_t value)
+{
+    for (auto i = 0ul; i < integer_size; ++i, value >>= 8u) {
+        buffer.push_back(static_cast<char>(value & 0xFFu));
+    }
+}
+
+void encode_text(std::string & buffer, std::string_view const text)
+{
+    encode_integer(buffer, text.size());
+    buffer.append(text);
+}
+
+void encode_result(std::string & buffer, CaseResult const & result)
+{
+    encode_text(buffer, result.m_name_path);
+    encode_integer(buffer, static_cast<CaseStatus::Value>(result.m_status));
+    encode_integer(buffer, static_cast<std::uint64_t>(result.m_wall_time.count()));
+    encode_integer(buffer, static_cast<bool>(result.m_type));
+    encode_integer(buffer, result.m_observations.size());
+    for (auto const & o : result.m_observations) {
+        encode_text(buffer, o.m_where.file_name());
+        encode_integer(buffer, o.m_where.line());
+        encode_integer(buffer, static_cast<ObservationStatus::Value>(o.m_status));
+        encode_text(buffer, o.m_expression_details);
+        encode_text(buffer, o.m_description);
+    }
+    encode_text(buffer, result.m_stdout);
+    encode_text(buffer, result.m_stderr);
+}
+
+std::uint64_t decode_integer(std::string_view & data)
+{
+    if (data.size() < integer_size) {
+        throw std::runtime_error{"Malformed serialization: truncated integer."};
+    }
+    auto result = std::uint64_t{0u};
+    for (auto i = integer_size; i-- > 0ul;) {
+        result = (result << 8u) | static_cast<unsigned char>(data[i]);
+    }
+    data.remove_prefix(integer_size);
+    return result;
+}
+
+std::string_view decode_text(std::string_view & data)
+{
+    auto const size = decode_integer(data);
+    if (data.size() < size) {
+        throw std::runtime_error{"Malformed serialization: truncated text."};
+    }
+    auto const result = data.substr(0ul, size);
+    data.remove_prefix(size);
+    return result;
+}
+
+CaseResult decode_result(std::string_view & data)
+{
+    auto name_path = std::string{decode_text(data)};
+    auto const status = static_cast<CaseStatus::Value>(decode_bounded(data, CaseStatus::num_values));
+    auto const wall_time = CaseResult::Duration{static_cast<CaseResult::Duration::rep>(decode_integer(data))};
+    auto const type = CaseResult::Type{static_cast<bool>(decode_bounded(data, 2u))};
+
+    auto const num_observations = decode_bounded(data, data.size());
+    auto observations = CaseResult::Observations{};
+    observations.reserve(num_observations);
+    while (observations.size() < num_observations) {
+        auto const file_name = decode_text(data);
+        auto const line = static_cast<std::uint_least32_t>(decode_integer(data));
+        auto const observation_status
+            = static_cast<ObservationStatus::Value>(decode_bounded(data, ObservationStatus::num_values));
+        auto expression_details = std::string{decode_text(data)};
+        observations.emplace_back(Observation{
+            {file_name, line}, observation_status, std::move(expression_details), std::string{decode_text(data)}});
+    }
+
+    auto result = CaseResult{std::move(name_path), status, wall_time, std::move(observations), type};
+    result.m_stdout = decode_text(data);
+    result.m_stderr = decode_text(data);
+    return result;
+}
+
+}
@@ -0,0 +1,41 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <execute/CaseResult.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace clean_test::execute {
+
+/// @name Compact binary (de-)serialization, e.g. for exchanging test-case results between processes.
+///
+/// All encoders append to a given buffer. All decoders consume from the front of the given data and throw
+/// @c std::runtime_error when encountering truncated or malformed input.
+///
+/// @{
+
+/// Append @p value to @p buffer (in little endian byte order, independent of the platform).
+void encode_integer(std::string & buffer, std::uint64_t value);
+
+/// Append length-prefixed @p text to @p buffer.
+void encode_text(std::string & buffer, std::string_view text);
+
+/// Append all details of @p result to @p buffer.
+void encode_result(std::string & buffer, CaseResult const & result);
+
+/// Consume integer from the front of @p data.
+std::uint64_t decode_integer(std::string_view & data);
+
+/// Consume length-prefixed text from the front of @p data; the result refers into @p data.
+std::string_view decode_text(std::string_view & data);
+
+/// Consume a test-case result from the front of @p data.
+CaseResult decode_result(std::string_view & data);
+
+/// @}
+
+}
@@ -0,0 +1,111 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ThreadPool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace clean_test::execute {
+
+class ThreadPool::Progress {
+public:
+    bool m_done = false; //!< whether the task finished.
+    bool m_abandoned = false; //!< whether the task is not waited for (c.f. @c Completion::abandon).
+};
+
+class ThreadPool::State {
+public:
+    std::mutex m_mutex = {};
+    std::condition_variable m_submitted = {}; //!< notified after submitting tasks or stopping.
+    std::condition_variable m_finished = {}; //!< notified after finishing tasks or stopping threads.
+    std::deque<std::pair<Task, std::shared_ptr<Progress>>> m_queue = {}; //!< tasks not yet taken by any thread.
+    std::size_t m_num_threads = 0ul; //!< number of running threads.
+    std::size_t m_num_started = 0ul; //!< number of threads started in total.
+    std::size_t m_num_idle = 0ul; //!< number of threads which are neither busy nor reserved for a queued task.
+    std::size_t m_num_abandoned = 0ul; //!< number of abandoned tasks which are still running.
+    bool m_stopped = false; //!< whether threads exit once the queue is empty.
+};
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ThreadPool::Completion::wait() const
+{
+    auto lock = std::unique_lock{m_state->m_mutex};
+    m_state->m_finished.wait(lock, [this] { return m_progress->m_done; });
+}
+
+void ThreadPool::Completion::abandon() const
+{
+    auto const lock = std::lock_guard{m_state->m_mutex};
+    if (not m_progress->m_done and not m_progress->m_abandoned) {
+        m_progress->m_abandoned = true;
+        ++m_state->m_num_abandoned;
+    }
+}
+
+ThreadPool::ThreadPool() : m_state{std::make_shared<State>()}
+{}
+
+ThreadPool::~ThreadPool()
+{
+    auto lock = std::unique_lock{m_state->m_mutex};
+    m_state->m_stopped = true;
+    m_state->m_submitted.notify_all();
+    m_state->m_finished.wait(lock, [this] { return m_state->m_num_threads == m_state->m_num_abandoned; });
+}
+
+ThreadPool::Completion ThreadPool::submit(Task task)
+{
+    auto progress = std::make_shared<Progress>();
+    {
+        auto const lock = std::lock_guard{m_state->m_mutex};
+        m_state->m_queue.emplace_back(std::move(task), progress);
+        if (m_state->m_num_idle > 0ul) {
+            --m_state->m_num_idle;
+        } else {
+            // Threads only hold the shared state: Those stuck in abandoned tasks can thus outlive the pool.
+            ++m_state->m_num_threads;
+            ++m_state->m_num_started;
+            std::thread{serve, m_state}.detach();
+        }
+    }
+    m_state->m_submitted.notify_one();
+    return Completion{m_state, std::move(progress)};
+}
+
+std::size_t ThreadPool::size() const
+{
+    auto const lock = std::lock_guard{m_state->m_mutex};
+    return m_state->m_num_started;
+}
+
+void ThreadPool::serve(std::shared_ptr<State> const state)
+{
+    auto lock = std::unique_lock{state->m_mutex};
+    while (true) {
+        state->m_submitted.wait(lock, [&state] { return state->m_stopped or not state->m_queue.empty(); });
+        if (state->m_queue.empty()) {
+            break; // stopped
+        }
+        auto [task, progress] = std::move(state->m_queue.front());
+        state->m_queue.pop_front();
+
+        lock.unlock();
+        task();
+        task = {}; // release whatever the task captured before announcing its completion.
+        lock.lock();
+
+        progress->m_done = true;
+        if (progress->m_abandoned) {
+            --state->m_num_abandoned;
+        }
+        ++state->m_num_idle;
+        state->m_finished.notify_all();
+    }
+    --state->m_num_threads;
+    state->m_finished.notify_all();
+}
+
+}
@@ -0,0 +1,72 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace clean_test::execute {
+
+/// Persistent threads for executing tasks (e.g. the workers of subsequent executions, c.f. @c Runner).
+///
+/// Every task is handed to an idle thread; new threads are only started while all existing ones are busy. Threads thus
+/// outlive their tasks until the pool is destroyed. Threads stuck in abandoned tasks (e.g. of test-cases exceeding
+/// their timeout) are left behind on destruction.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    class State;
+    class Progress;
+
+public:
+    /// Handle of a submitted task.
+    class Completion {
+    public:
+        /// Wait until the task finished.
+        void wait() const;
+
+        /// Give up on the task: It may never finish (and is thus not waited for on destruction of the pool).
+        void abandon() const;
+
+    private:
+        friend class ThreadPool;
+
+        Completion(std::shared_ptr<State> state, std::shared_ptr<Progress> progress) noexcept :
+            m_state{std::move(state)}, m_progress{std::move(progress)}
+        {}
+
+        std::shared_ptr<State> m_state;
+        std::shared_ptr<Progress> m_progress; //!< of the task (guarded by the mutex of @c m_state).
+    };
+
+    /// Default c'tor: No threads are started until tasks are submitted.
+    ThreadPool();
+
+    /// Non-trivial d'tor: Stops all threads (after they finished their tasks, unless those have been abandoned).
+    ~ThreadPool();
+
+    /// Execute @p task on an idle (or otherwise a new) thread.
+    Completion submit(Task task);
+
+    /// Number of threads started so far.
+    [[nodiscard]] std::size_t size() const;
+
+    // non-copyable and non-movable
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool & operator=(ThreadPool &&) = delete;
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool & operator=(ThreadPool const &) = delete;
+
+private:
+    /// Main loop of every thread.
+    static void serve(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> const m_state; //!< shared with all threads (which may outlive the pool if abandoned).
+};
+
+}
@@ -0,0 +1,325 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Topology.h"
+
+#if defined(__linux__) and __has_include(<sched.h>)
+# define CLEANTEST_HAS_AFFINITY 1
+# include <sched.h>
+#else
+# define CLEANTEST_HAS_AFFINITY 0
+#endif
+
+#if __has_include(<unistd.h>)
+# define CLEANTEST_HAS_SYSCONF 1
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_SYSCONF 0
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace clean_test::execute {
+namespace {
+
+namespace fs = std::filesystem;
+
+/// Parse @p text as integer (ignoring surrounding whitespace); nothing if malformed.
+std::optional<long long> parse_integer(std::string_view text)
+{
+    auto const begin = text.find_first_not_of(" \t\n");
+    auto const end = text.find_last_not_of(" \t\n");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    text = text.substr(begin, end + 1ul - begin);
+    auto result = 0ll;
+    auto const [last, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+    if (error != std::errc{} or last != text.data() + text.size()) {
+        return {};
+    }
+    return result;
+}
+
+/// First line of the file at @p path; nothing if it can't be read.
+std::optional<std::string> read_line(fs::path const & path)
+{
+    auto in = std::ifstream{path};
+    auto result = std::string{};
+    if (not std::getline(in, result)) {
+        return {};
+    }
+    return result;
+}
+
+std::optional<long long> read_integer(fs::path const & path)
+{
+    auto const line = read_line(path);
+    return line ? parse_integer(*line) : std::nullopt;
+}
+
+std::optional<std::size_t> min_limit(std::optional<std::size_t> const lhs, std::optional<std::size_t> const rhs)
+{
+    if (lhs and rhs) {
+        return std::min(*lhs, *rhs);
+    }
+    return lhs ? lhs : rhs;
+}
+
+/// CPU limit (as determined by @p limit) of the cgroup @p path of the hierarchy mounted at @p root (or any ancestor).
+template <std::invocable<fs::path const &> Limit>
+std::optional<std::size_t> hierarchical_limit(fs::path const & root, fs::path const & path, Limit && limit)
+{
+    auto error = std::error_code{};
+    auto directory = root / path.relative_path();
+    if (not fs::is_directory(directory, error)) {
+        directory = root; // e.g. within a cgroup namespace: the own cgroup is mounted as root.
+    }
+
+    auto result = std::optional<std::size_t>{};
+    while (true) {
+        result = min_limit(result, limit(directory));
+        if (directory.native().size() <= root.native().size()) {
+            return result;
+        }
+        directory = directory.parent_path();
+    }
+}
+
+/// CPU limit of cgroup (v2) @p directory.
+std::optional<std::size_t> unified_limit(fs::path const & directory)
+{
+    auto const line = read_line(directory / "cpu.max");
+    if (not line) {
+        return {};
+    }
+    auto const fields = std::string_view{*line};
+    auto const separator = fields.find(' ');
+    if (separator == std::string_view::npos) {
+        return {};
+    }
+    return cpu_limit(fields.substr(0ul, separator), fields.substr(separator + 1ul));
+}
+
+/// CPU limit of cgroup (v1) @p directory of the cpu controller.
+std::optional<std::size_t> cfs_limit(fs::path const & directory)
+{
+    auto const quota = read_line(directory / "cpu.cfs_quota_us");
+    auto const period = read_line(directory / "cpu.cfs_period_us");
+    if (not quota or not period) {
+        return {};
+    }
+    return cpu_limit(*quota, *period);
+}
+
+/// Whether comma separated list of @p controllers contains @p wanted.
+bool has_controller(std::string_view controllers, std::string_view const wanted)
+{
+    while (not controllers.empty()) {
+        auto const separator = std::min(controllers.find(','), controllers.size());
+        if (controllers.substr(0ul, separator) == wanted) {
+            return true;
+        }
+        controllers.remove_prefix(std::min(separator + 1ul, controllers.size()));
+    }
+    return false;
+}
+
+/// Memory limit (in bytes) of cgroup (v2) @p directory.
+std::optional<std::size_t> unified_memory_limit(fs::path const & directory)
+{
+    auto const limit = read_integer(directory / "memory.max"); // "max" if unlimited
+    return (limit and *limit > 0ll) ? std::optional{static_cast<std::size_t>(*limit)} : std::nullopt;
+}
+
+/// Memory limit (in bytes) of cgroup (v1) @p directory of the memory controller.
+std::optional<std::size_t> legacy_memory_limit(fs::path const & directory)
+{
+    // Unlimited is reported as huge value (close to the maximum of a signed 64 bit integer; rounded to pages).
+    auto const limit = read_integer(directory / "memory.limit_in_bytes");
+    return (limit and *limit > 0ll and *limit < (1ll << 62)) ? std::optional{static_cast<std::size_t>(*limit)}
+                                                               : std::nullopt;
+}
+
+/// Most restrictive limit of all cgroups of this process; nothing if unlimited.
+///
+/// Limits are determined by @p unified for cgroup v2 and by @p legacy for the cgroup v1 hierarchy of @p controller
+/// (mounted at any of @p legacy_roots).
+template <std::invocable<fs::path const &> Unified, std::invocable<fs::path const &> Legacy>
+std::optional<std::size_t> cgroup_limit(
+    std::string_view const controller,
+    std::initializer_list<char const *> const legacy_roots,
+    Unified && unified,
+    Legacy && legacy)
+{
+    auto in = std::ifstream{"/proc/self/cgroup"};
+    auto result = std::optional<std::size_t>{};
+    for (auto line = std::string{}; std::getline(in, line);) {
+        // Format: hierarchy-ID:controller-list:cgroup-path
+        auto const first = line.find(':');
+        auto const second = line.find(':', first + 1ul);
+        if (first == std::string::npos or second == std::string::npos) {
+            continue;
+        }
+        auto const controllers = std::string_view{line}.substr(first + 1ul, second - first - 1ul);
+        auto const path = fs::path{line.substr(second + 1ul)};
+        if (controllers.empty()) {
+            result = min_limit(result, hierarchical_limit("/sys/fs/cgroup", path, unified));
+        } else if (has_controller(controllers, controller)) {
+            for (auto const * const root : legacy_roots) {
+                if (auto error = std::error_code{}; fs::is_directory(root, error)) {
+                    result = min_limit(result, hierarchical_limit(root, path, legacy));
+                    break;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+#if CLEANTEST_HAS_AFFINITY
+
+/// All CPUs of the affinity mask of this process.
+std::vector<std::size_t> affinity()
+{
+    auto set = ::cpu_set_t{};
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) != 0) {
+        return {};
+    }
+    auto result = std::vector<std::size_t>{};
+    for (auto cpu = 0ul; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) {
+            result.emplace_back(cpu);
+        }
+    }
+    return result;
+}
+
+/// NUMA node of the CPU with sysfs @p directory; 0 if unknown.
+std::size_t numa_node(fs::path const & directory)
+{
+    auto error = std::error_code{};
+    for (auto const & entry : fs::directory_iterator{directory, error}) {
+        auto const name = entry.path().filename().native();
+        if (name.starts_with("node")) {
+            if (auto const node = parse_integer(std::string_view{name}.substr(4ul)); node and *node >= 0) {
+                return static_cast<std::size_t>(*node);
+            }
+        }
+    }
+    return 0ul;
+}
+
+#endif
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t available_cpus()
+{
+    auto result = std::size_t{std::max(1u, std::thread::hardware_concurrency())};
+#if CLEANTEST_HAS_AFFINITY
+    if (auto const cpus = affinity(); not cpus.empty()) {
+        result = cpus.size();
+    }
+#endif
+    auto const limit
+        = cgroup_limit("cpu", {"/sys/fs/cgroup/cpu", "/sys/fs/cgroup/cpu,cpuacct"}, unified_limit, cfs_limit);
+    if (limit) {
+        result = std::min(result, *limit);
+    }
+    return std::max(1ul, result);
+}
+
+std::size_t available_memory()
+{
+    auto result = std::numeric_limits<std::size_t>::max();
+#if CLEANTEST_HAS_SYSCONF
+    if (auto const pages = ::sysconf(_SC_PHYS_PAGES), size = ::sysconf(_SC_PAGESIZE); pages > 0 and size > 0) {
+        result = static_cast<std::size_t>(pages) * static_cast<std::size_t>(size);
+    }
+#endif
+    if (auto const limit = cgroup_limit("memory", {"/sys/fs/cgroup/memory"}, unified_memory_limit, legacy_memory_limit);
+        limit) {
+        result = std::min(result, *limit);
+    }
+    return result;
+}
+
+std::optional<std::size_t> cpu_limit(std::string_view const quota, std::string_view const period)
+{
+    auto const q = parse_integer(quota);
+    auto const p = parse_integer(period);
+    if (not q or not p or *q <= 0ll or *p <= 0ll) {
+        return {}; // includes "max" (v2) and -1 (v1)
+    }
+    return static_cast<std::size_t>(std::max(1ll, (*q + *p - 1ll) / *p));
+}
+
+bool supports_pinning() noexcept
+{
+    return CLEANTEST_HAS_AFFINITY;
+}
+
+std::vector<std::size_t> pinning_order()
+{
+#if CLEANTEST_HAS_AFFINITY
+    // Rank CPUs within their NUMA node: SMT siblings of already ranked physical cores come last.
+    auto num_siblings = std::map<std::pair<long long, long long>, std::size_t>{}; // by (package, core)
+    auto nodes = std::map<std::size_t, std::vector<std::pair<std::size_t, std::size_t>>>{}; // (rank, cpu) by node
+    for (auto const cpu : affinity()) {
+        auto const directory = fs::path{"/sys/devices/system/cpu"} / ("cpu" + std::to_string(cpu));
+        auto const id = static_cast<long long>(cpu);
+        auto const package = read_integer(directory / "topology" / "physical_package_id").value_or(id);
+        auto const core = read_integer(directory / "topology" / "core_id").value_or(id);
+        nodes[numa_node(directory)].emplace_back(num_siblings[{package, core}]++, cpu);
+    }
+
+    auto result = std::vector<std::size_t>{};
+    for (auto & [node, cpus] : nodes) {
+        std::sort(cpus.begin(), cpus.end());
+    }
+    for (auto position = 0ul; true; ++position) {
+        auto const size = result.size();
+        for (auto const & [node, cpus] : nodes) {
+            if (position < cpus.size()) {
+                result.emplace_back(cpus[position].second);
+            }
+        }
+        if (result.size() == size) {
+            return result;
+        }
+    }
+#else
+    return {};
+#endif
+}
+
+bool pin_current_thread(std::size_t const cpu) noexcept
+{
+#if CLEANTEST_HAS_AFFINITY
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    auto set = ::cpu_set_t{};
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+
+}
@@ -0,0 +1,40 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Number of CPUs this process can effectively utilize (at least 1).
+///
+/// This is the number of CPUs in its affinity mask, further restricted by the CPU quota of its cgroup (v1 or v2).
+std::size_t available_cpus();
+
+/// Number of bytes of memory this process can effectively utilize.
+///
+/// This is the physical memory, further restricted by the memory limit of its cgroup (v1 or v2).
+std::size_t available_memory();
+
+/// Number of CPUs granted by a cgroup CPU @p quota per @p period (rounded up); nothing if unlimited.
+///
+/// Supports the formats of cgroup v2 (i.e. the fields of "cpu.max" with quota "max" for unlimited) and v1 (i.e. the
+/// content of "cpu.cfs_quota_us" and "cpu.cfs_period_us" with a negative quota for unlimited).
+std::optional<std::size_t> cpu_limit(std::string_view quota, std::string_view period);
+
+/// Whether workers can be pinned to CPUs (c.f. @c pin_current_thread) on this platform.
+bool supports_pinning() noexcept;
+
+/// All CPUs of the affinity mask in the order workers should be pinned to them.
+///
+/// Subsequent CPUs alternate between NUMA nodes; within each node, all physical cores come before their SMT siblings.
+std::vector<std::size_t> pinning_order();
+
+/// Bind the calling thread to @p cpu; returns whether this succeeded.
+bool pin_current_thread(std::size_t cpu) noexcept;
+
+}
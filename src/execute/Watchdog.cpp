@@ -0,0 +1,184 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Watchdog.h"
+
+#include "Badges.h"
+#include "CaseReporter.h"
+#include "ColorTable.h"
+
+#include <utils/OSyncStream.h>
+#include <utils/WithAdaptiveUnit.h>
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <sstream>
+#include <string>
+
+namespace clean_test::execute {
+namespace {
+
+constexpr auto timeout_tag_prefix = std::string_view{"timeout:"};
+
+/// Parse @p tag of form "timeout:SECONDS" (nothing for any other tag).
+std::optional<CaseResult::Duration> parse_timeout(std::string_view const tag)
+{
+    if (not tag.starts_with(timeout_tag_prefix)) {
+        return {};
+    }
+    auto const value = tag.substr(timeout_tag_prefix.size());
+    auto seconds = std::size_t{0};
+    if (auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), seconds);
+        ec != std::errc{} or end != value.data() + value.size()) {
+        return {};
+    }
+    return std::chrono::seconds{seconds};
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CaseResult::Duration timeout(framework::Name const & name, CaseResult::Duration const fallback)
+{
+    auto result = fallback;
+    for (auto const & tag : name.tags()) {
+        if (auto const tagged = parse_timeout(static_cast<std::string_view>(tag)); tagged) {
+            result = *tagged;
+        }
+    }
+    return result;
+}
+
+CaseResult::Duration elapsed_since(DeadlineClock::time_point const start)
+{
+    return std::chrono::duration_cast<CaseResult::Duration>(DeadlineClock::now() - start);
+}
+
+void report_timeout(
+    Conductor::Setup const & setup,
+    std::string_view const name,
+    CaseResult::Duration const limit,
+    std::vector<Activity> busy)
+{
+    std::sort(busy.begin(), busy.end(), [](Activity const & l, Activity const & r) { return l.m_worker < r.m_worker; });
+
+    auto const & colors = setup.m_colors;
+    auto out = utils::OSyncStream{setup.m_logger};
+    CaseReporter{{out, colors, BufferingMode::off}}(CaseReporter::Stop{name, limit, CaseStatus::timeout});
+    out << colors[Color::bad] << badge(BadgeType::headline) << " Warning: " << name << " exceeded its timeout of "
+        << utils::WithAdaptiveUnit{limit} << ". Busy workers:\n";
+    for (auto const & [worker, busy_name, elapsed] : busy) {
+        out << badge(BadgeType::empty) << "   - worker " << worker << ": " << busy_name << " (running for "
+            << utils::WithAdaptiveUnit{elapsed} << ")\n";
+    }
+    out << colors[Color::off] << std::flush;
+}
+
+CaseResult timeout_result(std::string_view const name, CaseResult::Duration const limit)
+{
+    auto details = std::ostringstream{};
+    details << "Exceeded timeout of " << utils::WithAdaptiveUnit{limit} << '.';
+    return CaseResult{
+        std::string{name},
+        CaseStatus::timeout,
+        limit,
+        {Observation{{"unknown", 0u}, ObservationStatus::fail_asserted, std::move(details).str(), {}}}};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Watchdog::Watchdog(std::size_t const num_workers) : m_slots(num_workers)
+{}
+
+void Watchdog::start(std::size_t const worker, std::size_t const copy, Duration const limit)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    auto & slot = m_slots[worker];
+    slot.m_state = State::busy;
+    slot.m_copy = copy;
+    slot.m_start = Clock::now();
+    slot.m_timeout = limit;
+    if (limit != Duration{}) {
+        m_update.notify_all(); // the watchdog might need to wake up earlier
+    }
+}
+
+bool Watchdog::stop(std::size_t const worker, std::size_t const generation)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    auto & slot = m_slots[worker];
+    if (slot.m_generation != generation or slot.m_state == State::abandoned) {
+        return false;
+    }
+    slot.m_state = State::idle;
+    return true;
+}
+
+void Watchdog::retire(std::size_t const worker, std::size_t const generation)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    auto & slot = m_slots[worker];
+    if (slot.m_generation == generation) {
+        slot.m_state = State::retired;
+        m_update.notify_all();
+    }
+}
+
+std::size_t Watchdog::revive(std::size_t const worker)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    auto & slot = m_slots[worker];
+    slot.m_state = State::idle;
+    return ++slot.m_generation;
+}
+
+std::optional<Watchdog::Expiry> Watchdog::await()
+{
+    auto lock = std::unique_lock{m_mutex};
+    while (true) {
+        auto const now = Clock::now();
+        auto deadline = std::optional<Clock::time_point>{};
+        auto num_active = 0ul;
+        for (auto w = 0ul; w < m_slots.size(); ++w) {
+            auto & slot = m_slots[w];
+            if (slot.m_state == State::idle or slot.m_state == State::busy) {
+                ++num_active;
+            }
+            if (slot.m_state != State::busy or slot.m_timeout == Duration{}) {
+                continue;
+            }
+            auto const slot_deadline = slot.m_start + slot.m_timeout;
+            if (slot_deadline <= now) {
+                slot.m_state = State::abandoned;
+                return Expiry{w, slot.m_copy, slot.m_timeout};
+            }
+            deadline = std::min(deadline.value_or(slot_deadline), slot_deadline);
+        }
+
+        if (num_active == 0ul) {
+            return {};
+        }
+        if (deadline) {
+            m_update.wait_until(lock, *deadline);
+        } else {
+            m_update.wait(lock);
+        }
+    }
+}
+
+std::vector<Activity> Watchdog::activities(framework::Registry const & cases, Repetitions const & repetitions) const
+{
+    auto const lock = std::lock_guard{m_mutex};
+    auto result = std::vector<Activity>{};
+    for (auto w = 0ul; w < m_slots.size(); ++w) {
+        auto const & slot = m_slots[w];
+        if (slot.m_state == State::busy or slot.m_state == State::abandoned) {
+            auto const & tc = cases[repetitions.case_index(slot.m_copy)];
+            result.emplace_back(Activity{w, tc.name().path(), elapsed_since(slot.m_start)});
+        }
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,118 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "Conductor.h"
+#include "Repetitions.h"
+
+#include <execute/CaseResult.h>
+
+#include <framework/Name.h>
+#include <framework/Registry.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace clean_test::execute {
+
+/// Determine the timeout for the test-case @p name: Specified by its (last) tag "timeout:SECONDS", else @p fallback.
+///
+/// A timeout of zero disables the timeout.
+CaseResult::Duration timeout(framework::Name const & name, CaseResult::Duration fallback);
+
+/// Monotonic clock for enforcing timeouts: Unlike the @c CaseResult::Clock, it isn't affected by adjustments of the
+/// system time (which would otherwise trigger spurious timeouts or suppress actual ones).
+using DeadlineClock = std::chrono::steady_clock;
+
+/// Time passed since @p start (for reporting it like the wall time of a @c CaseResult).
+CaseResult::Duration elapsed_since(DeadlineClock::time_point start);
+
+/// Details about a test-case in flight (e.g. for diagnosing timeouts).
+class Activity {
+public:
+    std::size_t m_worker; //!< index of the worker executing the test-case.
+    std::string_view m_name; //!< full name path of the test-case.
+    CaseResult::Duration m_elapsed; //!< duration of the execution (so far).
+};
+
+/// Report that the test-case @p name exceeded its @p limit (while all @p busy workers were executing test-cases).
+void report_timeout(
+    Conductor::Setup const & setup, std::string_view name, CaseResult::Duration limit, std::vector<Activity> busy);
+
+/// Create result for the test-case @p name which has been abandoned after exceeding its @p limit.
+CaseResult timeout_result(std::string_view name, CaseResult::Duration limit);
+
+/// Book-keeping of the test-cases in flight on all workers for detecting those exceeding their timeout.
+///
+/// Workers announce every test-case they start and stop. The thread observing the workers (i.e. the watchdog) waits
+/// for either all workers retiring or the first test-case exceeding its deadline. Workers are identified by their
+/// index and the generation of their slot: A worker replacing an abandoned one re-uses the index of its predecessor.
+class Watchdog {
+public:
+    using Clock = DeadlineClock;
+    using Duration = CaseResult::Duration;
+
+    /// Details about a test-case which exceeded its timeout.
+    class Expiry {
+    public:
+        std::size_t m_worker; //!< index of the worker executing the test-case.
+        std::size_t m_copy; //!< copy of the test-case (as planned by the @c Repetitions).
+        Duration m_timeout; //!< the exceeded timeout.
+    };
+
+    /// Detailed c'tor: prepare @p num_workers slots (in their initial generation).
+    explicit Watchdog(std::size_t num_workers);
+
+    /// Announce @p worker starting the test-case planned as @p copy which must finish within @p limit (0 for
+    /// unlimited).
+    void start(std::size_t worker, std::size_t copy, Duration limit);
+
+    /// Announce @p worker of @p generation finishing its test-case; false if it has been abandoned meanwhile.
+    ///
+    /// Abandoned workers must immediately stop (without reporting their result).
+    [[nodiscard]] bool stop(std::size_t worker, std::size_t generation);
+
+    /// Announce @p worker of @p generation having finished all its test-cases.
+    void retire(std::size_t worker, std::size_t generation);
+
+    /// Prepare the slot of abandoned @p worker for a replacement; returns the generation of the replacement.
+    std::size_t revive(std::size_t worker);
+
+    /// Block until all workers retired (nothing) or the test-case of any worker exceeded its deadline.
+    ///
+    /// The expired worker is considered as abandoned (i.e. its test-case result is discarded).
+    std::optional<Expiry> await();
+
+    /// Which of the @p cases (whose copies are planned by @p repetitions) are currently executed by the workers
+    /// (including abandoned ones).
+    std::vector<Activity> activities(framework::Registry const & cases, Repetitions const & repetitions) const;
+
+private:
+    enum class State {
+        idle, //!< between test-cases
+        busy, //!< executing a test-case
+        abandoned, //!< exceeded deadline of its test-case
+        retired, //!< finished all test-cases
+    };
+
+    class Slot {
+    public:
+        State m_state = State::idle;
+        std::size_t m_generation = 0ul; //!< incremented with every replacement of the worker.
+        std::size_t m_copy = 0ul; //!< copy of the test-case (if @c busy or @c abandoned).
+        Clock::time_point m_start = {}; //!< when the test-case started.
+        Duration m_timeout = {}; //!< limit for the test-case (0 for unlimited).
+    };
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_update; //!< notified whenever any slot changes.
+    std::vector<Slot> m_slots;
+};
+
+}
@@ -0,0 +1,101 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Assistance.h"
+
+#include "framework/ObservationSetup.h"
+
+namespace clean_test::framework {
+
+ParallelJob::ParallelJob(
+    std::size_t const begin,
+    std::size_t const end,
+    std::size_t const num_chunks,
+    Body const & body,
+    execute::Observer & observer) :
+    m_begin{begin}, m_size{end - begin}, m_num_chunks{num_chunks}, m_body{body}, m_observer{observer}
+{}
+
+bool ParallelJob::work()
+{
+    auto const chunk = m_next_chunk.fetch_add(1ul, std::memory_order_relaxed);
+    if (chunk >= m_num_chunks) {
+        return false;
+    }
+
+    if (not m_failed.load(std::memory_order_relaxed)) {
+        auto const setup = ObservationSetup{m_observer};
+        try {
+            auto const last = m_begin + m_size * (chunk + 1ul) / m_num_chunks;
+            for (auto index = m_begin + m_size * chunk / m_num_chunks; index < last; ++index) {
+                m_body(index);
+            }
+        } catch (...) {
+            auto const lock = std::lock_guard{m_mutex};
+            if (not m_exception) {
+                m_exception = std::current_exception();
+            }
+            m_failed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    auto const lock = std::lock_guard{m_mutex};
+    if (++m_num_finished == m_num_chunks) {
+        m_finished.notify_all();
+    }
+    return true;
+}
+
+void ParallelJob::wait()
+{
+    while (work()) {}
+    auto lock = std::unique_lock{m_mutex};
+    m_finished.wait(lock, [this] { return m_num_finished == m_num_chunks; });
+    if (m_exception) {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+void Assistance::offer(std::shared_ptr<ParallelJob> job)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    m_jobs.emplace_back(std::move(job));
+    m_changed.notify_all();
+}
+
+void Assistance::withdraw(ParallelJob const & job)
+{
+    auto const lock = std::lock_guard{m_mutex};
+    m_jobs.remove_if([&job](auto const & offered) { return offered.get() == &job; });
+}
+
+void Assistance::assist()
+{
+    auto lock = std::unique_lock{m_mutex};
+    if (--m_num_busy == 0ul) {
+        m_changed.notify_all();
+    }
+    while (true) {
+        m_jobs.remove_if([](auto const & offered) { return not offered->pending(); });
+        if (not m_jobs.empty()) {
+            auto const job = m_jobs.front(); // keeps job alive while working on it.
+            lock.unlock();
+            while (job->work()) {}
+            lock.lock();
+        } else if (m_num_busy == 0ul) {
+            return;
+        } else {
+            m_changed.wait(lock);
+        }
+    }
+}
+
+void Assistance::retire()
+{
+    auto const lock = std::lock_guard{m_mutex};
+    if (--m_num_busy == 0ul) {
+        m_changed.notify_all();
+    }
+}
+
+}
@@ -0,0 +1,142 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <framework/ObserverFwd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace clean_test::framework {
+
+/// Range of indices processed in chunks by the thread of a test-case and any assisting workers (c.f. @c parallel_for).
+class ParallelJob {
+public:
+    using Body = std::function<void(std::size_t)>;
+
+    /// Split [@p begin, @p end) into @p num_chunks for invoking @p body (of a test-case observed by @p observer).
+    ///
+    /// The @p body must outlive all chunks being worked on, i.e. until @c wait returned.
+    ParallelJob(
+        std::size_t begin, std::size_t end, std::size_t num_chunks, Body const & body, execute::Observer & observer);
+
+    /// Process the next unclaimed chunk; false if all chunks have been claimed already.
+    bool work();
+
+    /// Whether there are chunks which haven't been claimed yet.
+    [[nodiscard]] bool pending() const noexcept
+    {
+        return m_next_chunk.load(std::memory_order_relaxed) < m_num_chunks;
+    }
+
+    /// Wait until all chunks finished; rethrows the first exception of any of them.
+    void wait();
+
+    // non-copyable and non-movable
+    ParallelJob(ParallelJob &&) = delete;
+    ParallelJob & operator=(ParallelJob &&) = delete;
+    ParallelJob(ParallelJob const &) = delete;
+    ParallelJob & operator=(ParallelJob const &) = delete;
+
+private:
+    std::size_t const m_begin;
+    std::size_t const m_size; //!< number of indices.
+    std::size_t const m_num_chunks;
+    Body const & m_body;
+    execute::Observer & m_observer; //!< of the test-case (setup on every participating thread).
+
+    std::atomic<std::size_t> m_next_chunk = 0ul; //!< index of the next chunk to claim.
+    std::atomic<bool> m_failed = false; //!< whether any chunk threw (thus remaining chunks are skipped).
+    std::mutex m_mutex = {};
+    std::condition_variable m_finished = {}; //!< notified once all chunks finished.
+    std::size_t m_num_finished = 0ul; //!< number of finished (or skipped) chunks.
+    std::exception_ptr m_exception = {}; //!< first exception thrown by any chunk.
+};
+
+/// Workers of one execution which assist test-cases with their @c ParallelJob s once they are idle.
+///
+/// Workers count as busy until they call @c assist (i.e. won't start any further test-cases). Idle workers process
+/// chunks of offered jobs until no worker is busy anymore (since nobody could offer further jobs then).
+class Assistance {
+public:
+    /// Assistance among @p num_workers (initially busy) workers.
+    explicit Assistance(std::size_t num_workers) : m_num_workers{num_workers}, m_num_busy{num_workers}
+    {}
+
+    /// Number of workers (i.e. maximum number of threads participating in any job).
+    [[nodiscard]] std::size_t num_workers() const noexcept
+    {
+        return m_num_workers;
+    }
+
+    /// Make (unclaimed chunks of) @p job available to idle workers.
+    void offer(std::shared_ptr<ParallelJob> job);
+
+    /// Stop offering @p job (e.g. once all of its chunks have been claimed).
+    void withdraw(ParallelJob const & job);
+
+    /// Mark the calling worker as idle and help with offered jobs until no worker is busy anymore.
+    void assist();
+
+    /// Mark a busy worker as idle without assisting (e.g. after abandoning it).
+    void retire();
+
+    // non-copyable and non-movable
+    Assistance(Assistance &&) = delete;
+    Assistance & operator=(Assistance &&) = delete;
+    Assistance(Assistance const &) = delete;
+    Assistance & operator=(Assistance const &) = delete;
+
+private:
+    std::size_t const m_num_workers;
+    std::mutex m_mutex = {};
+    std::condition_variable m_changed = {}; //!< notified on offered jobs and once no worker is busy anymore.
+    std::list<std::shared_ptr<ParallelJob>> m_jobs = {}; //!< offered jobs (potentially with unclaimed chunks).
+    std::size_t m_num_busy; //!< number of workers which may still offer jobs.
+};
+
+/// Scoped wrapper to maintain the (global) @c Assistance used by @c parallel_for.
+///
+/// Without any setup, @c parallel_for processes all indices sequentially on the calling thread.
+class AssistanceSetup {
+public:
+    /// Setup @p a as assistance for the lifetime of the created object.
+    explicit AssistanceSetup(Assistance & a) : m_reset{std::exchange(assistance(), std::addressof(a))}
+    {}
+
+    /// Reset assistance (as it was before the lifetime of this object).
+    ~AssistanceSetup()
+    {
+        assistance() = m_reset;
+    }
+
+    /// Access (globally) managed assistance; nullptr if there is none.
+    static inline Assistance * & assistance();
+
+    // non-copyable and non-movable
+    AssistanceSetup(AssistanceSetup &&) = delete;
+    AssistanceSetup & operator=(AssistanceSetup &&) = delete;
+    AssistanceSetup(AssistanceSetup const &) = delete;
+    AssistanceSetup & operator=(AssistanceSetup const &) = delete;
+
+private:
+    Assistance * m_reset; //!< a previously setup assistance.
+};
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Assistance * & AssistanceSetup::assistance()
+{
+    static Assistance * singleton = nullptr;
+    return singleton;
+}
+
+}
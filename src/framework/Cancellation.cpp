@@ -0,0 +1,15 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "framework/Cancellation.h"
+
+#include <framework/CancellationSetup.h>
+
+namespace clean_test::framework {
+
+bool cancellation_requested() noexcept
+{
+    return CancellationSetup::flag()->load(std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,66 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace clean_test::framework {
+
+/// Scoped wrapper to maintain the (global) flag behind @c cancellation_requested.
+///
+/// By default, the flag resides in static memory. Execution facilities spanning multiple processes relocate it into
+/// memory shared with their worker processes for the lifetime of a @c CancellationSetup.
+class CancellationSetup {
+public:
+    using Flag = std::atomic<bool>;
+
+    static_assert(Flag::is_always_lock_free, "The flag must be usable from signal handlers and shared memory.");
+
+    /// Setup @p f as cancellation flag for the lifetime of the created object.
+    explicit CancellationSetup(Flag & f) : m_reset{std::exchange(flag(), std::addressof(f))}
+    {}
+
+    /// Reset cancellation flag (as it was before the lifetime of this object).
+    ~CancellationSetup()
+    {
+        flag() = m_reset;
+    }
+
+    /// Access (globally) managed cancellation flag.
+    static inline Flag * & flag();
+
+    /// Cancel the current test execution.
+    static void request() noexcept
+    {
+        flag()->store(true, std::memory_order_relaxed);
+    }
+
+    /// Withdraw any cancellation (e.g. before starting another execution).
+    static void reset() noexcept
+    {
+        flag()->store(false, std::memory_order_relaxed);
+    }
+
+    // non-copyable and non-movable
+    CancellationSetup(CancellationSetup &&) = delete;
+    CancellationSetup & operator=(CancellationSetup &&) = delete;
+    CancellationSetup(CancellationSetup const &) = delete;
+    CancellationSetup & operator=(CancellationSetup const &) = delete;
+
+private:
+    Flag * m_reset; //!< a previously setup flag.
+};
+
+// Implementation //////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CancellationSetup::Flag * & CancellationSetup::flag()
+{
+    static auto fallback = Flag{false};
+    static Flag * singleton = &fallback;
+    return singleton;
+}
+
+}
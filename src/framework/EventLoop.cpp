@@ -0,0 +1,213 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "EventLoop.h"
+
+#include "framework/ObservationSetup.h"
+
+#if defined(__linux__) and __has_include(<sys/epoll.h>)
+# define CLEANTEST_HAS_EPOLL 1
+# include <fcntl.h>
+# include <sys/epoll.h>
+# include <unistd.h>
+#else
+# define CLEANTEST_HAS_EPOLL 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace clean_test::framework {
+namespace {
+
+EventLoop * & current_loop()
+{
+    thread_local EventLoop * loop = nullptr;
+    return loop;
+}
+
+/// Scoped setup of the event loop of the calling thread (while it resumes coroutines).
+class Activation {
+public:
+    explicit Activation(EventLoop & loop) : m_reset{std::exchange(current_loop(), &loop)}
+    {}
+
+    ~Activation()
+    {
+        current_loop() = m_reset;
+    }
+
+    // non-copyable and non-movable
+    Activation(Activation &&) = delete;
+    Activation & operator=(Activation &&) = delete;
+    Activation(Activation const &) = delete;
+    Activation & operator=(Activation const &) = delete;
+
+private:
+    EventLoop * m_reset; //!< a previously active event loop.
+};
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventLoop::EventLoop()
+{
+#if CLEANTEST_HAS_EPOLL
+    m_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll < 0) {
+        throw std::system_error{errno, std::system_category(), "Failed to create epoll instance"};
+    }
+#endif
+}
+
+EventLoop::~EventLoop()
+{
+#if CLEANTEST_HAS_EPOLL
+    for (auto const & [key, waiter] : m_waiters) {
+        ::close(waiter.m_file_descriptor);
+    }
+    ::close(m_epoll);
+#endif
+}
+
+void EventLoop::spawn(Task task, execute::Observer & observer, Completion done)
+{
+    auto const handle = task.handle();
+    m_tasks.emplace_back(Spawned{std::move(task), std::move(done)});
+    resume(handle, &observer);
+}
+
+void EventLoop::run_once(bool const block)
+{
+    if (m_tasks.empty()) {
+        return;
+    }
+    if (m_timers.empty() and m_waiters.empty()) {
+        abandon();
+        return;
+    }
+
+    auto timeout = std::chrono::milliseconds{};
+    if (block and not m_timers.empty()) {
+        auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(m_timers.top().m_deadline - Clock::now());
+        timeout = std::max(std::chrono::milliseconds{}, remaining);
+    } else if (block) {
+        timeout = std::chrono::milliseconds{-1};
+    }
+
+    for (auto const & waiter : poll(timeout)) {
+        resume(waiter.m_handle, waiter.m_observer);
+    }
+    auto const now = Clock::now();
+    while (not m_timers.empty() and m_timers.top().m_deadline <= now) {
+        auto const timer = m_timers.top();
+        m_timers.pop();
+        resume(timer.m_handle, timer.m_observer);
+    }
+}
+
+EventLoop & EventLoop::current()
+{
+    if (current_loop() == nullptr) {
+        throw std::logic_error{"Awaiting events is only supported within coroutine test-cases."};
+    }
+    return *current_loop();
+}
+
+void EventLoop::schedule(Clock::time_point const deadline, std::coroutine_handle<> const handle)
+{
+    m_timers.push(Timer{deadline, m_num_scheduled++, handle, &ObservationSetup::observer()});
+}
+
+void EventLoop::watch(int const file_descriptor, FileAwaiter::Event const event, std::coroutine_handle<> const handle)
+{
+#if CLEANTEST_HAS_EPOLL
+    // Watch a duplicate: This allows multiple coroutines to await the same file descriptor.
+    auto const duplicate = ::fcntl(file_descriptor, F_DUPFD_CLOEXEC, 0);
+    if (duplicate < 0) {
+        throw std::system_error{errno, std::system_category(), "Failed to watch file descriptor"};
+    }
+    auto const key = m_num_watched++;
+    auto registration = ::epoll_event{};
+    registration.events = (event == FileAwaiter::Event::writable ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+    registration.data.u64 = key;
+    if (::epoll_ctl(m_epoll, EPOLL_CTL_ADD, duplicate, &registration) != 0) {
+        auto const error = errno;
+        ::close(duplicate);
+        throw std::system_error{error, std::system_category(), "Failed to watch file descriptor"};
+    }
+    m_waiters.emplace(key, Waiter{duplicate, handle, &ObservationSetup::observer()});
+#else
+    static_cast<void>(file_descriptor);
+    static_cast<void>(event);
+    static_cast<void>(handle);
+    throw std::runtime_error{"Awaiting file descriptors is not supported on this platform."};
+#endif
+}
+
+void EventLoop::resume(std::coroutine_handle<> const handle, execute::Observer * const observer)
+{
+    if (handle) {
+        auto const activation = Activation{*this};
+        auto const setup = ObservationSetup{*observer};
+        handle.resume();
+    }
+
+    for (auto pos = m_tasks.begin(); pos != m_tasks.end();) {
+        if (not pos->m_task.done()) {
+            ++pos;
+            continue;
+        }
+        auto finished = std::move(*pos);
+        pos = m_tasks.erase(pos);
+        auto error = std::exception_ptr{};
+        try {
+            finished.m_task.result();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        finished.m_done(std::move(error));
+    }
+}
+
+std::vector<EventLoop::Waiter> EventLoop::poll(std::chrono::milliseconds const timeout)
+{
+    if (m_waiters.empty()) {
+        std::this_thread::sleep_for(timeout);
+        return {};
+    }
+
+    auto result = std::vector<Waiter>{};
+#if CLEANTEST_HAS_EPOLL
+    auto events = std::array<::epoll_event, 64ul>{};
+    auto const milliseconds = static_cast<int>(std::min<std::chrono::milliseconds::rep>(timeout.count(), INT_MAX));
+    auto const count = ::epoll_wait(m_epoll, events.data(), static_cast<int>(events.size()), milliseconds);
+    if (count < 0 and errno != EINTR) {
+        throw std::system_error{errno, std::system_category(), "Failed to wait for file descriptors"};
+    }
+    for (auto i = 0; i < count; ++i) {
+        if (auto node = m_waiters.extract(events[static_cast<std::size_t>(i)].data.u64); node) {
+            ::close(node.mapped().m_file_descriptor);
+            result.emplace_back(std::move(node.mapped()));
+        }
+    }
+#endif
+    return result;
+}
+
+void EventLoop::abandon()
+{
+    auto const error = std::make_exception_ptr(
+        std::logic_error{"Coroutine test-case suspended without awaiting any timer or file descriptor."});
+    for (auto & [task, done] : std::exchange(m_tasks, {})) {
+        done(error);
+    }
+}
+
+}
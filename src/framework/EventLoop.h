@@ -0,0 +1,109 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <framework/ObserverFwd.h>
+#include <framework/Task.h>
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace clean_test::framework {
+
+/// Single-threaded scheduler interleaving suspended coroutine test-cases (c.f. @c Task).
+///
+/// Coroutines suspend on timers (c.f. @c TimerAwaiter) or file descriptors (c.f. @c FileAwaiter, using epoll where
+/// available). Each suspended coroutine remembers the @c Observer of its test-case; this is setup (c.f.
+/// @c ObservationSetup) whenever the coroutine is resumed.
+class EventLoop {
+public:
+    using Clock = TimerAwaiter::Clock;
+    /// Callback for finished tasks: receives the exception the task failed with (if any).
+    using Completion = std::function<void(std::exception_ptr)>;
+
+    EventLoop();
+    ~EventLoop();
+
+    /// Start @p task (of a test-case observed by @p observer); @p done is invoked once it finished.
+    void spawn(Task task, execute::Observer & observer, Completion done);
+
+    /// Number of spawned tasks which haven't finished yet.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_tasks.size();
+    }
+
+    /// Resume all coroutines whose awaited events occurred; waits for the next event first if @p block.
+    ///
+    /// Tasks suspended without awaiting any event of this loop can never finish: They fail once nothing else is left.
+    void run_once(bool block);
+
+    /// Event loop of the calling thread (while it resumes any coroutines); throws if there is none.
+    static EventLoop & current();
+
+    /// Resume @p handle (of the current test-case) once @p deadline has been reached.
+    void schedule(Clock::time_point deadline, std::coroutine_handle<> handle);
+
+    /// Resume @p handle (of the current test-case) once @p file_descriptor is ready for @p event.
+    void watch(int file_descriptor, FileAwaiter::Event event, std::coroutine_handle<> handle);
+
+    // non-copyable and non-movable
+    EventLoop(EventLoop &&) = delete;
+    EventLoop & operator=(EventLoop &&) = delete;
+    EventLoop(EventLoop const &) = delete;
+    EventLoop & operator=(EventLoop const &) = delete;
+
+private:
+    /// A spawned task which hasn't finished yet.
+    class Spawned {
+    public:
+        Task m_task;
+        Completion m_done;
+    };
+
+    /// A coroutine waiting for its deadline.
+    class Timer {
+    public:
+        Clock::time_point m_deadline;
+        std::uint64_t m_sequence; //!< for resuming coroutines with the same deadline in order of suspension.
+        std::coroutine_handle<> m_handle;
+        execute::Observer * m_observer;
+
+        friend bool operator>(Timer const & l, Timer const & r) noexcept
+        {
+            return std::pair{l.m_deadline, l.m_sequence} > std::pair{r.m_deadline, r.m_sequence};
+        }
+    };
+
+    /// A coroutine waiting for a file descriptor.
+    class Waiter {
+    public:
+        int m_file_descriptor; //!< duplicate of the awaited file descriptor (owned by the loop).
+        std::coroutine_handle<> m_handle;
+        execute::Observer * m_observer;
+    };
+
+    /// Resume @p handle with @p observer setup; then complete all finished tasks.
+    void resume(std::coroutine_handle<> handle, execute::Observer * observer);
+    /// Wait at most @p timeout for file descriptors; returns the handles of those which became ready.
+    std::vector<Waiter> poll(std::chrono::milliseconds timeout);
+    /// Fail all remaining tasks: they can never be resumed.
+    void abandon();
+
+    int m_epoll = -1; //!< epoll instance for waiting on file descriptors (if supported).
+    std::list<Spawned> m_tasks = {};
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<>> m_timers = {};
+    std::uint64_t m_num_scheduled = 0ul; //!< number of coroutines scheduled (thus next sequence).
+    std::unordered_map<std::uint64_t, Waiter> m_waiters = {}; //!< by key registered with epoll.
+    std::uint64_t m_num_watched = 0ul; //!< number of file descriptors watched (thus next key).
+};
+
+}
@@ -0,0 +1,44 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "framework/Parallel.h"
+
+#include "framework/ObservationSetup.h"
+
+#include <framework/Assistance.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace clean_test::framework {
+namespace {
+
+/// Number of chunks per worker: balances uneven chunks without too much synchronization.
+constexpr auto chunks_per_worker = 4ul;
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void parallel_for(std::size_t const begin, std::size_t const end, std::function<void(std::size_t)> const & body)
+{
+    if (begin >= end) {
+        return;
+    }
+
+    auto * const assistance = AssistanceSetup::assistance();
+    auto const num_chunks
+        = (assistance == nullptr) ? 1ul : std::min(end - begin, chunks_per_worker * assistance->num_workers());
+    auto const job = std::make_shared<ParallelJob>(begin, end, num_chunks, body, ObservationSetup::observer());
+    if (num_chunks > 1ul) {
+        assistance->offer(job);
+    }
+
+    // Participate until all chunks have been claimed; then wait for the assisting workers.
+    while (job->work()) {}
+    if (num_chunks > 1ul) {
+        assistance->withdraw(*job);
+    }
+    job->wait();
+}
+
+}
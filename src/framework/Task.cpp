@@ -0,0 +1,41 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "framework/Task.h"
+
+#include <framework/EventLoop.h>
+
+namespace clean_test::framework {
+
+std::coroutine_handle<> Task::FinalAwaiter::await_suspend(Handle const handle) const noexcept
+{
+    if (auto const continuation = handle.promise().m_continuation; continuation) {
+        return continuation;
+    }
+    return std::noop_coroutine();
+}
+
+void TimerAwaiter::await_suspend(std::coroutine_handle<> const handle) const
+{
+    EventLoop::current().schedule(m_deadline, handle);
+}
+
+void FileAwaiter::await_suspend(std::coroutine_handle<> const handle) const
+{
+    EventLoop::current().watch(m_file_descriptor, m_event, handle);
+}
+
+void sync_wait(Task task, execute::Observer & observer)
+{
+    auto loop = EventLoop{};
+    auto error = std::exception_ptr{};
+    loop.spawn(std::move(task), observer, [&error](std::exception_ptr failure) { error = std::move(failure); });
+    while (loop.size() > 0ul) {
+        loop.run_once(true);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
@@ -0,0 +1,28 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace clean_test::utils {
+
+/// Hashing support for heterogeneous lookup of @c std::string keys (with @c std::string_view ).
+class StringHash {
+public:
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view const v) const noexcept
+    {
+        return std::hash<std::string_view>{}(v);
+    }
+};
+
+/// Set of strings supporting lookup by @c std::string_view (without allocation).
+using StringSet = std::unordered_set<std::string, StringHash, std::equal_to<>>;
+
+}
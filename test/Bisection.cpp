@@ -0,0 +1,138 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Bisection.h>
+#include <execute/Configuration.h>
+#include <execute/Journal.h>
+#include <execute/Main.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/clean-test.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+using Trial = Bisection::Trial;
+
+/// Simulated trials: The victim fails iff all @p culprits are executed before it; checks the number of concurrent
+/// trials against @p num_parallel.
+Bisection::Reproduce simulated(Trial culprits, std::size_t const num_parallel)
+{
+    return [culprits = std::move(culprits), num_parallel](std::vector<Trial> const & trials) {
+        ct::utils::dynamic_assert(trials.size() <= std::max(num_parallel, 2ul));
+        auto result = std::vector<bool>{};
+        for (auto const & trial : trials) {
+            ct::utils::dynamic_assert(std::is_sorted(trial.cbegin(), trial.cend()));
+            result.emplace_back(std::includes(trial.cbegin(), trial.cend(), culprits.cbegin(), culprits.cend()));
+        }
+        return result;
+    };
+}
+
+void narrowing()
+{
+    // A single culprit is found in logarithmically many rounds (plus the confirming one).
+    auto const single = bisect(100ul, 4ul, simulated({37ul}, 4ul));
+    ct::utils::dynamic_assert(single.m_verdict == Bisection::Verdict::polluted);
+    ct::utils::dynamic_assert(single.m_culprits == Trial{37ul});
+    ct::utils::dynamic_assert(single.m_num_rounds <= 5ul);
+
+    auto const sequential = bisect(1000ul, 1ul, simulated({999ul}, 1ul));
+    ct::utils::dynamic_assert(sequential.m_culprits == Trial{999ul});
+    ct::utils::dynamic_assert(sequential.m_num_rounds <= 11ul);
+
+    // Culprits which only pollute together are all found.
+    for (auto const num_parallel : {1ul, 2ul, 3ul, 8ul}) {
+        auto const pair = bisect(50ul, num_parallel, simulated({3ul, 42ul}, num_parallel));
+        ct::utils::dynamic_assert(pair.m_verdict == Bisection::Verdict::polluted);
+        ct::utils::dynamic_assert(pair.m_culprits == Trial{3ul, 42ul});
+    }
+
+    // Culprits within the same half, but in different chunks, are found without any bystander.
+    for (auto const num_parallel : {4ul, 8ul}) {
+        auto const half = bisect(8ul, num_parallel, simulated({4ul, 6ul}, num_parallel));
+        ct::utils::dynamic_assert(half.m_verdict == Bisection::Verdict::polluted);
+        ct::utils::dynamic_assert(half.m_culprits == Trial{4ul, 6ul});
+    }
+    auto const spread = bisect(100ul, 4ul, simulated({51ul, 60ul, 88ul}, 4ul));
+    ct::utils::dynamic_assert(spread.m_culprits == (Trial{51ul, 60ul, 88ul}));
+
+    // Failures without (or despite all) candidates aren't caused by pollution.
+    auto const self_failing = bisect(10ul, 2ul, simulated({}, 2ul));
+    ct::utils::dynamic_assert(self_failing.m_verdict == Bisection::Verdict::self_failing);
+    ct::utils::dynamic_assert(self_failing.m_num_rounds == 1ul);
+    auto const unreproducible = bisect(10ul, 2ul, simulated({10ul}, 2ul));
+    ct::utils::dynamic_assert(unreproducible.m_verdict == Bisection::Verdict::unreproducible);
+    ct::utils::dynamic_assert(unreproducible.m_culprits.empty());
+}
+
+bool polluted = false; //!< static state shared by the test-cases (reset in every forked trial).
+
+void register_cases()
+{
+    for (auto i = 0; i < 6; ++i) {
+        ct::Test{"bystander/" + std::to_string(i), [] { ct::expect(true); }};
+    }
+    "polluter"_test = [] { polluted = true; };
+    "victim"_test = [] { ct::expect(not polluted); };
+}
+
+void forking(std::filesystem::path const & path)
+{
+    register_cases();
+    {
+        // Recorded execution: The polluter ran on the same worker (process) as the victim, bystander/5 on another one.
+        auto journal = Journal{path, false};
+        for (auto const * name : {"bystander/0", "bystander/1", "polluter", "bystander/2", "bystander/5", "victim"}) {
+            journal.on_case_start(name);
+            auto result = CaseResult{name, CaseStatus::pass, CaseResult::Duration{}, {}};
+            result.m_worker = (std::string_view{name} == "bystander/5") ? 1ul : 0ul;
+            journal.on_result(result);
+        }
+    }
+
+    auto logger = std::ostringstream{};
+    auto cfg = Configuration{};
+    cfg.m_operation = OperationMode::bisect;
+    cfg.m_coloring = ColoringMode::disabled;
+    cfg.m_logger = &logger;
+    cfg.m_num_jobs = 2ul;
+    cfg.m_journal_path = path;
+    cfg.m_pollution_victim = "victim";
+    ct::utils::dynamic_assert(ct::execute::main(cfg) == 0);
+
+    auto const output = std::move(logger).str();
+    ct::utils::dynamic_assert(output.find("Bisecting 4 test-cases executed before victim") != std::string::npos);
+    ct::utils::dynamic_assert(output.find("fails after 1 polluting test-case(s):\n    polluter\n") != output.npos);
+
+    // Test-cases which weren't executed before aren't bisected.
+    cfg.m_pollution_victim = "bystander/0";
+    ct::utils::dynamic_assert(ct::execute::main(cfg) == 1);
+    cfg.m_pollution_victim = "unknown";
+    ct::utils::dynamic_assert(ct::execute::main(cfg) == 1);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::narrowing();
+    if (ct::execute::supports_isolation()) {
+        auto const path = std::filesystem::temp_directory_path() / "clean-test-bisection.bin";
+        ct::execute::forking(path);
+        std::filesystem::remove(path);
+    }
+}
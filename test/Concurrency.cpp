@@ -0,0 +1,123 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Concurrency.h>
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/framework.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+void adaptation()
+{
+    // Idle CPUs: more workers (at most doubling per step).
+    ct::utils::dynamic_assert(adapt(4ul, 0.1, 8ul, 32ul) == 8ul);
+    ct::utils::dynamic_assert(adapt(8ul, 0.5, 8ul, 32ul) == 15ul);
+    ct::utils::dynamic_assert(adapt(30ul, 0.0, 8ul, 32ul) == 32ul);
+
+    // Saturated CPUs: fewer workers (but never less than one per CPU).
+    ct::utils::dynamic_assert(adapt(16ul, 1.0, 8ul, 32ul) == 14ul);
+    ct::utils::dynamic_assert(adapt(9ul, 0.99, 8ul, 32ul) == 8ul);
+    ct::utils::dynamic_assert(adapt(8ul, 1.0, 8ul, 32ul) == 8ul);
+
+    // In between: unchanged.
+    ct::utils::dynamic_assert(adapt(12ul, 0.9, 8ul, 32ul) == 12ul);
+    ct::utils::dynamic_assert(adapt(0ul, 0.5, 8ul, 32ul) == 1ul);
+}
+
+void fixed()
+{
+    auto concurrency = Concurrency{4ul, 8ul, false};
+    ct::utils::dynamic_assert(not concurrency.adaptive());
+    ct::utils::dynamic_assert(concurrency.await(3ul, 0ms));
+    ct::utils::dynamic_assert(not concurrency.await(4ul, 0ms));
+    concurrency.tune(std::stop_token{}, 1ms);
+    ct::utils::dynamic_assert(concurrency.timeline().size() == 1ul);
+    ct::utils::dynamic_assert(concurrency.timeline().front().m_limit == 4ul);
+}
+
+void tuning()
+{
+    auto concurrency = Concurrency{32ul, 2ul, true};
+    ct::utils::dynamic_assert(concurrency.adaptive());
+    ct::utils::dynamic_assert(concurrency.await(1ul, 0ms));
+    ct::utils::dynamic_assert(not concurrency.await(2ul, 0ms));
+    {
+        // This (sleeping) process hardly utilizes its CPUs: more workers are admitted.
+        auto const tuner = std::jthread{[&concurrency](std::stop_token const stop) { concurrency.tune(stop, 10ms); }};
+        ct::utils::dynamic_assert(concurrency.await(5ul, 10s));
+    }
+    auto const timeline = concurrency.timeline();
+    ct::utils::dynamic_assert(timeline.size() > 1ul);
+    ct::utils::dynamic_assert(timeline.front().m_limit == 2ul);
+    ct::utils::dynamic_assert(std::is_sorted(timeline.cbegin(), timeline.cend(), [](auto const & l, auto const & r) {
+        return l.m_offset < r.m_offset;
+    }));
+}
+
+/// Execute sleepy test-cases (all available CPUs hardly utilized) on adaptive workers, reporting into @p logger.
+Outcome run_sleepy(std::ostream & logger, IsolationMode const isolation)
+{
+    for (auto i = 0; i < 48; ++i) {
+        ct::Test{"sleepy/" + std::to_string(i), [] { std::this_thread::sleep_for(30ms); }};
+    }
+    return run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 0ul;
+        setup.m_adaptive_workers = true;
+        setup.m_isolation = isolation;
+    });
+}
+
+void execution()
+{
+    auto logger = std::ostringstream{};
+    auto const outcome = run_sleepy(logger, IsolationMode::off);
+    ct::utils::dynamic_assert(outcome.m_results.size() == 48ul);
+    ct::utils::dynamic_assert(std::all_of(outcome.m_results.cbegin(), outcome.m_results.cend(), [](auto const & r) {
+        return r.m_status == CaseStatus::pass;
+    }));
+    ct::utils::dynamic_assert(contains(std::move(logger).str(), "Workers adapted to CPU utilization: "));
+}
+
+void isolated()
+{
+    auto logger = std::ostringstream{};
+    auto const outcome = run_sleepy(logger, IsolationMode::process);
+    ct::utils::dynamic_assert(outcome.m_results.size() == 48ul);
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "Adaptive concurrency is not supported for isolated execution"));
+    ct::utils::dynamic_assert(not contains(console, "Workers adapted to CPU utilization"));
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::adaptation();
+    ct::execute::fixed();
+    ct::execute::tuning();
+    ct::execute::execution();
+    if (ct::execute::supports_isolation()) {
+        ct::execute::isolated();
+    }
+}
@@ -157,6 +157,44 @@ void buffering()
     assert_invalid("--buffered ", "Invalid argument");
 }
 
+void isolation()
+{
+    static constexpr auto enabled = ct::execute::IsolationMode::process;
+    auto const get = [](Configuration const & cfg) { return cfg.m_isolation; };
+    assert_valid(get, "", Configuration{}.m_isolation);
+    assert_valid(get, "-i", enabled);
+    assert_valid(get, "--isolate", enabled);
+    assert_valid(get, "-bi", enabled);
+    assert_valid(get, "-i --isolate", enabled);
+
+    assert_invalid("-i=true", "Invalid argument");
+    assert_invalid("--isolate=1", "Invalid argument");
+    assert_invalid("--isolate yes", "Invalid argument");
+}
+
+void pinning()
+{
+    static constexpr auto enabled = ct::execute::PinningMode::cores;
+    auto const get = [](Configuration const & cfg) { return cfg.m_pinning; };
+    assert_valid(get, "", Configuration{}.m_pinning);
+    assert_valid(get, "--pin", enabled);
+    assert_valid(get, "--pin --pin", enabled);
+
+    assert_invalid("--pin=1", "Invalid argument");
+    assert_invalid("--pinned", "Invalid argument");
+}
+
+void jobserver()
+{
+    auto const get = [](Configuration const & cfg) { return cfg.m_jobserver; };
+    assert_valid(get, "", Configuration{}.m_jobserver);
+    assert_valid(get, "--jobserver", true);
+    assert_valid(get, "--jobserver -j 4 --jobserver", true);
+
+    assert_invalid("--jobserver=fifo:/tmp/x", "Invalid argument");
+    assert_invalid("--jobservers", "Invalid argument");
+}
+
 void threads()
 {
     auto const get = [](Configuration const & cfg) { return cfg.m_num_jobs; };
@@ -175,6 +213,103 @@ void threads()
     assert_invalid("--jobs=", "Missing mandatory details");
     assert_invalid("--jobs", "Missing mandatory details");
     assert_invalid("--jobs --color", "Invalid argument");
+    assert_invalid("--jobs=adaptive --jobs=4", "Contradicting arguments");
+    assert_invalid("--jobs=4 --jobs=adaptive", "Contradicting arguments");
+    assert_invalid("--jobs=Adaptive", "Invalid argument");
+
+    auto const adaptive = [](Configuration const & cfg) { return cfg.m_adaptive_jobs; };
+    assert_valid(adaptive, "", false);
+    assert_valid(adaptive, "--jobs=4", false);
+    assert_valid(adaptive, "--jobs=adaptive", true);
+    assert_valid(adaptive, "-j adaptive --jobs adaptive", true);
+}
+
+void timeout()
+{
+    using namespace std::chrono_literals;
+    auto const get = [](Configuration const & cfg) { return cfg.m_timeout; };
+    assert_valid(get, "", Configuration{}.m_timeout);
+    assert_valid(get, "--timeout=0", 0s);
+    assert_valid(get, "--timeout 30", 30s);
+    assert_valid(get, "--timeout=5 --timeout 5", 5s);
+
+    assert_invalid("--timeout=5s", "Invalid argument");
+    assert_invalid("--timeout=-1", "Invalid argument");
+    assert_invalid("--timeout=4 --timeout=5", "Contradicting arguments");
+    assert_invalid("--timeout", "Missing mandatory details");
+
+    using T = ct::execute::TimeoutMode;
+    auto const get_mode = [](Configuration const & cfg) { return cfg.m_on_timeout; };
+    assert_valid(get_mode, "", T::proceed);
+    assert_valid(get_mode, "--on-timeout=proceed", T::proceed);
+    assert_valid(get_mode, "--on-timeout terminate", T::terminate);
+
+    assert_invalid("--on-timeout=abort", "Invalid argument");
+    assert_invalid("--on-timeout=proceed --on-timeout=terminate", "Contradicting arguments");
+    assert_invalid("--on-timeout", "Missing mandatory details");
+}
+
+void fail_fast()
+{
+    auto const get = [](Configuration const & cfg) { return cfg.m_max_failures; };
+    assert_valid(get, "", Configuration{}.m_max_failures);
+    assert_valid(get, "--fail-fast", 1ul);
+    assert_valid(get, "--fail-fast=3", 3ul);
+    assert_valid(get, "--fail-fast=1 --fail-fast", 1ul);
+
+    assert_invalid("--fail-fast=0", "Invalid argument");
+    assert_invalid("--fail-fast=all", "Invalid argument");
+    assert_invalid("--fail-fast 3", "Invalid argument");
+    assert_invalid("--fail-fast=2 --fail-fast=3", "Contradicting arguments");
+}
+
+void repeat()
+{
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_repetitions, cfg.m_until_fail}; };
+    assert_valid(get, "", std::pair{Configuration{}.m_repetitions, Configuration{}.m_until_fail});
+    assert_valid(get, "--repeat=1000", std::pair{1000ul, false});
+    assert_valid(get, "--until-fail --repeat 10", std::pair{10ul, true});
+    assert_valid(get, "--repeat=2 --repeat=2 --until-fail --until-fail", std::pair{2ul, true});
+
+    assert_invalid("--repeat=0", "Invalid argument");
+    assert_invalid("--repeat=often", "Invalid argument");
+    assert_invalid("--repeat=2 --repeat=3", "Contradicting arguments");
+    assert_invalid("--repeat", "Missing mandatory details");
+    assert_invalid("--until-fail", "Missing mandatory details");
+    assert_invalid("--until-fail --repeat=1", "Missing mandatory details");
+}
+
+void retries()
+{
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_retries, cfg.m_quarantine_path}; };
+    assert_valid(get, "", std::pair{Configuration{}.m_retries, Configuration{}.m_quarantine_path});
+    assert_valid(get, "--retries=3", std::pair{3ul, std::filesystem::path{}});
+    assert_valid(get, "--retries 0 --quarantine=q.txt", std::pair{0ul, std::filesystem::path{"q.txt"}});
+    assert_valid(get, "--quarantine q.txt --retries=1 --retries=1", std::pair{1ul, std::filesystem::path{"q.txt"}});
+
+    assert_invalid("--retries=often", "Invalid argument");
+    assert_invalid("--retries=1 --retries=2", "Contradicting arguments");
+    assert_invalid("--retries", "Missing mandatory details");
+    assert_invalid("--quarantine", "Missing mandatory details");
+    assert_invalid("--quarantine=a.txt --quarantine=b.txt", "Contradicting arguments");
+}
+
+void shard()
+{
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_shard_index, cfg.m_num_shards}; };
+    assert_valid(get, "", std::pair{Configuration{}.m_shard_index, Configuration{}.m_num_shards});
+    assert_valid(get, "--shard=1/1", std::pair{0ul, 1ul});
+    assert_valid(get, "--shard 3/16", std::pair{2ul, 16ul});
+    assert_valid(get, "--shard=4/4 --shard 4/4", std::pair{3ul, 4ul});
+
+    assert_invalid("--shard=0/4", "Invalid argument");
+    assert_invalid("--shard=5/4", "Invalid argument");
+    assert_invalid("--shard=1/0", "Invalid argument");
+    assert_invalid("--shard=2", "Invalid argument");
+    assert_invalid("--shard=a/b", "Invalid argument");
+    assert_invalid("--shard=1/2 --shard=2/2", "Contradicting arguments");
+    assert_invalid("--shard=", "Missing mandatory details");
+    assert_invalid("--shard", "Missing mandatory details");
 }
 
 void report()
@@ -194,6 +329,130 @@ void report()
     assert_invalid("--report ", "Invalid argument");
 }
 
+void history()
+{
+    auto const get = [](Configuration const & cfg) { return cfg.m_history_path; };
+    assert_valid(get, "", "");
+    assert_valid(get, "--history a.txt", "a.txt");
+    assert_valid(get, "--history=b.txt", "b.txt");
+    assert_valid(get, "--history=c.txt --history c.txt", "c.txt");
+
+    assert_invalid("--history=", "Missing mandatory details");
+    assert_invalid("--history", "Missing mandatory details");
+    assert_invalid("--history d.txt --history=e.txt", "Contradicting arguments");
+    assert_invalid("--history ", "Invalid argument");
+}
+
+void order()
+{
+    using O = ct::execute::OrderingMode;
+    auto const get = [](Configuration const & cfg) { return cfg.m_ordering; };
+    assert_valid(get, "", O::duration);
+    assert_valid(get, "--order=duration", O::duration);
+    assert_valid(get, "--order risk --history=a.txt", O::risk);
+    assert_valid(get, "--history=a.txt --order=risk --order=risk", O::risk);
+
+    assert_invalid("--order=random", "Invalid argument");
+    assert_invalid("--order=risk", "Missing mandatory details");
+    assert_invalid("--history=a.txt --order=risk --order=duration", "Contradicting arguments");
+    assert_invalid("--order", "Missing mandatory details");
+}
+
+void failures()
+{
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_failures_path, cfg.m_rerun_failed}; };
+    assert_valid(get, "", std::pair{Configuration{}.m_failures_path, Configuration{}.m_rerun_failed});
+    assert_valid(get, "--failures=a.txt", std::pair{std::filesystem::path{"a.txt"}, false});
+    assert_valid(get, "--rerun-failed --failures a.txt", std::pair{std::filesystem::path{"a.txt"}, true});
+    assert_valid(get, "--failures=a.txt --rerun-failed --rerun-failed", std::pair{std::filesystem::path{"a.txt"}, true});
+
+    assert_invalid("--rerun-failed", "Missing mandatory details");
+    assert_invalid("--failures", "Missing mandatory details");
+    assert_invalid("--failures=a.txt --failures=b.txt", "Contradicting arguments");
+    assert_invalid("--rerun-failed=yes --failures=a.txt", "Invalid argument");
+}
+
+void cache()
+{
+    auto const get = [](Configuration const & cfg) { return cfg.m_cache_path; };
+    assert_valid(get, "", Configuration{}.m_cache_path);
+    assert_valid(get, "--cache=a/b.txt", std::filesystem::path{"a/b.txt"});
+    assert_valid(get, "--cache a --cache=a", std::filesystem::path{"a"});
+
+    assert_invalid("--cache", "Missing mandatory details");
+    assert_invalid("--cache=a --cache=b", "Contradicting arguments");
+}
+
+void journal()
+{
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_journal_path, cfg.m_resume}; };
+    assert_valid(get, "", std::pair{Configuration{}.m_journal_path, Configuration{}.m_resume});
+    assert_valid(get, "--journal=a.bin", std::pair{std::filesystem::path{"a.bin"}, false});
+    assert_valid(get, "--resume --journal a.bin", std::pair{std::filesystem::path{"a.bin"}, true});
+    assert_valid(get, "--journal=a.bin --resume --resume", std::pair{std::filesystem::path{"a.bin"}, true});
+
+    assert_invalid("--resume", "Missing mandatory details");
+    assert_invalid("--journal", "Missing mandatory details");
+    assert_invalid("--journal=a.bin --journal=b.bin", "Contradicting arguments");
+    assert_invalid("--resume=yes --journal=a.bin", "Invalid argument");
+}
+
+void bisect_pollution()
+{
+    using O = ct::execute::OperationMode;
+    using namespace std::string_literals;
+    auto const get = [](Configuration const & cfg) { return std::pair{cfg.m_operation, cfg.m_pollution_victim}; };
+    assert_valid(get, "--bisect-pollution=a/b --journal=a.bin", std::pair{O::bisect, "a/b"s});
+    assert_valid(get, "--journal a.bin --bisect-pollution c", std::pair{O::bisect, "c"s});
+    assert_valid(get, "--bisect-pollution=c --journal a.bin --bisect-pollution c", std::pair{O::bisect, "c"s});
+
+    assert_invalid("--bisect-pollution=a", "Missing mandatory details");
+    assert_invalid("--bisect-pollution", "Missing mandatory details");
+    assert_invalid("--bisect-pollution=a --bisect-pollution=b --journal=a.bin", "Contradicting arguments");
+    assert_invalid("--list --bisect-pollution=a --journal=a.bin", "Contradicting arguments");
+    assert_invalid("--bisect-pollution=a -h --journal=a.bin", "Contradicting arguments");
+}
+
+void distribution()
+{
+    using O = ct::execute::OperationMode;
+    using namespace std::string_literals;
+    auto const coordinate = [](Configuration const & cfg) { return std::pair{cfg.m_operation, cfg.m_coordination}; };
+    assert_valid(coordinate, "", std::pair{O::run, ""s});
+    assert_valid(coordinate, "--coordinate=unix:/tmp/a.sock", std::pair{O::run, "unix:/tmp/a.sock"s});
+    assert_valid(coordinate, "--coordinate tcp:localhost:4711", std::pair{O::run, "tcp:localhost:4711"s});
+    assert_valid(coordinate, "--coordinate=tcp:[::1]:80 --coordinate tcp:[::1]:80", std::pair{O::run, "tcp:[::1]:80"s});
+
+    auto const work = [](Configuration const & cfg) { return std::pair{cfg.m_operation, cfg.m_coordinator}; };
+    assert_valid(work, "--work-for=unix:a.sock", std::pair{O::work, "unix:a.sock"s});
+    assert_valid(work, "--work-for tcp:10.0.0.1:4711 -b", std::pair{O::work, "tcp:10.0.0.1:4711"s});
+
+    assert_invalid("--coordinate=a.sock", "Invalid argument");
+    assert_invalid("--coordinate=unix:", "Invalid argument");
+    assert_invalid("--coordinate=tcp:localhost", "Invalid argument");
+    assert_invalid("--coordinate=tcp:localhost:http", "Invalid argument");
+    assert_invalid("--coordinate=tcp::4711", "Invalid argument");
+    assert_invalid("--work-for", "Missing mandatory details");
+    assert_invalid("--coordinate=unix:a --coordinate=unix:b", "Contradicting arguments");
+    assert_invalid("--work-for=unix:a --work-for=unix:b", "Contradicting arguments");
+    assert_invalid("--work-for=unix:a --list", "Contradicting arguments");
+    assert_invalid("--work-for=unix:a --coordinate=unix:a", "Contradicting arguments");
+}
+
+void format()
+{
+    using L = ct::execute::ListingFormat;
+    auto const get = [](Configuration const & cfg) { return cfg.m_listing; };
+    assert_valid(get, "", L::tree);
+    assert_valid(get, "--list --format=names", L::names);
+    assert_valid(get, "--format tree -l", L::tree);
+    assert_valid(get, "--format=names --format names", L::names);
+
+    assert_invalid("--format=json", "Invalid argument");
+    assert_invalid("--format=tree --format=names", "Contradicting arguments");
+    assert_invalid("--format", "Missing mandatory details");
+}
+
 void depth()
 {
     auto const get = [](Configuration const & cfg) { return cfg.m_depth; };
@@ -236,9 +495,25 @@ int main()
     color();
     filter();
     buffering();
+    isolation();
+    pinning();
+    jobserver();
     threads();
+    timeout();
+    fail_fast();
+    repeat();
+    retries();
+    shard();
     report();
+    history();
+    order();
+    failures();
+    cache();
+    journal();
+    bisect_pollution();
+    distribution();
     depth();
+    format();
 
     combined_short_knobs();
 }
@@ -0,0 +1,127 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/framework.h>
+
+#include <chrono>
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+void interleaving()
+{
+    constexpr auto num_cases = 40ul;
+    for (auto i = 0ul; i < num_cases; ++i) {
+        ct::Test{"sleeping" / ct::framework::Name{std::to_string(i)}, [i]() -> ct::Task {
+            // Every test-case observes a different number of expectations around its suspension points.
+            for (auto n = 0ul; n <= i % 4ul; ++n) {
+                ct::expect(true);
+                co_await ct::sleep_for(50ms);
+            }
+            ct::expect(true);
+        }};
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    auto const outcome = run([](Conductor::Setup &) {});
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    // Sequential execution would take at least 5s.
+    ct::utils::dynamic_assert(elapsed < 2s);
+    ct::utils::dynamic_assert(outcome.m_results.size() == num_cases);
+    for (auto i = 0ul; i < num_cases; ++i) {
+        auto const & result = find(outcome, "sleeping/" + std::to_string(i));
+        ct::utils::dynamic_assert(result.m_status == CaseStatus::pass);
+        ct::utils::dynamic_assert(result.m_observations.size() == i % 4ul + 2ul);
+        ct::utils::dynamic_assert(result.m_wall_time >= (i % 4ul + 1ul) * 50ms);
+    }
+}
+
+/// Write @p data into @p file_descriptor after a short delay.
+ct::Task delayed_write(int const file_descriptor, std::string const data)
+{
+    co_await ct::sleep_for(20ms);
+    co_await ct::writable(file_descriptor);
+    ct::expect(::write(file_descriptor, data.data(), data.size()) == static_cast<::ssize_t>(data.size()));
+}
+
+void pipes(IsolationMode const isolation)
+{
+    "pipe"_test = [](ct::Observer & observer) -> ct::Task {
+        int ends[2];
+        ct::expect(observer, ::pipe(ends) == 0);
+        co_await delayed_write(ends[1], "hello");
+        co_await ct::readable(ends[0]);
+        auto buffer = std::string(5ul, '\0');
+        ct::expect(observer, ::read(ends[0], buffer.data(), buffer.size()) == 5);
+        ct::expect(observer, buffer == "hello");
+        ::close(ends[0]);
+        ::close(ends[1]);
+    };
+    std::vector{1, 2, 3} | "data"_test = [](int const i) -> ct::Task {
+        co_await ct::sleep_for(std::chrono::milliseconds{i});
+        ct::expect(i > 0);
+    };
+
+    auto const outcome = run([isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 2ul;
+        setup.m_isolation = isolation;
+    });
+    ct::utils::dynamic_assert(outcome.m_results.size() == 4ul);
+    for (auto const & result : outcome.m_results) {
+        ct::utils::dynamic_assert(result.m_status == CaseStatus::pass);
+        ct::utils::dynamic_assert(not result.m_observations.empty());
+    }
+    ct::utils::dynamic_assert(find(outcome, "pipe").m_observations.size() == 4ul);
+}
+
+void failures(CaseResult::Duration const timeout)
+{
+    "throwing"_test = []() -> ct::Task {
+        co_await ct::sleep_for(1ms);
+        throw std::runtime_error{"failure after suspension"};
+    };
+    "failing"_test = []() -> ct::Task {
+        co_await ct::sleep_for(1ms);
+        ct::expect(false);
+    };
+    "stuck"_test = []() -> ct::Task { co_await std::suspend_always{}; };
+    "regular"_test = [] { ct::expect(true); };
+
+    auto const outcome = run([timeout](Conductor::Setup & setup) { setup.m_timeout = timeout; });
+    ct::utils::dynamic_assert(find(outcome, "throwing").m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(find(outcome, "failing").m_status == CaseStatus::fail);
+    ct::utils::dynamic_assert(find(outcome, "stuck").m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(find(outcome, "regular").m_status == CaseStatus::pass);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::interleaving();
+    ct::execute::pipes(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::pipes(IsolationMode::process);
+    }
+    ct::execute::failures({});
+    ct::execute::failures(10s); // supervised workers run coroutines to completion (without interleaving).
+}
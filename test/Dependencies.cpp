@@ -0,0 +1,175 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/Dependencies.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+void tags()
+{
+    ct::utils::dynamic_assert(prerequisites(framework::Name{"a"}).empty());
+    ct::utils::dynamic_assert(prerequisites("a" / "after:"_tag / "afterwards"_tag).empty());
+    auto const paths = prerequisites("a" / "after:b"_tag / "x"_tag / "after:c/d"_tag);
+    ct::utils::dynamic_assert(paths == std::vector<std::string_view>{"b", "c/d"});
+}
+
+void graph()
+{
+    auto const noop = [] {};
+    ct::Test{"load", noop};
+    ct::Test{"load/more" / "after:load"_tag, noop};
+    ct::Test{"loader" / "after:load"_tag, noop};
+    ct::Suite{"stage" / "after:loader"_tag / "after:stage"_tag, [&noop] {
+                  "a"_test = noop;
+                  "b"_test = noop;
+              }};
+    ct::Test{"cycle/x" / "after:cycle/y"_tag, noop};
+    ct::Test{"cycle/y" / "after:cycle/x"_tag, noop};
+    ct::Test{"cycle/z" / "after:cycle/x"_tag, noop};
+    ct::Test{"missing" / "after:nothing"_tag / "after:load"_tag, noop};
+    auto const cases = std::exchange(framework::registry(), {});
+
+    auto const dependencies = DependencyGraph{cases};
+    ct::utils::dynamic_assert(not dependencies.empty());
+    ct::utils::dynamic_assert(dependencies.prerequisites(0ul).empty());
+    ct::utils::dynamic_assert(dependencies.prerequisites(1ul) == std::vector<std::size_t>{0ul});
+    // Both the test-case and the test-suite "load" (but not itself, since it merely shares the prefix).
+    ct::utils::dynamic_assert(dependencies.prerequisites(2ul) == std::vector<std::size_t>{0ul, 1ul});
+    // Dependency on the own test-suite: all other test-cases therein.
+    ct::utils::dynamic_assert(dependencies.prerequisites(3ul) == std::vector<std::size_t>{2ul, 4ul});
+    ct::utils::dynamic_assert(dependencies.prerequisites(4ul) == std::vector<std::size_t>{2ul, 3ul});
+
+    ct::utils::dynamic_assert(dependencies.cyclic() == std::vector<std::size_t>{3ul, 4ul, 5ul, 6ul, 7ul});
+    ct::utils::dynamic_assert(dependencies.unresolved().size() == 1ul);
+    ct::utils::dynamic_assert(dependencies.unresolved()[0ul].m_case == 8ul);
+    ct::utils::dynamic_assert(dependencies.unresolved()[0ul].m_path == "nothing");
+    for (auto i = 0ul; i < cases.size(); ++i) {
+        ct::utils::dynamic_assert(dependencies.satisfiable(i) == (i < 3ul));
+    }
+
+    ct::utils::dynamic_assert(DependencyGraph{}.empty());
+}
+
+std::atomic<bool> loaded = false; //!< whether the test-case "load" finished.
+std::atomic<std::size_t> num_queries = 0ul; //!< number of finished test-cases "query".
+std::size_t expected_queries = 0ul; //!< number of test-cases "query" to be finished before the "report".
+std::atomic<std::size_t> num_concurrent = 0ul; //!< number of currently running test-cases "query".
+std::atomic<std::size_t> peak_concurrent = 0ul; //!< maximum of @c num_concurrent.
+bool isolated = false; //!< whether the above are observed (from worker processes) in vain.
+
+void register_cases(std::size_t const repetitions, IsolationMode const isolation)
+{
+    isolated = (isolation != IsolationMode::off);
+    expected_queries = 20ul * repetitions;
+    loaded = false;
+    num_queries = 0ul;
+    peak_concurrent = 0ul;
+
+    // Registered (and thus planned) after their dependents.
+    for (auto i = 0; i < 20; ++i) {
+        ct::Test{("query/" + std::to_string(i)) / "after:load"_tag, [] {
+                     auto const current = ++num_concurrent;
+                     auto previous = peak_concurrent.load();
+                     while (previous < current and not peak_concurrent.compare_exchange_weak(previous, current)) {
+                     }
+                     ct::expect(isolated or loaded.load());
+                     std::this_thread::sleep_for(5ms);
+                     --num_concurrent;
+                     ++num_queries;
+                 }};
+    }
+    ct::Suite{"report" / "after:query"_tag, [] {
+                  "summary"_test = [] { ct::expect(isolated or num_queries == expected_queries); };
+              }};
+    "load"_test = [] {
+        std::this_thread::sleep_for(20ms);
+        loaded = true;
+    };
+
+    "broken"_test = [] { ct::expect(false); };
+    ct::Test{"dependent" / "after:broken"_tag, [] {}};
+    ct::Test{"transitive" / "after:dependent"_tag / "after:load"_tag, [] {}};
+    ct::Test{"typo" / "after:lod"_tag, [] {}};
+}
+
+void execution(IsolationMode const isolation)
+{
+    register_cases(1ul, isolation);
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 4ul;
+        setup.m_isolation = isolation;
+    });
+
+    ct::utils::dynamic_assert(outcome.m_results.size() == 26ul);
+    ct::utils::dynamic_assert(find(outcome, "load").m_status == CaseStatus::pass);
+    for (auto i = 0; i < 20; ++i) {
+        ct::utils::dynamic_assert(find(outcome, "query/" + std::to_string(i)).m_status == CaseStatus::pass);
+    }
+    ct::utils::dynamic_assert(find(outcome, "report/summary").m_status == CaseStatus::pass);
+
+    // Dependents of failed test-cases are skipped (transitively).
+    ct::utils::dynamic_assert(find(outcome, "broken").m_status == CaseStatus::fail);
+    ct::utils::dynamic_assert(find(outcome, "dependent").m_status == CaseStatus::skip);
+    ct::utils::dynamic_assert(find(outcome, "transitive").m_status == CaseStatus::skip);
+    ct::utils::dynamic_assert(find(outcome, "typo").m_status == CaseStatus::skip);
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "   - typo (no test-case lod)"));
+    if (isolation == IsolationMode::off) {
+        // Worker processes have separate counters (thus only in-process execution can be observed).
+        ct::utils::dynamic_assert(peak_concurrent > 1ul);
+    }
+}
+
+void repeated()
+{
+    register_cases(3ul, IsolationMode::off);
+    auto const outcome = run([](Conductor::Setup & setup) {
+        setup.m_num_workers = 4ul;
+        setup.m_repetitions = 3ul;
+    });
+
+    // Dependents wait for all copies of their dependencies.
+    ct::utils::dynamic_assert(find(outcome, "report/summary").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(num_queries == 60ul);
+    ct::utils::dynamic_assert(find(outcome, "dependent").m_status == CaseStatus::skip);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::tags();
+    ct::execute::graph();
+    ct::execute::execution(IsolationMode::off);
+    ct::execute::repeated();
+    if (ct::execute::supports_isolation()) {
+        ct::execute::execution(IsolationMode::process);
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/Distribution.h>
+#include <execute/Endpoint.h>
+#include <execute/JUnitExport.h>
+#include <execute/NameFilter.h>
+#include <execute/Serialization.h>
+
+#include <clean-test/clean-test.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+void endpoints()
+{
+    for (auto const * valid : {"unix:/tmp/a.sock", "unix:a", "tcp:localhost:4711", "tcp:10.0.0.1:0", "tcp:[::1]:80"}) {
+        auto const endpoint = Endpoint::parse(valid);
+        ct::utils::dynamic_assert(endpoint and endpoint->address() == valid);
+    }
+    for (auto const * invalid : {"", "a.sock", "unix:", "tcp:localhost", "tcp::80", "tcp:host:", "tcp:host:123456"}) {
+        ct::utils::dynamic_assert(not Endpoint::parse(invalid));
+    }
+}
+
+void register_cases()
+{
+    "vanishing"_test = [] { ::_exit(EXIT_FAILURE); }; // takes down its worker (before the rest of its batch)
+    for (auto i = 0; i < 20; ++i) {
+        ct::Test{"remote/" + std::to_string(i), [i] { ct::expect(i % 7 != 3); }};
+    }
+}
+
+/// Fork @p num_workers worker processes executing the registered test-cases for the coordinator at @p endpoint.
+std::vector<::pid_t> start_workers(Endpoint const & endpoint, std::size_t const num_workers)
+{
+    auto result = std::vector<::pid_t>{};
+    for (auto w = 0ul; w < num_workers; ++w) {
+        if (auto const pid = ::fork(); pid == 0) {
+            try {
+                static_cast<void>(work_for(endpoint, framework::registry(), coloring_setup(ColoringMode::disabled)));
+                ::_exit(EXIT_SUCCESS);
+            } catch (...) {
+                ::_exit(EXIT_FAILURE); // e.g. started too late: the coordinator is gone already
+            }
+        } else {
+            ct::utils::dynamic_assert(pid > 0);
+            result.emplace_back(pid);
+        }
+    }
+    return result;
+}
+
+/// Fork a process connecting to the coordinator at @p endpoint which sends @p data (rather than acting as a worker)
+/// and waits for the coordinator to hang up.
+::pid_t start_intruder(Endpoint const & endpoint, std::string const & data)
+{
+    auto const pid = ::fork();
+    if (pid == 0) {
+        try {
+            auto const fd = endpoint.connect(std::chrono::seconds{10});
+            static_cast<void>(::write(fd, data.data(), data.size()));
+            auto ignored = char{};
+            while (::read(fd, &ignored, 1ul) > 0) {
+            }
+        } catch (...) {
+            // e.g. started too late: the coordinator is gone already
+        }
+        ::_exit(EXIT_SUCCESS);
+    }
+    ct::utils::dynamic_assert(pid > 0);
+    return pid;
+}
+
+/// Fork processes connecting to the coordinator at @p endpoint without being workers of this build.
+std::vector<::pid_t> start_intruders(Endpoint const & endpoint)
+{
+    auto foreign = std::string{};
+    encode_text(foreign, greeting("another build"));
+
+    auto oversized = std::string{};
+    encode_integer(oversized, ~std::uint64_t{0u});
+
+    auto incomplete = std::string{};
+    encode_integer(incomplete, 100u);
+    incomplete += "truncated";
+
+    // A probe (sending nothing), a worker of another build, a corrupt frame and a frame which never completes.
+    auto result = std::vector<::pid_t>{};
+    for (auto const & data : {std::string{}, foreign, oversized, incomplete}) {
+        result.emplace_back(start_intruder(endpoint, data));
+    }
+    return result;
+}
+
+void distributing(std::filesystem::path const & path)
+{
+    register_cases();
+    auto const endpoint = *Endpoint::parse("unix:" + path.string());
+    auto const intruders = start_intruders(endpoint);
+    auto const workers = start_workers(endpoint, 3ul);
+
+    auto logger = std::ostringstream{};
+    auto report = std::ostringstream{};
+    auto junit = JUnitStream{report};
+    auto const filter = NameFilter{};
+    auto const outcome = Conductor{{
+                                       .m_logger = logger,
+                                       .m_colors = coloring_setup(ColoringMode::disabled),
+                                       .m_num_workers = 1ul,
+                                       .m_buffering = BufferingMode::testcase,
+                                       .m_filter = filter,
+                                       .m_coordination = &endpoint,
+                                       .m_sinks = {&junit}}}
+                             .run();
+
+    // Some worker took over the test-cases handed out to the vanished one and finished once all were done.
+    auto num_succeeded = 0ul;
+    for (auto const pid : workers) {
+        auto status = 0;
+        ct::utils::dynamic_assert(::waitpid(pid, &status, 0) == pid);
+        num_succeeded += (WIFEXITED(status) and WEXITSTATUS(status) == EXIT_SUCCESS);
+    }
+    ct::utils::dynamic_assert(num_succeeded >= 1ul);
+    for (auto const pid : intruders) {
+        ct::utils::dynamic_assert(::waitpid(pid, nullptr, 0) == pid);
+    }
+    ct::utils::dynamic_assert(not std::filesystem::exists(path));
+
+    // All results are merged, even those handed out to the vanished worker (apart from the one it vanished in).
+    ct::utils::dynamic_assert(outcome.m_results.size() == 21ul);
+    for (auto const & result : outcome.m_results) {
+        ct::utils::dynamic_assert(result.m_worker.has_value());
+        auto const expected = (result.m_name_path == "vanishing") ? CaseStatus::abort
+                              : (result.m_name_path == "remote/3" or result.m_name_path == "remote/10"
+                                 or result.m_name_path == "remote/17")
+                                  ? CaseStatus::fail
+                                  : CaseStatus::pass;
+        ct::utils::dynamic_assert(result.m_status == expected);
+    }
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "Coordinating workers on unix:"));
+    ct::utils::dynamic_assert(contains(console, "disconnected while evaluating the test-case."));
+    auto const xml = std::move(report).str();
+    ct::utils::dynamic_assert(contains(xml, R"(tests="21")"));
+    for (auto i = 0; i < 20; ++i) {
+        ct::utils::dynamic_assert(contains(xml, "name=\"remote/" + std::to_string(i) + '"'));
+    }
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::endpoints();
+    if (ct::execute::supports_distribution()) {
+        auto const path = std::filesystem::temp_directory_path()
+                          / ("clean-test-distribution-" + std::to_string(::getpid()) + ".sock");
+        ct::execute::distributing(path);
+    }
+}
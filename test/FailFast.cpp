@@ -0,0 +1,111 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/framework.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+std::size_t count(Outcome const & outcome, CaseStatus const status)
+{
+    auto result = 0ul;
+    for (auto const & r : outcome.m_results) {
+        result += (r.m_status == status);
+    }
+    return result;
+}
+
+void skip_unstarted(IsolationMode const isolation)
+{
+    "good"_test = [] { ct::expect(true); };
+    "bad/0"_test = [] { ct::expect(false); };
+    "bad/1"_test = [] { ct::expect(false); };
+    "bad/2"_test = [] { ct::expect(false); };
+    for (auto i = 0; i < 10; ++i) {
+        ct::Test{"later" / ct::framework::Name{std::to_string(i)}, [] { ct::expect(true); }};
+    }
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_isolation = isolation;
+        setup.m_max_failures = 2ul;
+    });
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(outcome.m_results.size() == 14ul);
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::pass) == 1ul);
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::fail) == 2ul);
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::skip) == 11ul);
+    ct::utils::dynamic_assert(contains(console, "Cancelled after 2 failing test-cases"));
+    ct::utils::dynamic_assert(ct::cancellation_requested()); // until the next execution
+}
+
+void cooperative(IsolationMode const isolation)
+{
+    "bad"_test = [] {
+        std::this_thread::sleep_for(10ms);
+        ct::expect(false);
+    };
+    "polling"_test = [] {
+        auto const deadline = std::chrono::steady_clock::now() + 30s;
+        while (not ct::cancellation_requested() and std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+        ct::expect(ct::cancellation_requested());
+    };
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 2ul;
+        setup.m_isolation = isolation;
+        setup.m_max_failures = 1ul;
+    });
+    ct::utils::dynamic_assert(outcome.m_results.size() == 2ul);
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::pass) == 1ul);
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::fail) == 1ul);
+}
+
+void disabled()
+{
+    "bad/0"_test = [] { ct::expect(false); };
+    "bad/1"_test = [] { ct::expect(false); };
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [](Conductor::Setup &) {});
+    ct::utils::dynamic_assert(count(outcome, CaseStatus::fail) == 2ul);
+    ct::utils::dynamic_assert(not contains(std::move(logger).str(), "Cancelled"));
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::skip_unstarted(IsolationMode::off);
+    ct::execute::cooperative(IsolationMode::off);
+    ct::execute::disabled();
+    if (ct::execute::supports_isolation()) {
+        ct::execute::skip_unstarted(IsolationMode::process);
+        ct::execute::cooperative(IsolationMode::process);
+    }
+}
@@ -0,0 +1,127 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Configuration.h>
+#include <execute/FailureSet.h>
+#include <execute/Main.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+namespace ct = clean_test;
+using FailureSet = ct::execute::FailureSet;
+using Result = ct::execute::CaseResult;
+using Status = ct::execute::CaseStatus;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+FailureSet parse(std::string const & serialized)
+{
+    auto in = std::istringstream{serialized};
+    auto result = FailureSet{};
+    in >> result;
+    return result;
+}
+
+void load()
+{
+    auto const f = parse("a/b\n\nc d\na/b\n");
+    ct::utils::dynamic_assert(f.size() == 2ul);
+    ct::utils::dynamic_assert(f.contains("a/b"));
+    ct::utils::dynamic_assert(f.contains("c d"));
+    ct::utils::dynamic_assert(not f.contains("a"));
+}
+
+void update()
+{
+    auto f = parse("kept\nfixed\nskipped\n");
+    f.update(Result{"fixed", Status::pass, 5ms, {}});
+    f.update(Result{"skipped", Status::skip, 0ms, {}});
+    f.update(Result{"broken", Status::fail, 1ms, {}});
+    f.update(Result{"crashed", Status::abort, 1ms, {}});
+    f.update(Result{"unknown", Status::fail, 0ms, {}, Result::Type::fallback});
+
+    ct::utils::dynamic_assert(f.size() == 4ul);
+    ct::utils::dynamic_assert(f.contains("kept"));
+    ct::utils::dynamic_assert(not f.contains("fixed"));
+    ct::utils::dynamic_assert(f.contains("skipped"));
+    ct::utils::dynamic_assert(f.contains("broken"));
+    ct::utils::dynamic_assert(f.contains("crashed"));
+
+    // Serialization round-trip
+    auto out = std::ostringstream{};
+    out << f;
+    auto const reloaded = parse(std::move(out).str());
+    ct::utils::dynamic_assert(reloaded.names() == f.names());
+}
+
+std::atomic<int> num_executed = 0; //!< number of executed test-cases.
+std::atomic<bool> fixed = false; //!< whether the test-case "flipping" passes.
+
+void register_cases()
+{
+    for (auto i = 0; i < 100; ++i) {
+        ct::Test{"good" / ct::framework::Name{std::to_string(i)}, [] {
+            ++num_executed;
+            ct::expect(true);
+        }};
+    }
+    "flipping"_test = [] {
+        ++num_executed;
+        ct::expect(fixed.load());
+    };
+}
+
+void rerun()
+{
+    auto const path = std::filesystem::temp_directory_path() / "clean-test-failure-set.txt";
+    std::filesystem::remove(path);
+
+    auto logger = std::ostringstream{};
+    auto cfg = ct::execute::Configuration{};
+    cfg.m_logger = &logger;
+    cfg.m_coloring = ct::execute::ColoringMode::disabled;
+    cfg.m_failures_path = path;
+
+    // Initial execution records the failure.
+    register_cases();
+    ct::utils::dynamic_assert(ct::execute::main(cfg) == 1);
+    ct::utils::dynamic_assert(num_executed == 101);
+    {
+        auto in = std::ifstream{path};
+        auto recorded = FailureSet{};
+        in >> recorded;
+        ct::utils::dynamic_assert(recorded.size() == 1ul);
+        ct::utils::dynamic_assert(recorded.contains("flipping"));
+    }
+
+    // Re-running only executes the failed test-case; fixing it clears the record.
+    cfg.m_rerun_failed = true;
+    num_executed = 0;
+    fixed = true;
+    register_cases();
+    ct::utils::dynamic_assert(ct::execute::main(cfg) == 0);
+    ct::utils::dynamic_assert(num_executed == 1);
+    ct::utils::dynamic_assert(std::filesystem::file_size(path) == 0u);
+
+    std::filesystem::remove(path);
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    load();
+    update();
+    rerun();
+}
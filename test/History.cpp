@@ -0,0 +1,99 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/History.h>
+
+#include <chrono>
+#include <sstream>
+
+namespace {
+
+namespace ct = clean_test;
+using History = ct::execute::History;
+using Result = ct::execute::CaseResult;
+using Status = ct::execute::CaseStatus;
+using namespace std::chrono_literals;
+
+History parse(std::string const & serialized)
+{
+    auto in = std::istringstream{serialized};
+    auto result = History{};
+    in >> result;
+    return result;
+}
+
+void load()
+{
+    auto const h = parse("1000\ta/b\n2000\tc d\ngarbage\n-5\tnegative\n3000\t\n");
+    ct::utils::dynamic_assert(h.size() == 2ul);
+    ct::utils::dynamic_assert(h.find("a/b")->m_wall_time == 1us);
+    ct::utils::dynamic_assert(h.find("c d")->m_wall_time == 2us);
+    ct::utils::dynamic_assert(h.find("garbage") == nullptr);
+}
+
+void update()
+{
+    auto h = parse("1000\tkept\n2000\tupdated\n3000\tskipped\n");
+    auto outcome = ct::execute::Outcome{};
+    outcome.m_results.emplace_back("updated", Status::fail, 5ms, Result::Observations{});
+    outcome.m_results.emplace_back("skipped", Status::skip, 0ms, Result::Observations{});
+    outcome.m_results.emplace_back("added", Status::pass, 7ms, Result::Observations{});
+    outcome.m_results.emplace_back("unknown", Status::pass, 0ms, Result::Observations{}, Result::Type::fallback);
+    h.update(outcome);
+
+    ct::utils::dynamic_assert(h.size() == 4ul);
+    ct::utils::dynamic_assert(h.find("kept")->m_wall_time == 1us);
+    ct::utils::dynamic_assert(h.find("updated")->m_wall_time == 5ms);
+    ct::utils::dynamic_assert(h.find("skipped")->m_wall_time == 3us);
+    ct::utils::dynamic_assert(h.find("added")->m_wall_time == 7ms);
+
+    // Serialization round-trip
+    auto out = std::ostringstream{};
+    out << h;
+    auto const reloaded = parse(std::move(out).str());
+    ct::utils::dynamic_assert(reloaded.size() == 4ul);
+    ct::utils::dynamic_assert(reloaded.find("added")->m_wall_time == 7ms);
+}
+
+void failures()
+{
+    auto h = parse("1000\t0\t0\tstable\n2000\t5\t1700000000\tflaky\n3000\told\n");
+    ct::utils::dynamic_assert(h.find("flaky")->num_recent_failures() == 2ul);
+    ct::utils::dynamic_assert(h.find("flaky")->m_last_failed == 1700000000);
+    ct::utils::dynamic_assert(h.find("old")->m_outcomes == 0u);
+
+    auto outcome = ct::execute::Outcome{};
+    outcome.m_results.emplace_back("stable", Status::fail, 1ms, Result::Observations{});
+    outcome.m_results.emplace_back("flaky", Status::pass, 2ms, Result::Observations{});
+    outcome.m_results.emplace_back("old", Status::pass, 3ms, Result::Observations{});
+    h.update(outcome);
+    ct::utils::dynamic_assert(h.find("stable")->m_outcomes == 1u);
+    ct::utils::dynamic_assert(h.find("stable")->m_last_failed > 1700000000);
+    ct::utils::dynamic_assert(h.find("flaky")->m_outcomes == 10u);
+    ct::utils::dynamic_assert(h.find("flaky")->m_last_failed == 1700000000);
+
+    // More recent failures rank higher, then later ones; unknown test-cases before those which never failed.
+    ct::utils::dynamic_assert(h.risk("flaky") > h.risk("stable"));
+    ct::utils::dynamic_assert(h.risk("stable") > h.risk("added"));
+    ct::utils::dynamic_assert(h.risk("added") > h.risk("old"));
+    ct::utils::dynamic_assert(h.risk("old") == 0u);
+
+    // Serialization round-trip
+    auto out = std::ostringstream{};
+    out << h;
+    auto const reloaded = parse(std::move(out).str());
+    ct::utils::dynamic_assert(reloaded.find("flaky")->m_outcomes == 10u);
+    ct::utils::dynamic_assert(reloaded.find("stable")->m_last_failed == h.find("stable")->m_last_failed);
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    load();
+    update();
+    failures();
+}
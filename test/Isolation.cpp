@@ -0,0 +1,120 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+#include <execute/Serialization.h>
+
+#include <clean-test/framework.h>
+
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+void serialization()
+{
+    auto original = CaseResult{
+        "a/b",
+        CaseStatus::fail,
+        std::chrono::milliseconds{42},
+        {Observation{{"file.cpp", 7u}, ObservationStatus::fail, "1 == 2", "details"}}};
+    original.m_stdout = "out\n";
+    original.m_stderr = std::string{"err\0binary", 10ul};
+
+    auto buffer = std::string{};
+    encode_result(buffer, original);
+    encode_integer(buffer, 17u);
+
+    auto data = std::string_view{buffer};
+    auto const restored = decode_result(data);
+    utils::dynamic_assert(restored.m_name_path == original.m_name_path);
+    utils::dynamic_assert(restored.m_status == original.m_status);
+    utils::dynamic_assert(restored.m_wall_time == original.m_wall_time);
+    utils::dynamic_assert(restored.m_type == original.m_type);
+    utils::dynamic_assert(restored.m_stdout == original.m_stdout);
+    utils::dynamic_assert(restored.m_stderr == original.m_stderr);
+    utils::dynamic_assert(restored.m_observations.size() == 1ul);
+    auto const & o = restored.m_observations.front();
+    utils::dynamic_assert(std::strcmp(o.m_where.file_name(), "file.cpp") == 0 and o.m_where.line() == 7u);
+    utils::dynamic_assert(o.m_status == ObservationStatus::fail);
+    utils::dynamic_assert(o.m_expression_details == "1 == 2" and o.m_description == "details");
+    utils::dynamic_assert(decode_integer(data) == 17u);
+    utils::dynamic_assert(data.empty());
+
+    // Truncated input is rejected.
+    auto truncated = std::string_view{buffer}.substr(0ul, buffer.size() / 2ul);
+    auto rejected = false;
+    try {
+        decode_result(truncated);
+    } catch (std::runtime_error const &) {
+        rejected = true;
+    }
+    utils::dynamic_assert(rejected);
+}
+
+void crash_resilience()
+{
+    if (not supports_isolation()) {
+        return;
+    }
+
+    "pass"_test = [] { ct::expect(true); };
+    "fail"_test = [] { ct::expect(false); };
+    "crash"_test = [] { std::raise(SIGSEGV); };
+    "chatty"_test = [] {
+        std::cout << "to stdout" << std::endl;
+        std::cerr << "to stderr" << std::endl;
+        ct::expect(false);
+    };
+    "after"_test = [] { ct::expect(true); };
+
+    auto buffer = std::ostringstream{};
+    auto const outcome = run(buffer, [](Conductor::Setup & setup) {
+        setup.m_num_workers = 2ul;
+        setup.m_isolation = IsolationMode::process;
+    });
+    auto const console = std::move(buffer).str();
+
+    utils::dynamic_assert(outcome.m_results.size() == 5ul);
+    utils::dynamic_assert(find(outcome, "pass").m_status == CaseStatus::pass);
+    utils::dynamic_assert(find(outcome, "fail").m_status == CaseStatus::fail);
+    utils::dynamic_assert(find(outcome, "after").m_status == CaseStatus::pass);
+
+    auto const & crash = find(outcome, "crash");
+    utils::dynamic_assert(crash.m_status == CaseStatus::abort);
+    utils::dynamic_assert(contains(crash.m_observations.front().m_expression_details, "signal"));
+
+    auto const & chatty = find(outcome, "chatty");
+    utils::dynamic_assert(chatty.m_status == CaseStatus::fail);
+    utils::dynamic_assert(chatty.m_stdout == "to stdout\n");
+    utils::dynamic_assert(chatty.m_stderr == "to stderr\n");
+
+    utils::dynamic_assert(contains(console, "[ RUN   ] crash"));
+    utils::dynamic_assert(contains(console, "[ ABORT ] crash"));
+    utils::dynamic_assert(contains(console, "[ PASS  ] after"));
+    utils::dynamic_assert(contains(console, "Captured stdout of chatty"));
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::serialization();
+    ct::execute::crash_resilience();
+}
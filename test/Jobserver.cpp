@@ -0,0 +1,170 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/Jobserver.h>
+#include <execute/NameFilter.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/framework.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+void parsing()
+{
+    ct::utils::dynamic_assert(not parse_jobserver_auth(""));
+    ct::utils::dynamic_assert(not parse_jobserver_auth("-j4 -k"));
+    ct::utils::dynamic_assert(
+        parse_jobserver_auth("-j4 --jobserver-auth=3,4") == JobserverAuth{.m_read = 3, .m_write = 4});
+    ct::utils::dynamic_assert(
+        parse_jobserver_auth(" -j --jobserver-fds=5,6") == JobserverAuth{.m_read = 5, .m_write = 6});
+    ct::utils::dynamic_assert(
+        parse_jobserver_auth("-j64 --jobserver-auth=fifo:/tmp/GMfifo42")
+        == JobserverAuth{.m_fifo = "/tmp/GMfifo42"});
+
+    // The last one wins.
+    ct::utils::dynamic_assert(
+        parse_jobserver_auth("--jobserver-auth=3,4 --jobserver-auth=fifo:/x") == JobserverAuth{.m_fifo = "/x"});
+
+    // Malformed
+    ct::utils::dynamic_assert(not parse_jobserver_auth("--jobserver-auth=3"));
+    ct::utils::dynamic_assert(not parse_jobserver_auth("--jobserver-auth=-1,4"));
+    ct::utils::dynamic_assert(not parse_jobserver_auth("--jobserver-auth=fifo:"));
+    ct::utils::dynamic_assert(not parse_jobserver_auth("--jobserver-auth=3,4 --jobserver-auth=x"));
+}
+
+/// Pipe filled with @p num_tokens (like the one of make).
+class TokenPipe {
+public:
+    explicit TokenPipe(std::size_t const num_tokens)
+    {
+        ct::utils::dynamic_assert(::pipe(m_ends) == 0);
+        for (auto i = 0ul; i < num_tokens; ++i) {
+            ct::utils::dynamic_assert(::write(m_ends[1], "+", 1ul) == 1);
+        }
+    }
+
+    ~TokenPipe()
+    {
+        ::close(m_ends[0]);
+        ::close(m_ends[1]);
+    }
+
+    JobserverAuth auth() const
+    {
+        return {.m_read = m_ends[0], .m_write = m_ends[1]};
+    }
+
+    /// Number of tokens currently available (i.e. not acquired by anyone).
+    std::size_t available() const
+    {
+        auto result = 0;
+        ct::utils::dynamic_assert(::ioctl(m_ends[0], FIONREAD, &result) == 0);
+        return static_cast<std::size_t>(result);
+    }
+
+private:
+    int m_ends[2];
+};
+
+void tokens()
+{
+    ct::utils::dynamic_assert(not Jobserver::connect({.m_read = 1000, .m_write = 1001}));
+    ct::utils::dynamic_assert(not Jobserver::connect({.m_fifo = "/nonexistent/fifo"}));
+
+    auto const pipe = TokenPipe{2ul};
+    {
+        auto jobserver = Jobserver::connect(pipe.auth());
+        ct::utils::dynamic_assert(jobserver != nullptr);
+        auto const first = jobserver->acquire(0ms);
+        auto const second = jobserver->acquire(10ms);
+        ct::utils::dynamic_assert(first == '+' and second == '+');
+        ct::utils::dynamic_assert(not jobserver->acquire(10ms));
+        ct::utils::dynamic_assert(pipe.available() == 0ul);
+
+        jobserver->release(*first);
+        ct::utils::dynamic_assert(pipe.available() == 1ul);
+    }
+    // Outstanding tokens are returned on destruction.
+    ct::utils::dynamic_assert(pipe.available() == 2ul);
+}
+
+std::atomic<std::size_t> num_running = 0ul;
+std::atomic<std::size_t> max_running = 0ul; //!< maximum number of concurrently running test-cases.
+
+void register_cases()
+{
+    num_running = 0ul;
+    max_running = 0ul;
+    for (auto i = 0; i < 12; ++i) {
+        ct::Test{"limited" / ct::framework::Name{std::to_string(i)}, [] {
+            auto const running = ++num_running;
+            auto previous = max_running.load();
+            while (previous < running and not max_running.compare_exchange_weak(previous, running)) {
+            }
+            std::this_thread::sleep_for(20ms);
+            --num_running;
+            ct::expect(true);
+        }};
+    }
+}
+
+void bounded(IsolationMode const isolation)
+{
+    // One token in the pipe plus the implicit one: at most two test-cases run concurrently.
+    auto const pipe = TokenPipe{1ul};
+    auto jobserver = Jobserver::connect(pipe.auth());
+    register_cases();
+    auto const filter = NameFilter{};
+    auto logger = std::ostringstream{};
+    auto const outcome = Conductor{{
+        .m_logger = logger,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 6ul,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter,
+        .m_isolation = isolation,
+        .m_jobserver = jobserver.get()}}.run();
+
+    ct::utils::dynamic_assert(outcome.m_results.size() == 12ul);
+    ct::utils::dynamic_assert(std::all_of(outcome.m_results.cbegin(), outcome.m_results.cend(), [](auto const & r) {
+        return r.m_status == CaseStatus::pass;
+    }));
+    if (isolation == IsolationMode::off) {
+        // Worker processes have separate counters.
+        ct::utils::dynamic_assert(max_running <= 2ul);
+    }
+    ct::utils::dynamic_assert(pipe.available() == 1ul);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::parsing();
+    ct::execute::tokens();
+    ct::execute::bounded(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::bounded(IsolationMode::process);
+    }
+}
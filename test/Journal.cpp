@@ -0,0 +1,188 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/Journal.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/clean-test.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+Resumption load(std::filesystem::path const & path)
+{
+    auto result = Resumption{};
+    auto in = std::ifstream{path, std::ios::binary};
+    in >> result;
+    return result;
+}
+
+CaseResult make_result(std::string name, CaseStatus const status)
+{
+    auto observations = CaseResult::Observations{
+        Observation{{"a.cpp", 1u}, ObservationStatus::pass, "fine", {}},
+        Observation{{"a.cpp", 2u}, ObservationStatus::fail, "broken", {}}};
+    return CaseResult{std::move(name), status, std::chrono::milliseconds{3}, std::move(observations)};
+}
+
+void journaling(std::filesystem::path const & path)
+{
+    {
+        auto journal = Journal{path, false};
+        journal.on_case_start("done");
+        journal.on_case_start("skipped");
+        journal.on_case_start("running");
+        journal.on_result(make_result("done", CaseStatus::fail));
+        journal.on_result(CaseResult{"skipped", CaseStatus::skip, CaseResult::Duration{}, {}});
+    }
+    auto const resumption = load(path);
+    ct::utils::dynamic_assert(resumption.num_completed() == 1ul);
+    ct::utils::dynamic_assert(resumption.num_interrupted() == 1ul);
+
+    // Completed results are compacted (without passed observations).
+    auto const done = resumption.lookup(framework::Name{"done"});
+    ct::utils::dynamic_assert(done and done->m_status == CaseStatus::fail);
+    ct::utils::dynamic_assert(done->m_wall_time == std::chrono::milliseconds{3});
+    ct::utils::dynamic_assert(done->m_observations.size() == 1ul);
+    ct::utils::dynamic_assert(done->m_observations.front().m_expression_details == "broken");
+
+    // Interrupted test-cases are aborted; skipped (and unknown) ones must be executed.
+    auto const running = resumption.lookup(framework::Name{"running"});
+    ct::utils::dynamic_assert(running and running->m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(not resumption.lookup(framework::Name{"skipped"}));
+    ct::utils::dynamic_assert(not resumption.lookup(framework::Name{"unknown"}));
+
+    // A truncated record (of a crash while writing) is ignored, just as the one of the appended result.
+    {
+        auto journal = Journal{path, true};
+        journal.on_result(make_result("running", CaseStatus::pass));
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1u);
+    auto const truncated = load(path);
+    ct::utils::dynamic_assert(truncated.num_completed() == 1ul);
+    ct::utils::dynamic_assert(truncated.num_interrupted() == 1ul);
+}
+
+std::atomic<std::size_t> num_executions = 0ul; //!< number of executed test-cases.
+
+void register_cases()
+{
+    num_executions = 0ul;
+    "a"_test = [] { ++num_executions; };
+    "b"_test = [] {
+        ++num_executions;
+        ct::expect(false);
+    };
+    "c"_test = [] { ++num_executions; };
+}
+
+void resuming(std::filesystem::path const & path, IsolationMode const isolation)
+{
+    {
+        auto journal = Journal{path, false};
+        journal.on_case_start("b");
+        journal.on_case_start("a");
+        journal.on_result(CaseResult{"a", CaseStatus::pass, std::chrono::milliseconds{3}, {}});
+    }
+    auto const resumption = load(path);
+
+    register_cases();
+    auto const outcome = run([&resumption, isolation](Conductor::Setup & setup) {
+        setup.m_resumption = &resumption;
+        setup.m_isolation = isolation;
+    });
+    ct::utils::dynamic_assert(find(outcome, "a").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(find(outcome, "b").m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(find(outcome, "c").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(not outcome.m_interrupted);
+    if (isolation == IsolationMode::off) {
+        ct::utils::dynamic_assert(num_executions == 1ul);
+    }
+}
+
+/// Journal the execution of worker processes, while a test-case kills the main process (e.g. like the OOM killer).
+void killed(std::filesystem::path const & path)
+{
+    auto const pid = ::fork();
+    if (pid == 0) {
+        "before"_test = [] { ct::expect(true); };
+        "killing"_test = [] { ::kill(::getppid(), SIGKILL); };
+        auto journal = Journal{path, false};
+        static_cast<void>(run([&journal](Conductor::Setup & setup) {
+            setup.m_isolation = IsolationMode::process;
+            setup.m_listeners = {&journal};
+        }));
+        ::_exit(EXIT_SUCCESS);
+    }
+    ct::utils::dynamic_assert(pid > 0);
+    auto status = 0;
+    ct::utils::dynamic_assert(::waitpid(pid, &status, 0) == pid);
+    ct::utils::dynamic_assert(WIFSIGNALED(status) and WTERMSIG(status) == SIGKILL);
+
+    // The test-case running in the worker process (when the main process died) is resumed as aborted.
+    auto const resumption = load(path);
+    auto const killing = resumption.lookup(framework::Name{"killing"});
+    ct::utils::dynamic_assert(killing and killing->m_status == CaseStatus::abort);
+}
+
+void interrupting(IsolationMode const isolation)
+{
+    ct::Test{"first", [] { ct::expect(true); }};
+    ct::Test{"signaled", [] {
+                 std::raise(SIGINT);
+                 ct::expect(true);
+             }};
+    for (auto i = 0; i < 4; ++i) {
+        ct::Test{"late/" + std::to_string(i), [] { ct::expect(true); }};
+    }
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_isolation = isolation;
+        setup.m_interruptible = true;
+    });
+
+    // The running test-case is finished (and reported), all later ones are skipped.
+    ct::utils::dynamic_assert(outcome.m_interrupted);
+    ct::utils::dynamic_assert(find(outcome, "first").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(find(outcome, "signaled").m_status == CaseStatus::pass);
+    for (auto i = 0; i < 4; ++i) {
+        ct::utils::dynamic_assert(find(outcome, "late/" + std::to_string(i)).m_status == CaseStatus::skip);
+    }
+    ct::utils::dynamic_assert(logger.str().find("Interrupted") != std::string::npos);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    auto const path = std::filesystem::temp_directory_path() / "clean-test-journal.bin";
+    ct::execute::journaling(path);
+    ct::execute::resuming(path, IsolationMode::off);
+    ct::execute::interrupting(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::resuming(path, IsolationMode::process);
+        ct::execute::killed(path);
+    }
+    std::filesystem::remove(path);
+}
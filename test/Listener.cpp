@@ -0,0 +1,161 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/NameFilter.h>
+#include <execute/ProcessPool.h>
+
+#include <clean-test/clean-test.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+/// Records all events (and the threads they are notified on).
+class Recorder final : public Listener {
+public:
+    void on_case_start(std::string_view const name) final
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        ++m_started[std::string{name}];
+    }
+
+    void on_observation(std::string_view const name, Observation const & observation) final
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        if (observation.m_status != ObservationStatus::pass) {
+            m_failures.emplace(std::string{name}, observation.m_description);
+        }
+        ++m_num_observations;
+    }
+
+    void on_case_stop(std::string_view const name, CaseStatus const status, Duration) final
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        m_stopped.emplace(std::string{name}, status);
+    }
+
+    void on_result(CaseResult const & result) final
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        m_results.emplace(result.m_name_path, result.m_status);
+        m_sink_threads.emplace(std::this_thread::get_id());
+    }
+
+    void on_run_end(Duration) final
+    {
+        auto const lock = std::lock_guard{m_mutex};
+        ++m_num_ends;
+        m_num_results_at_end = m_results.size();
+    }
+
+    std::mutex m_mutex = {};
+    std::map<std::string, std::size_t> m_started = {};
+    std::multimap<std::string, std::string> m_failures = {}; //!< descriptions of failed observations by test-case.
+    std::size_t m_num_observations = 0ul;
+    std::map<std::string, CaseStatus> m_stopped = {};
+    std::map<std::string, CaseStatus> m_results = {};
+    std::set<std::thread::id> m_sink_threads = {};
+    std::size_t m_num_ends = 0ul;
+    std::size_t m_num_results_at_end = 0ul;
+};
+
+void register_cases()
+{
+    "good"_test = [] {
+        ct::expect(true);
+        ct::expect(1 + 1 == 2_i);
+    };
+    "bad"_test = [] { ct::expect(false) << "broken"; };
+    for (auto i = 0; i < 8; ++i) {
+        ct::Test{"many/" + std::to_string(i), [] { ct::expect(true); }};
+    }
+    "disabled"_test = [] { ct::expect(false); };
+}
+
+void verify(Recorder const & recorder)
+{
+    // Start and stop events of every executed test-case.
+    ct::utils::dynamic_assert(recorder.m_started.size() == 10ul);
+    ct::utils::dynamic_assert(std::all_of(recorder.m_started.cbegin(), recorder.m_started.cend(), [](auto const & s) {
+        return s.second == 1ul;
+    }));
+    ct::utils::dynamic_assert(not recorder.m_started.contains("disabled"));
+    ct::utils::dynamic_assert(recorder.m_stopped.size() == 10ul);
+    ct::utils::dynamic_assert(recorder.m_stopped.at("good") == CaseStatus::pass);
+    ct::utils::dynamic_assert(recorder.m_stopped.at("bad") == CaseStatus::fail);
+
+    // All observations (including passed ones) with the test-case conducting them.
+    ct::utils::dynamic_assert(recorder.m_num_observations == 11ul);
+    ct::utils::dynamic_assert(recorder.m_failures.size() == 1ul);
+    ct::utils::dynamic_assert(recorder.m_failures.begin()->first == "bad");
+    ct::utils::dynamic_assert(recorder.m_failures.begin()->second == "broken");
+
+    // All results (including skipped ones) on a single thread, followed by the end of the execution.
+    ct::utils::dynamic_assert(recorder.m_results.size() == 11ul);
+    ct::utils::dynamic_assert(recorder.m_results.at("disabled") == CaseStatus::skip);
+    ct::utils::dynamic_assert(recorder.m_sink_threads.size() == 1ul);
+    ct::utils::dynamic_assert(not recorder.m_sink_threads.contains(std::this_thread::get_id()));
+    ct::utils::dynamic_assert(recorder.m_num_ends == 1ul);
+    ct::utils::dynamic_assert(recorder.m_num_results_at_end == 11ul);
+}
+
+void configured()
+{
+    register_cases();
+    auto recorder = Recorder{};
+    auto logger = std::ostringstream{};
+    auto cfg = Configuration{};
+    cfg.m_logger = &logger;
+    cfg.m_coloring = ColoringMode::disabled;
+    cfg.m_num_jobs = 4ul;
+    cfg.m_filter_settings = {{NameFilterToggle::disabled, NameFilterProperty::path, "^disabled$"}};
+    cfg.m_listeners = {&recorder};
+    ct::utils::dynamic_assert(ct::execute::main(cfg) != 0);
+    verify(recorder);
+}
+
+void isolated()
+{
+    register_cases();
+    auto recorder = Recorder{};
+    auto logger = std::ostringstream{};
+    auto filter = NameFilter{};
+    filter.add(NameFilterToggle::disabled, NameFilterProperty::path, "^disabled$");
+    Conductor{{
+        .m_logger = logger,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 4ul,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter,
+        .m_isolation = IsolationMode::process,
+        .m_listeners = {&recorder}}}
+        .run();
+    // Events of worker processes are replayed from their results.
+    verify(recorder);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::configured();
+    if (ct::execute::supports_isolation()) {
+        ct::execute::isolated();
+    }
+}
@@ -99,6 +99,21 @@ void pattern()
     clean_test::utils::dynamic_assert(clean_test::expression::throws([&] { f("(?P<no>.*)"); })); // invalid pattern
 }
 
+void selection()
+{
+    auto const f = [] {
+        auto r = Filter{};
+        r.add(Toggle::disabled, Property::tag, "female");
+        r.select({"knuth/donald", "ada", "knuth"});
+        return r;
+    }();
+
+    clean_test::utils::dynamic_assert(f(don));
+    clean_test::utils::dynamic_assert(not static_cast<bool>(f(rob))); // not selected
+    clean_test::utils::dynamic_assert(not static_cast<bool>(f(ada))); // selected, but excluded
+    clean_test::utils::dynamic_assert(not static_cast<bool>(f(name("knuth/donald/junior")))); // only exact matches
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void execute()
@@ -131,5 +146,6 @@ int main()
     conflict();
     properties();
     pattern();
+    selection();
     execute();
 }
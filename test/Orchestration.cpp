@@ -0,0 +1,150 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Configuration.h>
+#include <execute/History.h>
+#include <execute/Main.h>
+#include <execute/Orchestra.h>
+
+#include <clean-test/clean-test.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+/// Test-cases of this binary, executed by the worker processes started for orchestrating it.
+void register_cases()
+{
+    for (auto i = 0; i < 4; ++i) {
+        ct::Test{"passing/" + std::to_string(i), [] { ct::expect(true); }};
+    }
+    ct::Test{"failing" / "after:passing/0"_tag, [] { ct::expect(false); }};
+    "crashing"_test = [] { ::_exit(3); }; // takes down its worker
+}
+
+/// Configuration orchestrating @p binaries (reporting into @p logger).
+Configuration configuration(std::vector<std::filesystem::path> binaries, std::ostream & logger)
+{
+    auto result = Configuration{};
+    result.m_logger = &logger;
+    result.m_coloring = ColoringMode::disabled;
+    result.m_num_jobs = 3ul;
+    result.m_binaries = std::move(binaries);
+    return result;
+}
+
+void proxies(std::filesystem::path const & binary)
+{
+    auto const orchestra = Orchestra{{binary, binary}};
+    ct::utils::dynamic_assert(orchestra.label(0ul) == "orchestration");
+    ct::utils::dynamic_assert(orchestra.label(1ul) == "orchestration~2");
+
+    auto const cases = orchestra.cases();
+    ct::utils::dynamic_assert(cases.size() == 12ul);
+    auto const failing = std::find_if(cases.cbegin(), cases.cend(), [](framework::Case const & tc) {
+        return tc.name().path() == "orchestration~2/failing";
+    });
+    ct::utils::dynamic_assert(failing != cases.cend());
+    // Dependencies refer to test-cases of the same binary.
+    auto const & tags = failing->name().tags();
+    ct::utils::dynamic_assert(tags.size() == 1ul);
+    ct::utils::dynamic_assert(static_cast<std::string_view>(tags.front()) == "after:orchestration~2/passing/0");
+
+    auto const * origin = orchestra.origin("orchestration~2/failing");
+    ct::utils::dynamic_assert(origin != nullptr and origin->m_binary == 1ul and origin->m_path == "failing");
+    ct::utils::dynamic_assert(orchestra.origin("orchestration/unknown") == nullptr);
+}
+
+void listing(std::filesystem::path const & binary)
+{
+    auto logger = std::ostringstream{};
+    auto cfg = configuration({binary}, logger);
+    cfg.m_operation = OperationMode::list;
+    cfg.m_listing = ListingFormat::names;
+    ct::utils::dynamic_assert(main(cfg) == 0);
+    auto const listed = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(listed, "orchestration/passing/3\n"));
+    ct::utils::dynamic_assert(contains(listed, "orchestration/failing\tafter:orchestration/passing/0\n"));
+    ct::utils::dynamic_assert(framework::registry().empty()); // proxies are unregistered afterwards
+}
+
+void orchestrating(std::filesystem::path const & binary, std::filesystem::path const & directory)
+{
+    auto logger = std::ostringstream{};
+    auto cfg = configuration({binary, binary}, logger);
+    cfg.m_junit_path = directory / "junit.xml";
+    cfg.m_history_path = directory / "history";
+
+    // Both failing and both crashing test-cases (of the two binaries) fail the execution.
+    ct::utils::dynamic_assert(main(cfg) == 4);
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "orchestration~2/crashing"));
+    ct::utils::dynamic_assert(contains(console, "Worker process exited unexpectedly with status 3."));
+
+    // All results are merged into a single report.
+    auto junit = std::ostringstream{};
+    junit << std::ifstream{cfg.m_junit_path}.rdbuf();
+    auto const xml = std::move(junit).str();
+    ct::utils::dynamic_assert(contains(xml, R"(tests="12")"));
+    for (auto const * label : {"orchestration", "orchestration~2"}) {
+        for (auto const * name : {"/passing/0", "/passing/3", "/failing", "/crashing"}) {
+            ct::utils::dynamic_assert(contains(xml, "name=\"" + std::string{label} + name + '"'));
+        }
+    }
+
+    // Durations are recorded for scheduling subsequent executions.
+    auto history = History{};
+    std::ifstream{cfg.m_history_path} >> history;
+    ct::utils::dynamic_assert(history.find("orchestration~2/passing/1") != nullptr);
+}
+
+void unlisted()
+{
+    auto logger = std::ostringstream{};
+    ct::utils::dynamic_assert(main(configuration({"/nonexistent/binary"}, logger)) == 1);
+    ct::utils::dynamic_assert(contains(std::move(logger).str(), "Failed to list test-cases of /nonexistent/binary."));
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char ** argv)
+{
+    if (argc > 1) {
+        // Listing or working for the orchestrating process.
+        ct::execute::register_cases();
+        return ct::execute::main(argc, argv);
+    }
+
+    if (ct::execute::supports_orchestration()) {
+        auto const binary = std::filesystem::absolute(argv[0]);
+        auto const directory
+            = std::filesystem::temp_directory_path() / ("clean-test-orchestration-" + std::to_string(::getpid()));
+        std::filesystem::create_directories(directory);
+        ct::execute::proxies(binary);
+        ct::execute::listing(binary);
+        ct::execute::orchestrating(binary, directory);
+        ct::execute::unlisted();
+        std::filesystem::remove_all(directory);
+    }
+}
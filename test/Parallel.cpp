@@ -0,0 +1,122 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+void sequential()
+{
+    // Without any execution, all indices are processed by the calling thread.
+    auto visited = std::vector<std::size_t>{};
+    ct::parallel_for(3ul, 10ul, [&visited](std::size_t const i) { visited.emplace_back(i); });
+    auto expected = std::vector<std::size_t>(7ul);
+    std::iota(expected.begin(), expected.end(), 3ul);
+    ct::utils::dynamic_assert(visited == expected);
+
+    ct::parallel_for(5ul, 5ul, [](std::size_t) { throw std::logic_error{"unreachable"}; });
+
+    auto num_invocations = 0ul;
+    try {
+        ct::parallel_for(0ul, 10ul, [&num_invocations](std::size_t const i) {
+            ++num_invocations;
+            if (i == 2ul) {
+                throw std::runtime_error{"failure"};
+            }
+        });
+        ct::utils::dynamic_assert(false);
+    } catch (std::runtime_error const &) {
+        ct::utils::dynamic_assert(num_invocations == 3ul);
+    }
+}
+
+std::mutex threads_mutex;
+std::set<std::thread::id> threads = {}; //!< threads which participated in test-case "heavy".
+
+void register_cases()
+{
+    threads.clear();
+    "heavy"_test = [] {
+        auto num_invocations = std::atomic<std::size_t>{0ul};
+        ct::parallel_for(0ul, 64ul, [&num_invocations](std::size_t const i) {
+            {
+                auto const lock = std::lock_guard{threads_mutex};
+                threads.emplace(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(2ms);
+            ++num_invocations;
+            ct::expect(i < 64ul); // observed for "heavy" on all threads
+        });
+        ct::expect(num_invocations.load() == 64ul);
+    };
+    "throwing"_test = [] {
+        ct::parallel_for(0ul, 64ul, [](std::size_t const i) {
+            if (i == 42ul) {
+                throw std::runtime_error{"failure"};
+            }
+        });
+    };
+    "nested"_test = [] {
+        auto sum = std::atomic<std::size_t>{0ul};
+        ct::parallel_for(0ul, 4ul, [&sum](std::size_t const i) {
+            ct::parallel_for(0ul, 4ul, [&sum, i](std::size_t const j) { sum += 4ul * i + j; });
+        });
+        ct::expect(sum.load() == 120ul);
+    };
+}
+
+void assisted(std::size_t const num_workers, CaseResult::Duration const timeout)
+{
+    register_cases();
+    auto const outcome = run([num_workers, timeout](Conductor::Setup & setup) {
+        setup.m_num_workers = num_workers;
+        setup.m_timeout = timeout;
+    });
+
+    // No observation ended up at the fallback observer.
+    ct::utils::dynamic_assert(outcome.m_results.size() == 3ul);
+    auto const & heavy = find(outcome, "heavy");
+    ct::utils::dynamic_assert(heavy.m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(heavy.m_observations.size() == 65ul);
+    ct::utils::dynamic_assert(find(outcome, "throwing").m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(find(outcome, "nested").m_status == CaseStatus::pass);
+
+    // Only workers participated: Idle ones assist unless test-cases may time out.
+    ct::utils::dynamic_assert(not threads.empty());
+    ct::utils::dynamic_assert(threads.size() <= num_workers);
+    if (timeout != CaseResult::Duration{}) {
+        ct::utils::dynamic_assert(threads.size() == 1ul);
+    } else if (num_workers > 1ul) {
+        ct::utils::dynamic_assert(threads.size() > 1ul);
+    }
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::sequential();
+    ct::execute::assisted(1ul, {});
+    ct::execute::assisted(4ul, {});
+    ct::execute::assisted(4ul, std::chrono::seconds{10});
+}
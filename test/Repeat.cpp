@@ -0,0 +1,149 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+#include <execute/Repetitions.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <ranges>
+#include <sstream>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+void combination()
+{
+    auto repetitions = Repetitions{2ul, 3ul};
+    ct::utils::dynamic_assert(repetitions.aggregates());
+    ct::utils::dynamic_assert(repetitions.num_copies() == 6ul);
+    ct::utils::dynamic_assert(repetitions.case_index(3ul) == 1ul);
+
+    repetitions.add(0ul, CaseResult{"a", CaseStatus::pass, 3ms, {}});
+    repetitions.add(1ul, CaseResult{"b", CaseStatus::skip, 0ms, {}});
+    repetitions.add(2ul, CaseResult{"a", CaseStatus::fail, 1ms, {}});
+    repetitions.add(3ul, CaseResult{"b", CaseStatus::pass, 7ms, {}});
+    repetitions.add(4ul, CaseResult{"a", CaseStatus::pass, 2ms, {}});
+    repetitions.add(5ul, CaseResult{"b", CaseStatus::skip, 0ms, {}});
+
+    auto const results = std::move(repetitions).combine();
+    ct::utils::dynamic_assert(results.size() == 2ul);
+
+    auto const & a = results[0ul];
+    ct::utils::dynamic_assert(a.m_status == CaseStatus::fail);
+    ct::utils::dynamic_assert(a.m_wall_time == 2ms);
+    ct::utils::dynamic_assert(a.m_statistics->m_num_runs == 3ul);
+    ct::utils::dynamic_assert(a.m_statistics->m_num_failures == 1ul);
+    ct::utils::dynamic_assert(a.m_statistics->m_min == 1ms);
+    ct::utils::dynamic_assert(a.m_statistics->m_max == 3ms);
+
+    auto const & b = results[1ul];
+    ct::utils::dynamic_assert(b.m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(b.m_statistics->m_num_runs == 1ul);
+    ct::utils::dynamic_assert(b.m_statistics->m_median == 7ms);
+
+    ct::utils::dynamic_assert(not Repetitions{2ul, 1ul}.aggregates());
+}
+
+std::atomic<std::size_t> num_stable = 0ul; //!< number of runs of test-case "stable".
+std::atomic<std::size_t> num_flaky = 0ul; //!< number of runs of test-case "flaky".
+std::atomic<std::size_t> num_samples = 0ul; //!< number of runs of any test-case "data".
+
+void register_cases()
+{
+    num_stable = 0ul;
+    num_flaky = 0ul;
+    num_samples = 0ul;
+    "stable"_test = [] {
+        ++num_stable;
+        ct::expect(true);
+    };
+    "flaky"_test = [] { ct::expect(++num_flaky != 5ul); };
+    std::views::iota(0, 2) | "data"_test = [](int const i) {
+        ++num_samples;
+        ct::expect(i < 2);
+    };
+}
+
+void stress(IsolationMode const isolation)
+{
+    register_cases();
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 4ul;
+        setup.m_isolation = isolation;
+        setup.m_repetitions = 20ul;
+    });
+    ct::utils::dynamic_assert(outcome.m_results.size() == 4ul);
+    if (isolation == IsolationMode::off) {
+        ct::utils::dynamic_assert(num_stable == 20ul);
+        ct::utils::dynamic_assert(num_samples == 40ul);
+    }
+
+    auto const & stable = find(outcome, "stable");
+    ct::utils::dynamic_assert(stable.m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(stable.m_statistics->m_num_runs == 20ul);
+    ct::utils::dynamic_assert(stable.m_statistics->m_num_failures == 0ul);
+    ct::utils::dynamic_assert(stable.m_statistics->m_min <= stable.m_statistics->m_median);
+    ct::utils::dynamic_assert(stable.m_statistics->m_median <= stable.m_statistics->m_max);
+    ct::utils::dynamic_assert(find(outcome, "data/1").m_statistics->m_num_runs == 20ul);
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "Running 4 test-cases (20 times each)"));
+    ct::utils::dynamic_assert(contains(console, "[ REPT  ] stable: 0/20 runs failed"));
+    if (isolation == IsolationMode::off) {
+        // Worker processes have separate counters (thus only in-process execution is deterministic).
+        auto const & flaky = find(outcome, "flaky");
+        ct::utils::dynamic_assert(flaky.m_status == CaseStatus::fail);
+        ct::utils::dynamic_assert(flaky.m_statistics->m_num_failures == 1ul);
+        ct::utils::dynamic_assert(contains(console, "[ REPT  ] flaky: 1/20 runs failed"));
+    }
+}
+
+void until_fail()
+{
+    register_cases();
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [](Conductor::Setup & setup) {
+        setup.m_repetitions = 1000ul;
+        setup.m_until_fail = true;
+    });
+    ct::utils::dynamic_assert(outcome.m_results.size() == 4ul);
+
+    // Copies are interleaved: All test-cases ran as often as the flaky one before it failed.
+    auto const & flaky = find(outcome, "flaky");
+    ct::utils::dynamic_assert(flaky.m_status == CaseStatus::fail);
+    ct::utils::dynamic_assert(flaky.m_statistics->m_num_runs == 5ul);
+    ct::utils::dynamic_assert(num_stable == 5ul);
+    ct::utils::dynamic_assert(find(outcome, "stable").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(contains(std::move(logger).str(), "Cancelled after the first failing run (until-fail)"));
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::combination();
+    ct::execute::stress(IsolationMode::off);
+    ct::execute::until_fail();
+    if (ct::execute::supports_isolation()) {
+        ct::execute::stress(IsolationMode::process);
+    }
+}
@@ -0,0 +1,215 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/NameFilter.h>
+#include <execute/ProcessPool.h>
+#include <execute/Repetitions.h>
+#include <execute/Resources.h>
+#include <execute/Scheduler.h>
+
+#include <clean-test/framework.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+void memory()
+{
+    ct::utils::dynamic_assert(parse_memory("12") == 12ul);
+    ct::utils::dynamic_assert(parse_memory("0") == 0ul);
+    ct::utils::dynamic_assert(parse_memory("3K") == 3ul << 10);
+    ct::utils::dynamic_assert(parse_memory("512M") == 512ul << 20);
+    ct::utils::dynamic_assert(parse_memory("8G") == 8ul << 30);
+    ct::utils::dynamic_assert(parse_memory("2T") == 2ul << 40);
+
+    for (auto const malformed : {"", "G", "1.5G", "-1", "1g", "1GB", " 1", "99999999999T"}) {
+        ct::utils::dynamic_assert(not parse_memory(malformed));
+    }
+}
+
+void tags()
+{
+    ct::utils::dynamic_assert(requirements(framework::Name{"a"}).empty());
+    ct::utils::dynamic_assert(requirements("a" / "exclusive-ish"_tag / "lock:"_tag / "mem:lots"_tag).empty());
+
+    auto const all = requirements("a" / "exclusive"_tag / "mem:2G"_tag / "lock:db"_tag / "mem:1K"_tag);
+    ct::utils::dynamic_assert(all == Requirements{.m_exclusive = true, .m_memory = 1ul << 10, .m_locks = {"db"}});
+
+    auto const locks = requirements("a" / "lock:net"_tag / "lock:db"_tag / "lock:net"_tag);
+    ct::utils::dynamic_assert(locks.m_locks == std::vector<std::string>{"db", "net"});
+    ct::utils::dynamic_assert(not locks.m_exclusive and locks.m_memory == 0ul);
+}
+
+void scheduling()
+{
+    auto const scheduler = make_scheduler(SchedulingMode::shared_cursor, registration_order(6ul), 1ul);
+    auto const repetitions = Repetitions{6ul, 1ul};
+    auto resources = ResourceScheduler{
+        *scheduler,
+        repetitions,
+        {Requirements{.m_locks = {"a"}},
+         Requirements{.m_locks = {"a"}},
+         Requirements{},
+         Requirements{.m_exclusive = true},
+         Requirements{.m_memory = 6ul},
+         Requirements{.m_memory = 6ul}},
+        DependencyGraph{},
+        10ul};
+    auto const next = [&resources] { return resources.next(0ul).m_copy; };
+
+    // Blocked test-cases are deferred while compatible ones are handed out.
+    ct::utils::dynamic_assert(next() == 0ul);
+    ct::utils::dynamic_assert(next() == 2ul);
+    ct::utils::dynamic_assert(next() == 4ul);
+    ct::utils::dynamic_assert(not next());
+    ct::utils::dynamic_assert(not resources.exhausted());
+
+    // Deferred ones are handed out (in order) once their resources have been released.
+    auto const epoch = resources.next(0ul).m_epoch;
+    resources.release(0ul);
+    resources.await(epoch);
+    ct::utils::dynamic_assert(next() == 1ul);
+    ct::utils::dynamic_assert(not next());
+    for (auto const index : {1ul, 2ul, 4ul}) {
+        resources.release(index);
+    }
+    ct::utils::dynamic_assert(next() == 3ul);
+    ct::utils::dynamic_assert(not next());
+    resources.release(3ul);
+    ct::utils::dynamic_assert(next() == 5ul);
+    ct::utils::dynamic_assert(not next());
+    ct::utils::dynamic_assert(resources.exhausted());
+}
+
+void oversized()
+{
+    // Requiring more than the budget can still be executed (on its own).
+    auto const scheduler = make_scheduler(SchedulingMode::shared_cursor, registration_order(2ul), 1ul);
+    auto const repetitions = Repetitions{2ul, 1ul};
+    auto resources = ResourceScheduler{
+        *scheduler,
+        repetitions,
+        {Requirements{.m_memory = 100ul}, Requirements{.m_memory = 1ul}},
+        DependencyGraph{},
+        10ul};
+    ct::utils::dynamic_assert(resources.next(0ul).m_copy == 0ul);
+    ct::utils::dynamic_assert(not resources.next(0ul).m_copy);
+    resources.release(0ul);
+    ct::utils::dynamic_assert(resources.next(0ul).m_copy == 1ul);
+}
+
+/// Number of test-cases concurrently holding some resource (and the maximum thereof).
+class Occupancy {
+public:
+    void enter()
+    {
+        auto const current = ++m_current;
+        auto previous = m_peak.load();
+        while (previous < current and not m_peak.compare_exchange_weak(previous, current)) {
+        }
+        std::this_thread::sleep_for(5ms);
+    }
+
+    void leave()
+    {
+        --m_current;
+    }
+
+    std::atomic<std::size_t> m_current = 0ul;
+    std::atomic<std::size_t> m_peak = 0ul;
+};
+
+Occupancy database; //!< test-cases tagged "lock:db".
+Occupancy heavy; //!< test-cases tagged "mem:3K".
+Occupancy everyone; //!< all test-cases.
+std::atomic<bool> alone = true; //!< whether the exclusive test-case ran on its own.
+
+void register_cases()
+{
+    database.m_peak = 0ul;
+    heavy.m_peak = 0ul;
+    everyone.m_peak = 0ul;
+    alone = true;
+    for (auto i = 0; i < 6; ++i) {
+        auto const suffix = std::to_string(i);
+        ct::Test{("db/" + suffix) / "lock:db"_tag, [] {
+                     database.enter();
+                     everyone.enter();
+                     everyone.leave();
+                     database.leave();
+                 }};
+        ct::Test{("heavy/" + suffix) / "mem:3K"_tag, [] {
+                     heavy.enter();
+                     everyone.enter();
+                     everyone.leave();
+                     heavy.leave();
+                 }};
+        ct::Test{"free/" + suffix, [] {
+                     everyone.enter();
+                     everyone.leave();
+                 }};
+    }
+    ct::Test{"exclusive" / "exclusive"_tag, [] {
+                 alone = alone and (++everyone.m_current == 1ul);
+                 std::this_thread::sleep_for(5ms);
+                 --everyone.m_current;
+             }};
+}
+
+void constrained(IsolationMode const isolation)
+{
+    register_cases();
+    auto logger = std::ostringstream{};
+    auto const filter = NameFilter{};
+    auto const outcome = Conductor{{
+        .m_logger = logger,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 4ul,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter,
+        .m_isolation = isolation,
+        .m_memory = 8ul << 10}}.run();
+
+    ct::utils::dynamic_assert(outcome.m_results.size() == 19ul);
+    ct::utils::dynamic_assert(std::all_of(outcome.m_results.cbegin(), outcome.m_results.cend(), [](auto const & r) {
+        return r.m_status == CaseStatus::pass;
+    }));
+    if (isolation == IsolationMode::off) {
+        // Worker processes have separate counters (thus only in-process execution can be observed).
+        ct::utils::dynamic_assert(database.m_peak == 1ul);
+        ct::utils::dynamic_assert(heavy.m_peak <= 2ul);
+        ct::utils::dynamic_assert(everyone.m_peak > 1ul);
+        ct::utils::dynamic_assert(alone);
+    }
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::memory();
+    ct::execute::tags();
+    ct::execute::scheduling();
+    ct::execute::oversized();
+    ct::execute::constrained(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::constrained(IsolationMode::process);
+    }
+}
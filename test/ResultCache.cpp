@@ -0,0 +1,128 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/BuildId.h>
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/NameFilter.h>
+#include <execute/ResultCache.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+ResultCache reload(ResultCache const & cache, std::string key)
+{
+    auto buffer = std::stringstream{};
+    buffer << cache;
+    auto result = ResultCache{std::move(key)};
+    buffer >> result;
+    return result;
+}
+
+void identification()
+{
+    auto const id = build_id();
+    ct::utils::dynamic_assert(id == build_id());
+    ct::utils::dynamic_assert(id.find_first_not_of("0123456789abcdef") == std::string::npos);
+}
+
+void tags()
+{
+    ct::utils::dynamic_assert(cacheable(framework::Name{"a"}));
+    ct::utils::dynamic_assert(cacheable("a" / "slow"_tag));
+    ct::utils::dynamic_assert(not cacheable("a" / "nondeterministic"_tag));
+    ct::utils::dynamic_assert(not cacheable("a" / "slow"_tag / "side-effects"_tag));
+}
+
+void persistence()
+{
+    auto cache = ResultCache{"key"};
+    cache.update(CaseResult{"passed", CaseStatus::pass, 1ms, {}});
+    cache.update(CaseResult{"failed", CaseStatus::fail, 1ms, {}});
+    cache.update(CaseResult{"skipped", CaseStatus::skip, 0ms, {}});
+    ct::utils::dynamic_assert(cache.size() == 0ul); // updates only affect subsequent executions
+
+    auto loaded = reload(cache, "key");
+    ct::utils::dynamic_assert(loaded.size() == 1ul);
+    ct::utils::dynamic_assert(loaded.lookup(framework::Name{"passed"})->m_status == CaseStatus::cached);
+    ct::utils::dynamic_assert(not loaded.lookup(framework::Name{"failed"}));
+    ct::utils::dynamic_assert(not loaded.lookup(framework::Name{"skipped"}));
+    ct::utils::dynamic_assert(not loaded.lookup("passed" / "nondeterministic"_tag));
+
+    // Entries are retained unless they fail.
+    loaded.update(CaseResult{"failed", CaseStatus::pass, 1ms, {}});
+    ct::utils::dynamic_assert(reload(loaded, "key").size() == 2ul);
+    loaded.update(CaseResult{"passed", CaseStatus::abort, 1ms, {}});
+    ct::utils::dynamic_assert(reload(loaded, "key").size() == 1ul);
+
+    // Different builds (or configurations) don't share anything.
+    ct::utils::dynamic_assert(reload(cache, "other").size() == 0ul);
+}
+
+std::atomic<int> num_executed = 0; //!< number of executed test-cases.
+
+void register_cases()
+{
+    "stable"_test = [] {
+        ++num_executed;
+        ct::expect(true);
+    };
+    ct::Test{"random" / "nondeterministic"_tag, [] {
+        ++num_executed;
+        ct::expect(true);
+    }};
+    "broken"_test = [] {
+        ++num_executed;
+        ct::expect(false);
+    };
+}
+
+void execution()
+{
+    auto cache = ResultCache{"key"};
+    cache.update(CaseResult{"stable", CaseStatus::pass, 1ms, {}});
+    cache.update(CaseResult{"random", CaseStatus::pass, 1ms, {}});
+    cache = reload(cache, "key");
+
+    register_cases();
+    auto logger = std::ostringstream{};
+    auto const filter = NameFilter{};
+    auto const outcome = Conductor{{
+        .m_logger = logger,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 1ul,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter,
+        .m_cache = &cache}}.run();
+
+    ct::utils::dynamic_assert(num_executed == 2);
+    ct::utils::dynamic_assert(outcome.m_results.size() == 3ul);
+    for (auto const & r : outcome.m_results) {
+        ct::utils::dynamic_assert((r.m_name_path == "stable") == (r.m_status == CaseStatus::cached));
+    }
+    ct::utils::dynamic_assert(logger.str().find("Of which 1 test-cases passed in a previous") != std::string::npos);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::identification();
+    ct::execute::tags();
+    ct::execute::persistence();
+    ct::execute::execution();
+}
@@ -0,0 +1,161 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/JUnitExport.h>
+#include <execute/ResultPipeline.h>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace ct = clean_test;
+using Result = ct::execute::CaseResult;
+using Status = ct::execute::CaseStatus;
+using namespace std::chrono_literals;
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+/// Sink remembering the names of all consumed results.
+class Recorder final : public ct::execute::ResultSink {
+public:
+    std::vector<std::string> m_names = {};
+    std::size_t m_num_finished = 0ul;
+    ct::execute::Outcome::Duration m_wall_time = {};
+
+private:
+    void consume_impl(Result const & result) final
+    {
+        m_names.emplace_back(result.m_name_path);
+    }
+
+    void finish_impl(ct::execute::Outcome::Duration const wall_time) final
+    {
+        ++m_num_finished;
+        m_wall_time = wall_time;
+    }
+};
+
+Result make_result(std::string name, Status const status = Status::pass)
+{
+    return Result{std::move(name), status, 1ms, {}};
+}
+
+void delivery()
+{
+    for (auto const retain : {false, true}) {
+        constexpr auto num_producers = 4ul;
+        constexpr auto num_results = 1000ul;
+
+        auto recorder = Recorder{};
+        auto pipeline = ct::execute::ResultPipeline{{&recorder}, retain, 8ul};
+        {
+            auto producers = std::vector<std::jthread>{};
+            for (auto p = 0ul; p < num_producers; ++p) {
+                producers.emplace_back([&pipeline, p] {
+                    for (auto i = 0ul; i < num_results; ++i) {
+                        pipeline.push(make_result(std::to_string(p) + '/' + std::to_string(i)));
+                    }
+                });
+            }
+        }
+        auto const retained = pipeline.finish(5s);
+
+        ct::utils::dynamic_assert(recorder.m_num_finished == 1ul);
+        ct::utils::dynamic_assert(recorder.m_wall_time == 5s);
+        ct::utils::dynamic_assert(recorder.m_names.size() == num_producers * num_results);
+        ct::utils::dynamic_assert(retained.size() == (retain ? num_producers * num_results : 0ul));
+
+        // Results of every producer are delivered in order.
+        auto next = std::vector<std::size_t>(num_producers, 0ul);
+        for (auto const & name : recorder.m_names) {
+            auto const separator = name.find('/');
+            auto const producer = std::stoul(name.substr(0ul, separator));
+            ct::utils::dynamic_assert(std::stoul(name.substr(separator + 1ul)) == next[producer]++);
+        }
+    }
+}
+
+/// Sink taking some time for consuming every result.
+class Slow final : public ct::execute::ResultSink {
+public:
+    std::atomic<bool> m_consuming = false;
+    std::atomic<std::size_t> m_num_consumed = 0ul;
+
+private:
+    void consume_impl(Result const &) final
+    {
+        m_consuming = true;
+        std::this_thread::sleep_for(50ms);
+        ++m_num_consumed;
+        m_consuming = false;
+    }
+
+    void finish_impl(ct::execute::Outcome::Duration) final
+    {}
+};
+
+void pausing()
+{
+    auto slow = Slow{};
+    auto pipeline = ct::execute::ResultPipeline{{&slow}, false};
+    pipeline.push(make_result("first"));
+    while (not slow.m_consuming) {
+        std::this_thread::yield();
+    }
+    {
+        // Pausing waits for the consumer to finish handing out its results.
+        auto const paused = pipeline.pause();
+        ct::utils::dynamic_assert(not slow.m_consuming);
+        ct::utils::dynamic_assert(slow.m_num_consumed == 1ul);
+
+        // Results pushed meanwhile are queued but not consumed.
+        pipeline.push(make_result("second"));
+        std::this_thread::sleep_for(20ms);
+        ct::utils::dynamic_assert(slow.m_num_consumed == 1ul);
+    }
+    static_cast<void>(pipeline.finish(1s));
+    ct::utils::dynamic_assert(slow.m_num_consumed == 2ul);
+}
+
+void junit_stream()
+{
+    auto out = std::stringstream{};
+    auto junit = ct::execute::JUnitStream{out};
+    junit.consume(make_result("good"));
+    junit.consume(make_result("bad", Status::fail));
+
+    // Partial reports contain all results consumed so far.
+    auto const partial = out.str();
+    ct::utils::dynamic_assert(contains(partial, "<testcase name=\"good\""));
+    ct::utils::dynamic_assert(contains(partial, "<testcase name=\"bad\""));
+    ct::utils::dynamic_assert(not contains(partial, "</testsuites>"));
+
+    junit.consume(make_result("hung", Status::timeout));
+    junit.finish(3s);
+    auto const complete = out.str();
+    ct::utils::dynamic_assert(contains(complete, "<testsuites tests=\"3\" failures=\"1\" disabled=\"0\" errors=\"1\""));
+    ct::utils::dynamic_assert(contains(complete, "time=\"3.000\""));
+    ct::utils::dynamic_assert(contains(complete, "status=\"timeout\""));
+    ct::utils::dynamic_assert(complete.ends_with("</testsuites>\n"));
+    ct::utils::dynamic_assert(complete.size() > partial.size());
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    delivery();
+    pausing();
+    junit_stream();
+}
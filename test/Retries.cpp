@@ -0,0 +1,175 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/FailureSet.h>
+#include <execute/JUnitExport.h>
+#include <execute/ProcessPool.h>
+#include <execute/Retries.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+FailureSet quarantine(std::string const & names)
+{
+    auto result = FailureSet{};
+    auto in = std::istringstream{names};
+    in >> result;
+    return result;
+}
+
+void bookkeeping()
+{
+    auto const quarantined = quarantine("b\n");
+    auto retries = Retries{3ul, 2ul, &quarantined};
+    auto const failed = CaseResult{"a", CaseStatus::fail, CaseResult::Duration{}, {}};
+
+    // Failed and aborted test-cases are retried (up to the limit), others aren't.
+    ct::utils::dynamic_assert(retries.retry(0ul, failed));
+    ct::utils::dynamic_assert(retries.retry(0ul, CaseResult{"a", CaseStatus::abort, CaseResult::Duration{}, {}}));
+    ct::utils::dynamic_assert(not retries.retry(0ul, failed));
+    ct::utils::dynamic_assert(not retries.retry(1ul, CaseResult{"b", CaseStatus::pass, CaseResult::Duration{}, {}}));
+    ct::utils::dynamic_assert(not retries.retry(1ul, CaseResult{"b", CaseStatus::timeout, CaseResult::Duration{}, {}}));
+
+    // Final results summarize the attempts (if retried) and the quarantine (if failing).
+    auto const a = retries.finish(0ul, failed);
+    ct::utils::dynamic_assert(a.m_attempts->m_num_attempts == 3ul);
+    ct::utils::dynamic_assert(a.m_attempts->m_first == CaseStatus::fail);
+    ct::utils::dynamic_assert(not a.m_quarantined and not tolerated(a));
+    auto const b = retries.finish(1ul, CaseResult{"b", CaseStatus::fail, CaseResult::Duration{}, {}});
+    ct::utils::dynamic_assert(not b.m_attempts);
+    ct::utils::dynamic_assert(b.m_quarantined and tolerated(b));
+    ct::utils::dynamic_assert(not retries.finish(1ul, CaseResult{"b", CaseStatus::pass, {}, {}}).m_quarantined);
+
+    // Without any retries, nothing is retried.
+    ct::utils::dynamic_assert(not Retries{3ul, 0ul, nullptr}.retry(0ul, failed));
+}
+
+std::mutex order_mutex = {};
+std::vector<std::string> order = {}; //!< names of all executed test-cases (in order of their execution).
+std::atomic<std::size_t> num_flaky = 0ul; //!< number of executions of test-case "flaky".
+
+void record(std::string name)
+{
+    auto const lock = std::lock_guard{order_mutex};
+    order.emplace_back(std::move(name));
+}
+
+void register_cases()
+{
+    order.clear();
+    num_flaky = 0ul;
+    "flaky"_test = [] {
+        record("flaky");
+        ct::expect(++num_flaky > 1ul);
+    };
+    "broken"_test = [] {
+        record("broken");
+        ct::expect(false) << ct::asserted;
+    };
+    "quarantined"_test = [] {
+        record("quarantined");
+        ct::expect(false);
+    };
+    for (auto i = 0; i < 4; ++i) {
+        ct::Test{"stable/" + std::to_string(i), [i] {
+                     record("stable/" + std::to_string(i));
+                     ct::expect(true);
+                 }};
+    }
+}
+
+void retrying(IsolationMode const isolation)
+{
+    register_cases();
+    auto logger = std::ostringstream{};
+    auto report = std::ostringstream{};
+    auto junit = JUnitStream{report};
+    auto const quarantined = quarantine("quarantined\n");
+    auto const outcome = run(logger, [&quarantined, &junit, isolation](Conductor::Setup & setup) {
+        setup.m_quarantine = &quarantined;
+        setup.m_isolation = isolation;
+        setup.m_max_failures = 2ul;
+        setup.m_retries = 2ul;
+        setup.m_sinks = {&junit};
+    });
+    ct::utils::dynamic_assert(outcome.m_results.size() == 7ul);
+
+    // Flaky test-cases eventually pass; broken ones fail all attempts (which count only once for the budget).
+    auto const & flaky = find(outcome, "flaky");
+    ct::utils::dynamic_assert(flaky.m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(flaky.m_attempts->m_num_attempts == 2ul);
+    ct::utils::dynamic_assert(flaky.m_attempts->m_first == CaseStatus::fail);
+    auto const & broken = find(outcome, "broken");
+    ct::utils::dynamic_assert(broken.m_status == CaseStatus::abort);
+    ct::utils::dynamic_assert(broken.m_attempts->m_num_attempts == 3ul);
+    ct::utils::dynamic_assert(broken.m_attempts->m_first == CaseStatus::abort);
+
+    // Failures of quarantined test-cases are tolerated.
+    auto const & tolerated = find(outcome, "quarantined");
+    ct::utils::dynamic_assert(tolerated.m_status == CaseStatus::fail and tolerated.m_quarantined);
+    ct::utils::dynamic_assert(find(outcome, "stable/3").m_status == CaseStatus::pass);
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(contains(console, "[ RETRY ] flaky: first attempt failed, eventually passed (after 2"));
+    ct::utils::dynamic_assert(contains(console, "[ RETRY ] broken: first attempt aborted, eventually aborted"));
+    ct::utils::dynamic_assert(contains(console, "[ QUAR  ] quarantined"));
+    ct::utils::dynamic_assert(not contains(console, "Cancelled after"));
+
+    auto const xml = std::move(report).str();
+    ct::utils::dynamic_assert(contains(xml, R"(status="flaky")"));
+    ct::utils::dynamic_assert(contains(xml, R"(<flakyFailure message="Passed after 2 attempts.")"));
+    ct::utils::dynamic_assert(contains(xml, R"(<rerunError message="Failed after 3 attempts.")"));
+    ct::utils::dynamic_assert(contains(xml, R"(status="quarantined")"));
+
+    if (isolation == IsolationMode::off) {
+        // Retries are handed out right away (before all unstarted test-cases) rather than at the end.
+        ct::utils::dynamic_assert(
+            order
+            == std::vector<std::string>{
+                "flaky",
+                "flaky",
+                "broken",
+                "broken",
+                "broken",
+                "quarantined",
+                "quarantined",
+                "quarantined",
+                "stable/0",
+                "stable/1",
+                "stable/2",
+                "stable/3"});
+    }
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::bookkeeping();
+    ct::execute::retrying(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::retrying(IsolationMode::process);
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <clean-test/clean-test.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace {
+
+using ct::execute::CaseStatus;
+using Results = ct::Runner::Results;
+
+ct::execute::CaseResult const & find(Results const & results, std::string_view const name)
+{
+    auto const pos = std::find_if(results.cbegin(), results.cend(), [name](auto const & r) {
+        return r.m_name_path == name;
+    });
+    ct::utils::dynamic_assert(pos != results.cend());
+    return *pos;
+}
+
+std::vector<ct::execute::NameFilterSetting> selecting(std::string const & pattern)
+{
+    using namespace ct::execute;
+    return {NameFilterSetting{NameFilterToggle::enabled, NameFilterProperty::path, pattern}};
+}
+
+std::atomic<std::size_t> num_alpha = 0ul; //!< number of executions of the test-suite "alpha".
+std::atomic<std::size_t> num_beta = 0ul; //!< number of executions of the test-suite "beta".
+
+void register_cases()
+{
+    ct::Suite{"alpha", [] {
+                  "x"_test = [] { ++num_alpha; };
+                  "y"_test = [] { ++num_alpha; };
+              }};
+    ct::Suite{"beta", [] { "z"_test = [] { ++num_beta; }; }};
+}
+
+void embedding(ct::execute::IsolationMode const isolation)
+{
+    num_alpha = 0ul;
+    num_beta = 0ul;
+    auto logger = std::ostringstream{};
+    auto cfg = ct::Configuration{};
+    cfg.m_logger = &logger;
+    cfg.m_coloring = ct::execute::ColoringMode::disabled;
+    cfg.m_num_jobs = 2ul;
+    cfg.m_buffering = ct::execute::BufferingMode::testcase;
+    cfg.m_isolation = isolation;
+    auto runner = ct::Runner{cfg};
+
+    // Every invocation executes its own selection of all registered test-cases.
+    auto const alpha = runner.run(selecting("^alpha"));
+    ct::utils::dynamic_assert(alpha.size() == 3ul);
+    ct::utils::dynamic_assert(find(alpha, "alpha/x").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(find(alpha, "alpha/y").m_status == CaseStatus::pass);
+    ct::utils::dynamic_assert(find(alpha, "beta/z").m_status == CaseStatus::skip);
+
+    auto const beta = runner.run(selecting("^beta"));
+    ct::utils::dynamic_assert(beta.size() == 3ul);
+    ct::utils::dynamic_assert(find(beta, "alpha/x").m_status == CaseStatus::skip);
+    ct::utils::dynamic_assert(find(beta, "beta/z").m_status == CaseStatus::pass);
+
+    auto const all = runner.run({});
+    ct::utils::dynamic_assert(all.size() == 3ul);
+    ct::utils::dynamic_assert(std::all_of(all.cbegin(), all.cend(), [](auto const & r) {
+        return r.m_status == CaseStatus::pass;
+    }));
+    if (isolation == ct::execute::IsolationMode::off) {
+        // Worker processes have separate counters (thus only in-process execution can be observed).
+        ct::utils::dynamic_assert(num_alpha == 4ul);
+        ct::utils::dynamic_assert(num_beta == 2ul);
+    }
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    // Isolation gracefully degrades to in-process execution where worker processes aren't supported.
+    register_cases();
+    embedding(ct::execute::IsolationMode::off);
+    embedding(ct::execute::IsolationMode::process);
+
+    // The registry has been left untouched.
+    ct::utils::dynamic_assert(ct::framework::registry().size() == 3ul);
+}
@@ -0,0 +1,130 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Scheduler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace ct = clean_test;
+using Mode = ct::execute::SchedulingMode;
+using namespace std::chrono_literals;
+
+/// Drain a scheduler of @p mode with @p num_workers threads and return all indices handed out (sorted).
+std::vector<std::size_t> drain(Mode const mode, std::size_t const num_cases, std::size_t const num_workers)
+{
+    auto const scheduler = ct::execute::make_scheduler(mode, ct::execute::registration_order(num_cases), num_workers);
+
+    auto claimed = std::vector<std::vector<std::size_t>>(num_workers);
+    {
+        auto workers = std::vector<std::jthread>{};
+        for (auto w = 0ul; w < num_workers; ++w) {
+            workers.emplace_back([&, w] {
+                while (auto const next = scheduler->next(w)) {
+                    claimed[w].emplace_back(*next);
+                }
+            });
+        }
+    }
+
+    auto result = std::vector<std::size_t>{};
+    for (auto const & c : claimed) {
+        result.insert(result.end(), c.cbegin(), c.cend());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void exactly_once()
+{
+    for (auto const mode : {Mode::shared_cursor, Mode::work_stealing}) {
+        for (auto const num_workers : {1ul, 3ul, 8ul}) {
+            for (auto const num_cases : {0ul, 1ul, 5ul, 10'000ul}) {
+                auto const claimed = drain(mode, num_cases, num_workers);
+                ct::utils::dynamic_assert(claimed.size() == num_cases);
+                for (auto i = 0ul; i < claimed.size(); ++i) {
+                    ct::utils::dynamic_assert(claimed[i] == i);
+                }
+            }
+        }
+    }
+}
+
+void sequential_order()
+{
+    // A single worker always executes all cases in their registration order.
+    for (auto const mode : {Mode::shared_cursor, Mode::work_stealing}) {
+        auto const scheduler = ct::execute::make_scheduler(mode, ct::execute::registration_order(4ul), 1ul);
+        for (auto i = 0ul; i < 4ul; ++i) {
+            ct::utils::dynamic_assert(scheduler->next(0ul) == i);
+        }
+        ct::utils::dynamic_assert(not scheduler->next(0ul).has_value());
+    }
+}
+
+void stealing()
+{
+    // Worker 1 first drains its own range [2, 4) and then steals from the back of worker 0's range [0, 2).
+    auto const scheduler = ct::execute::make_scheduler(Mode::work_stealing, ct::execute::registration_order(4ul), 2ul);
+    ct::utils::dynamic_assert(scheduler->next(1ul) == 2ul);
+    ct::utils::dynamic_assert(scheduler->next(1ul) == 3ul);
+    ct::utils::dynamic_assert(scheduler->next(1ul) == 1ul);
+    ct::utils::dynamic_assert(scheduler->next(0ul) == 0ul);
+    ct::utils::dynamic_assert(not scheduler->next(0ul).has_value());
+    ct::utils::dynamic_assert(not scheduler->next(1ul).has_value());
+}
+
+void longest_first()
+{
+    // Durations 1, 4, 2, 3 and 2 on two workers: 4 + 2 on the first one, 3 + 2 + 1 on the second.
+    auto const plan = ct::execute::longest_first({1ms, 4ms, 2ms, 3ms, 2ms}, 2ul);
+    ct::utils::dynamic_assert(plan.m_order == std::vector<std::size_t>{1ul, 3ul, 2ul, 4ul, 0ul});
+    ct::utils::dynamic_assert(plan.m_workers == std::vector<std::size_t>{0ul, 1ul, 1ul, 0ul, 1ul});
+    ct::utils::dynamic_assert(plan.m_makespan == 6ms);
+
+    // Shared cursor follows the global order; work stealing starts each worker on its planned cases.
+    auto const cursor = ct::execute::make_scheduler(Mode::shared_cursor, plan, 2ul);
+    ct::utils::dynamic_assert(cursor->next(1ul) == 1ul);
+    ct::utils::dynamic_assert(cursor->next(0ul) == 3ul);
+
+    auto const stealing = ct::execute::make_scheduler(Mode::work_stealing, plan, 2ul);
+    ct::utils::dynamic_assert(stealing->next(1ul) == 3ul);
+    ct::utils::dynamic_assert(stealing->next(1ul) == 2ul);
+    ct::utils::dynamic_assert(stealing->next(1ul) == 0ul);
+    ct::utils::dynamic_assert(stealing->next(0ul) == 1ul);
+    ct::utils::dynamic_assert(stealing->next(1ul) == 4ul); // stolen
+    ct::utils::dynamic_assert(not stealing->next(0ul).has_value());
+}
+
+void riskiest_first()
+{
+    // Risky cases (descending, ties in planned order) are dealt round-robin; the others are split contiguously.
+    auto const plan = ct::execute::riskiest_first(ct::execute::registration_order(5ul), {0u, 3u, 1u, 0u, 3u}, 2ul);
+    ct::utils::dynamic_assert(plan.m_order == std::vector<std::size_t>{1ul, 4ul, 2ul, 0ul, 3ul});
+    ct::utils::dynamic_assert(plan.m_workers == std::vector<std::size_t>{0ul, 1ul, 0ul, 0ul, 1ul});
+
+    // Other cases keep their planned workers.
+    auto const longest = ct::execute::longest_first({1ms, 4ms, 2ms, 3ms, 2ms}, 2ul);
+    auto const risky = ct::execute::riskiest_first(longest, {0u, 0u, 0u, 5u, 0u}, 2ul);
+    ct::utils::dynamic_assert(risky.m_order == std::vector<std::size_t>{3ul, 1ul, 2ul, 4ul, 0ul});
+    ct::utils::dynamic_assert(risky.m_workers == std::vector<std::size_t>{0ul, 0ul, 1ul, 0ul, 1ul});
+    ct::utils::dynamic_assert(risky.m_makespan == ct::execute::Plan::Duration{});
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    exactly_once();
+    sequential_order();
+    stealing();
+    longest_first();
+    riskiest_first();
+}
@@ -0,0 +1,122 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/History.h>
+#include <execute/NameFilter.h>
+#include <execute/ResultCache.h>
+
+#include <clean-test/framework.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+namespace clean_test::execute {
+namespace {
+
+/// Register test-cases "0" ... "9" and execute those of shard @p index out of @p count (skipping those in @p cache);
+/// returns names of all reported ones.
+std::vector<std::string> run_shard(
+    std::size_t const index, std::size_t const count, History const * history, ResultCache const * cache = nullptr)
+{
+    for (auto i = 0; i < 10; ++i) {
+        ct::Test{std::to_string(i), [] { ct::expect(true); }};
+    }
+
+    auto buffer = std::ostringstream{};
+    auto const filter = NameFilter{};
+    auto const outcome = Conductor{{
+        .m_logger = buffer,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 1u,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter,
+        .m_history = history,
+        .m_cache = cache,
+        .m_shard_index = index,
+        .m_num_shards = count}}.run();
+
+    auto result = std::vector<std::string>{};
+    for (auto const & r : outcome.m_results) {
+        result.emplace_back(r.m_name_path);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void partition(History const * history)
+{
+    auto all = std::vector<std::string>{};
+    for (auto s = 0ul; s < 3ul; ++s) {
+        auto const shard = run_shard(s, 3ul, history);
+        utils::dynamic_assert(not shard.empty());
+        utils::dynamic_assert(run_shard(s, 3ul, history) == shard); // deterministic
+        all.insert(all.end(), shard.cbegin(), shard.cend());
+    }
+
+    // Every test-case is executed by exactly one shard.
+    std::sort(all.begin(), all.end());
+    utils::dynamic_assert(all.size() == 10ul);
+    utils::dynamic_assert(std::adjacent_find(all.cbegin(), all.cend()) == all.cend());
+}
+
+void round_robin()
+{
+    partition(nullptr);
+    utils::dynamic_assert(run_shard(0ul, 3ul, nullptr) == std::vector<std::string>{"0", "3", "6", "9"});
+    utils::dynamic_assert(run_shard(0ul, 1ul, nullptr).size() == 10ul);
+}
+
+void balanced()
+{
+    // Test-case "0" takes as long as all others together: It gets a shard on its own.
+    auto in = std::istringstream{
+        "9000000\t0\n1000000\t1\n1000000\t2\n1000000\t3\n1000000\t4\n"
+        "1000000\t5\n1000000\t6\n1000000\t7\n1000000\t8\n1000000\t9\n"};
+    auto history = History{};
+    in >> history;
+
+    partition(&history);
+    utils::dynamic_assert(run_shard(0ul, 2ul, &history) == std::vector<std::string>{"0"});
+    utils::dynamic_assert(run_shard(1ul, 2ul, &history).size() == 9ul);
+}
+
+void cached()
+{
+    auto in = std::istringstream{
+        "1000000\t0\n2000000\t1\n3000000\t2\n4000000\t3\n5000000\t4\n"
+        "6000000\t5\n7000000\t6\n8000000\t7\n9000000\t8\n9500000\t9\n"};
+    auto history = History{};
+    in >> history;
+    auto cache = ResultCache{"key"};
+    auto cached = std::istringstream{"key\n5\n8\n9\n"};
+    cached >> cache;
+
+    // Shards split identically regardless of their local cache: Every test-case is reported by exactly one of them.
+    auto all = run_shard(0ul, 2ul, &history, &cache);
+    utils::dynamic_assert(all == run_shard(0ul, 2ul, &history));
+    auto const other = run_shard(1ul, 2ul, &history);
+    all.insert(all.end(), other.cbegin(), other.cend());
+    std::sort(all.begin(), all.end());
+    utils::dynamic_assert(all.size() == 10ul);
+    utils::dynamic_assert(std::adjacent_find(all.cbegin(), all.cend()) == all.cend());
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::round_robin();
+    ct::execute::balanced();
+    ct::execute::cached();
+}
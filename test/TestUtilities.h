@@ -5,7 +5,22 @@
 
 #include <clean-test/utils/SourceLocation.h>
 
+// Internal headers are only available to tests not configured as EXTERNAL.
+#if __has_include(<execute/Conductor.h>)
+# define CLEANTEST_HAS_INTERNAL_HEADERS 1
+# include <execute/ColoringSetup.h>
+# include <execute/Conductor.h>
+# include <execute/NameFilter.h>
+#else
+# define CLEANTEST_HAS_INTERNAL_HEADERS 0
+#endif
+
+#include <algorithm>
+#include <concepts>
 #include <iostream>
+#include <sstream>
+#include <string_view>
+#include <utility>
 
 namespace clean_test::utils {
 
@@ -29,3 +44,47 @@ void discard(T && t)
 }
 
 }
+
+#if CLEANTEST_HAS_INTERNAL_HEADERS
+
+namespace clean_test::execute {
+
+/// Execute all registered test-cases, reporting into @p logger (without colors).
+///
+/// Starts from a single worker buffering per test-case without any filter; @p adjust overrides the remaining
+/// @c Conductor::Setup (e.g. the number of workers or the isolation) beforehand.
+template <std::invocable<Conductor::Setup &> Adjust>
+Outcome run(std::ostream & logger, Adjust && adjust)
+{
+    auto const filter = NameFilter{};
+    auto setup = Conductor::Setup{
+        .m_logger = logger,
+        .m_colors = coloring_setup(ColoringMode::disabled),
+        .m_num_workers = 1ul,
+        .m_buffering = BufferingMode::testcase,
+        .m_filter = filter};
+    std::forward<Adjust>(adjust)(setup);
+    return Conductor{setup}.run();
+}
+
+/// Execute all registered test-cases like @c run above, discarding their console output.
+template <std::invocable<Conductor::Setup &> Adjust>
+Outcome run(Adjust && adjust)
+{
+    auto logger = std::ostringstream{};
+    return run(logger, std::forward<Adjust>(adjust));
+}
+
+/// Result of the test-case @p name within @p outcome (which must contain it).
+inline CaseResult const & find(Outcome const & outcome, std::string_view const name)
+{
+    auto const pos = std::find_if(outcome.m_results.cbegin(), outcome.m_results.cend(), [name](auto const & r) {
+        return r.m_name_path == name;
+    });
+    utils::dynamic_assert(pos != outcome.m_results.cend());
+    return *pos;
+}
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ThreadPool.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace ct = clean_test;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+void pool()
+{
+    auto released = std::atomic<bool>{false};
+    {
+        auto threads = ThreadPool{};
+        ct::utils::dynamic_assert(threads.size() == 0ul);
+
+        // Sequential tasks reuse the same thread.
+        auto num_runs = std::atomic<std::size_t>{0ul};
+        for (auto i = 0; i < 3; ++i) {
+            threads.submit([&num_runs] { ++num_runs; }).wait();
+        }
+        ct::utils::dynamic_assert(num_runs == 3ul);
+        ct::utils::dynamic_assert(threads.size() == 1ul);
+
+        // Concurrent tasks get further threads.
+        auto num_waiting = std::atomic<std::size_t>{0ul};
+        auto const rendezvous = [&num_waiting] {
+            ++num_waiting;
+            while (num_waiting < 3ul) {
+                std::this_thread::yield();
+            }
+        };
+        auto completions = std::vector<ThreadPool::Completion>{};
+        for (auto i = 0; i < 3; ++i) {
+            completions.emplace_back(threads.submit(rendezvous));
+        }
+        for (auto const & completion : completions) {
+            completion.wait();
+        }
+        ct::utils::dynamic_assert(threads.size() == 3ul);
+
+        // Abandoned tasks aren't waited for (on destruction).
+        threads.submit([&released] {
+                   while (not released) {
+                       std::this_thread::sleep_for(1ms);
+                   }
+               }).abandon();
+        ct::utils::dynamic_assert(threads.size() == 3ul);
+    }
+    released = true;
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    ct::execute::pool();
+}
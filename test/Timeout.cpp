@@ -0,0 +1,130 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/Conductor.h>
+#include <execute/ProcessPool.h>
+#include <execute/Watchdog.h>
+
+#include <clean-test/framework.h>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+namespace ct = clean_test;
+using namespace ct::literals;
+using namespace std::chrono_literals;
+
+namespace clean_test::execute {
+namespace {
+
+constexpr bool contains(std::string_view const haystack, std::string_view needle)
+{
+    return (haystack.find(needle) != std::string_view::npos);
+}
+
+std::atomic<bool> released = false; //!< whether hanging test-cases may finish.
+std::atomic<int> num_hanging = 0; //!< number of test-cases currently hanging.
+
+/// Register test-case @p name which hangs until @c released.
+void register_hanging(std::string name)
+{
+    ct::Test{std::move(name) / "timeout:1"_tag, [] {
+        ++num_hanging;
+        while (not released) {
+            std::this_thread::sleep_for(1ms);
+        }
+        --num_hanging;
+    }};
+}
+
+/// Let all hanging (and abandoned) test-cases finish.
+void release()
+{
+    released = true;
+    while (num_hanging > 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+    released = false;
+}
+
+CaseStatus status(Outcome const & outcome, std::string_view const name)
+{
+    for (auto const & r : outcome.m_results) {
+        if (r.m_name_path == name) {
+            return r.m_status;
+        }
+    }
+    return CaseStatus::skip;
+}
+
+void tags()
+{
+    auto const fallback = CaseResult::Duration{7s};
+    ct::utils::dynamic_assert(timeout(framework::Name{"a"}, fallback) == fallback);
+    ct::utils::dynamic_assert(timeout("a" / "timeout:3"_tag, fallback) == 3s);
+    ct::utils::dynamic_assert(timeout("a" / "timeout:3"_tag / "timeout:0"_tag, fallback) == 0s);
+    ct::utils::dynamic_assert(timeout("a" / "timeout:3s"_tag / "timeout"_tag, fallback) == fallback);
+}
+
+void proceed(IsolationMode const isolation)
+{
+    "before"_test = [] { ct::expect(true); };
+    register_hanging("hanging");
+    "after"_test = [] { ct::expect(true); };
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) { setup.m_isolation = isolation; });
+    release();
+
+    auto const console = std::move(logger).str();
+    ct::utils::dynamic_assert(outcome.m_results.size() == 3ul);
+    ct::utils::dynamic_assert(status(outcome, "before") == CaseStatus::pass);
+    ct::utils::dynamic_assert(status(outcome, "hanging") == CaseStatus::timeout);
+    ct::utils::dynamic_assert(status(outcome, "after") == CaseStatus::pass);
+    ct::utils::dynamic_assert(contains(console, "[ TIME  ] hanging"));
+    ct::utils::dynamic_assert(contains(console, "hanging exceeded its timeout"));
+    ct::utils::dynamic_assert(contains(console, "worker 0: hanging"));
+}
+
+void terminate(IsolationMode const isolation)
+{
+    register_hanging("hanging");
+    "other"_test = [] {
+        std::this_thread::sleep_for(2s);
+        ct::expect(true);
+    };
+    "never"_test = [] { ct::expect(true); };
+
+    auto logger = std::ostringstream{};
+    auto const outcome = run(logger, [isolation](Conductor::Setup & setup) {
+        setup.m_num_workers = 2ul;
+        setup.m_isolation = isolation;
+        setup.m_on_timeout = TimeoutMode::terminate;
+    });
+    release();
+
+    // The running test-case is completed; no further test-cases are started.
+    ct::utils::dynamic_assert(outcome.m_results.size() == 2ul);
+    ct::utils::dynamic_assert(status(outcome, "hanging") == CaseStatus::timeout);
+    ct::utils::dynamic_assert(status(outcome, "other") == CaseStatus::pass);
+}
+
+}
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    using ct::execute::IsolationMode;
+    ct::execute::tags();
+    ct::execute::proceed(IsolationMode::off);
+    ct::execute::terminate(IsolationMode::off);
+    if (ct::execute::supports_isolation()) {
+        ct::execute::proceed(IsolationMode::process);
+        ct::execute::terminate(IsolationMode::process);
+    }
+}
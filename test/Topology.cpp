@@ -0,0 +1,90 @@
+// Copyright (c) m8mble 2024.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TestUtilities.h"
+
+#include <execute/ColoringSetup.h>
+#include <execute/Conductor.h>
+#include <execute/NameFilter.h>
+#include <execute/Topology.h>
+
+#include <clean-test/framework.h>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+namespace ct = clean_test;
+using namespace ct::literals;
+
+void limits()
+{
+    using ct::execute::cpu_limit;
+    // cgroup v2 "cpu.max"
+    ct::utils::dynamic_assert(not cpu_limit("max", "100000"));
+    ct::utils::dynamic_assert(cpu_limit("400000", "100000") == 4ul);
+    ct::utils::dynamic_assert(cpu_limit("150000", "100000") == 2ul);
+    ct::utils::dynamic_assert(cpu_limit("10000", "100000") == 1ul);
+
+    // cgroup v1 "cpu.cfs_quota_us" and "cpu.cfs_period_us"
+    ct::utils::dynamic_assert(not cpu_limit("-1", "100000\n"));
+    ct::utils::dynamic_assert(cpu_limit("200000\n", "100000\n") == 2ul);
+
+    // Malformed
+    ct::utils::dynamic_assert(not cpu_limit("", "100000"));
+    ct::utils::dynamic_assert(not cpu_limit("100000", "0"));
+    ct::utils::dynamic_assert(not cpu_limit("1e5", "100000"));
+}
+
+void availability()
+{
+    auto const available = ct::execute::available_cpus();
+    ct::utils::dynamic_assert(available >= 1ul);
+    if (auto const hardware = std::thread::hardware_concurrency(); hardware != 0u) {
+        ct::utils::dynamic_assert(available <= hardware);
+    }
+}
+
+void pinning()
+{
+    auto order = ct::execute::pinning_order();
+    if (not ct::execute::supports_pinning()) {
+        ct::utils::dynamic_assert(order.empty());
+        return;
+    }
+    ct::utils::dynamic_assert(not order.empty());
+    ct::utils::dynamic_assert(order.size() >= ct::execute::available_cpus());
+    std::sort(order.begin(), order.end());
+    ct::utils::dynamic_assert(std::adjacent_find(order.cbegin(), order.cend()) == order.cend());
+
+    // Pinned workers execute all test-cases.
+    auto const filter = ct::execute::NameFilter{};
+    auto logger = std::ostringstream{};
+    for (auto i = 0; i < 10; ++i) {
+        ct::Test{"pinned" / ct::framework::Name{std::to_string(i)}, [] { ct::expect(true); }};
+    }
+    auto const outcome = ct::execute::Conductor{{
+        .m_logger = logger,
+        .m_colors = ct::execute::coloring_setup(ct::execute::ColoringMode::disabled),
+        .m_num_workers = 2ul,
+        .m_buffering = ct::execute::BufferingMode::testcase,
+        .m_filter = filter,
+        .m_pinning = ct::execute::PinningMode::cores}}.run();
+    ct::utils::dynamic_assert(outcome.m_results.size() == 10ul);
+
+    // Pinning the current thread restricts it to that CPU.
+    ct::utils::dynamic_assert(ct::execute::pin_current_thread(order.front()));
+    ct::utils::dynamic_assert(ct::execute::pinning_order() == std::vector{order.front()});
+}
+
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    limits();
+    availability();
+    pinning();
+}